@@ -136,11 +136,20 @@ namespace Avida {
     static int FindBestOffset(const InstructionSequence& seq1, const InstructionSequence& seq2);
     static int FindSlidingDistance(const InstructionSequence& seq1, const InstructionSequence& seq2);
     static int FindEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2);
+    //! Edit distance if it is at most max_distance, otherwise max_distance + 1.  Exits early once the bound is exceeded.
+    static int FindEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2, int max_distance);
     
     
   protected:
     LIB_EXPORT virtual void adjustCapacity(int new_size);
     LIB_EXPORT virtual void prepareInsert(int pos, int num_sites);
+    
+  private:
+    // The sites as raw instruction bytes, used by the distance methods
+    inline const unsigned char* rawSites() const
+    {
+      return (m_active_size) ? reinterpret_cast<const unsigned char*>(&m_seq[0]) : NULL;
+    }
   };
 
 
@@ -149,7 +149,7 @@ private:
       land->SetTrials(m_trials);
       batches[dist - 1].PushRear(land);
       if (dist == 1) {
-        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::Process));        
+        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::ProcessQueued));        
       } else {
         land->SetMinFound(m_min_found);
         land->SetMaxTrials(m_max_trials);
@@ -260,7 +260,7 @@ public:
         land = new cLandscape(m_world, genotype->GetGenome());
         land->SetDistance(m_dist);
         m_batch.PushRear(land);
-        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::Process));
+        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::ProcessQueued));
       }
       jobqueue.Execute();
 
@@ -375,7 +375,7 @@ public:
         land = new cLandscape(m_world, genotype->GetGenome());
         land->SetDistance(m_dist);
         m_batch.PushRear(land);
-        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::ProcessDelete));
+        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::ProcessDeleteQueued));
       }
       jobqueue.Execute();
 
@@ -438,7 +438,7 @@ public:
         land = new cLandscape(m_world, genotype->GetGenome());
         land->SetDistance(m_dist);
         m_batch.PushRear(land);
-        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::ProcessInsert));
+        jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::ProcessInsertQueued));
       }
       jobqueue.Execute();
     
@@ -814,7 +814,7 @@ public:
           land->SetTrials(m_sample_size);
           jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::TestPairs));
         } else {
-          jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::TestAllPairs));
+          jobqueue.AddJob(new tAnalyzeJob<cLandscape>(land, &cLandscape::TestAllPairsQueued));
         }
         m_batch.PushRear(land);
       }
@@ -3951,7 +3951,7 @@ public:
             cPhenotype& test_phenotype = organism->GetPhenotype();
             
             for (int k = 0; k < num_tasks; k++) {
-              if (test_phenotype.GetLastParasiteTaskCount()[k] > 0) task_sum += static_cast<int>(pow(2.0, k));
+              if (test_phenotype.GetLastParasiteTaskCount(k) > 0) task_sum += static_cast<int>(pow(2.0, k));
             }
             
           }
@@ -4046,7 +4046,7 @@ public:
             cPhenotype& test_phenotype = organism->GetPhenotype();
           
             for (int k = 0; k < num_tasks; k++) {
-              cString task_count_string = cStringUtil::Stringf("%d", test_phenotype.GetLastParasiteTaskCount()[k]);
+              cString task_count_string = cStringUtil::Stringf("%d", test_phenotype.GetLastParasiteTaskCount(k));
               task_list += task_count_string;
               if (k != num_tasks -1)
                 task_list += ",";
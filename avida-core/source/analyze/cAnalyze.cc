@@ -48,6 +48,7 @@
 #include "cAvidaContext.h"
 #include "cCPUTestInfo.h"
 #include "cEnvironment.h"
+#include "cGenotypeDistanceStats.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cHardwareStatusPrinter.h"
@@ -90,6 +91,82 @@ using namespace std;
 using namespace Avida;
 using namespace AvidaTools;
 
+
+// cRecalcJob - Recalculates a single genotype as part of a batch fanned out through the analyze job queue.
+//
+// Test infos hold the organisms of their last test, so every job sets up its own from the shared settings rather
+// than sharing (or copying) the caller's.  Parent based stats are left to the caller, which applies them in batch
+// order once the whole batch has completed.
+
+class cRecalcJob
+{
+public:
+  struct sSettings
+  {
+    bool use_random_inputs;
+    bool use_manual_inputs;
+    Apto::Array<int> manual_inputs;
+    int res_method;
+    cResourceHistory* res;
+    int update;
+    int cpu_cycle_offset;
+    int num_trials;
+    
+    sSettings() : use_random_inputs(false), use_manual_inputs(false), res_method(RES_INITIAL), res(NULL), update(0)
+      , cpu_cycle_offset(0), num_trials(1) { ; }
+  };
+  
+private:
+  cAnalyzeGenotype* m_genotype;
+  const sSettings& m_settings;
+  
+  
+  cRecalcJob(); // @not_implemented
+  cRecalcJob(const cRecalcJob&); // @not_implemented
+  cRecalcJob& operator=(const cRecalcJob&); // @not_implemented
+  
+public:
+  cRecalcJob(cAnalyzeGenotype* genotype, const sSettings& settings) : m_genotype(genotype), m_settings(settings) { ; }
+  
+  void Process(cAvidaContext& ctx)
+  {
+    cCPUTestInfo test_info;
+    if (m_settings.use_manual_inputs) test_info.UseManualInputs(m_settings.manual_inputs);
+    else test_info.UseRandomInputs(m_settings.use_random_inputs);
+    test_info.SetResourceOptions(m_settings.res_method, m_settings.res, m_settings.update, m_settings.cpu_cycle_offset);
+    m_genotype->Recalculate(ctx, &test_info, NULL, m_settings.num_trials);
+  }
+  
+  static void RunBatch(cAnalyzeJobQueue& queue, const Apto::Array<cAnalyzeGenotype*>& genotypes, const sSettings& settings)
+  {
+    Apto::Array<cRecalcJob*> jobs(genotypes.GetSize());
+    tAnalyzeJobBatch<cRecalcJob> jobbatch(queue);
+    for (int i = 0; i < genotypes.GetSize(); i++) {
+      jobs[i] = new cRecalcJob(genotypes[i], settings);
+      jobbatch.AddJob(jobs[i], &cRecalcJob::Process);
+    }
+    jobbatch.RunBatch();
+    for (int i = 0; i < jobs.GetSize(); i++) delete jobs[i];
+  }
+  
+  static void RecalculateList(cAnalyzeJobQueue& queue, tList<cAnalyzeGenotype>& genotype_list, const sSettings& settings)
+  {
+    Apto::Array<cAnalyzeGenotype*> genotypes;
+    tListIterator<cAnalyzeGenotype> list_it(genotype_list);
+    cAnalyzeGenotype* genotype = NULL;
+    while ((genotype = list_it.Next()) != NULL) genotypes.Push(genotype);
+    
+    RunBatch(queue, genotypes, settings);
+    
+    // If the previous genotype was the parent of this one, fill in the stats relative to it (distance to parent,
+    // etc.).  This is done in list order, after all tests are done, since ancestor distances accumulate down a lineage.
+    for (int i = 1; i < genotypes.GetSize(); i++) {
+      if (genotypes[i]->GetParentID() == genotypes[i - 1]->GetID()) genotypes[i]->CalcParentStats(genotypes[i - 1]);
+    }
+  }
+};
+
+
 cAnalyze::cAnalyze(cWorld* world)
 : cur_batch(0)
 /*
@@ -1879,6 +1956,8 @@ void cAnalyze::CommandDetail(cString cur_string)
   while (file_extension.Find('.') != -1) file_extension.Pop('.');
   if (file_extension == "html") file_type = FILE_TYPE_HTML;
   
+  CommandDetail_Precalc(output_it);
+  
   // Setup the file...
   if (filename == "cout") {
     CommandDetail_Header(cout, file_type, output_it);
@@ -2061,6 +2140,52 @@ void cAnalyze::CommandDetail_Body(ostream& fp, int format_type,
   }
   }
 
+void cAnalyze::CommandDetail_Precalc(tListIterator< tDataEntryCommand<cAnalyzeGenotype> >& output_it)
+{
+  // Columns backed by landscapes, phenotypic plasticity summaries or knockouts run the test CPU on demand.  Calculate
+  // them for the whole batch through the job queue first, so that the body only has to print them.
+  bool need_land = false;
+  bool need_phenplast = false;
+  bool need_ko = false;
+  bool need_ko_pairs = false;
+  
+  output_it.Reset();
+  tDataEntryCommand<cAnalyzeGenotype>* data_command = NULL;
+  while ((data_command = output_it.Next()) != NULL) {
+    const cString& name = data_command->GetName();
+    if (name == "frac_dead" || name == "frac_neg" || name == "frac_neut" || name == "frac_pos" ||
+        name == "complexity" || name == "land_fitness") {
+      need_land = true;
+    } else if (name == "num_phen" || name == "num_trials" || name.Find("phen_") == 0 || name == "prob_viable" ||
+               name == "prob_task") {
+      need_phenplast = true;
+    } else if (name.Find("ko_pair_") == 0) {
+      need_ko_pairs = true;
+    } else if (name.Find("ko_") == 0) {
+      need_ko = true;
+    }
+  }
+  output_it.Reset();
+  
+  if (!need_land && !need_phenplast && !need_ko && !need_ko_pairs) return;
+  
+  tAnalyzeJobBatch<cAnalyzeGenotype> jobbatch(m_jobqueue);
+  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
+  for (cAnalyzeGenotype* cur_genotype = batch_it.Next(); cur_genotype; cur_genotype = batch_it.Next()) {
+    if (need_land && !cur_genotype->HasLandscape()) jobbatch.AddJob(cur_genotype, &cAnalyzeGenotype::CalcLandscape);
+    if (need_phenplast && !cur_genotype->HasPhenPlast()) jobbatch.AddJob(cur_genotype, &cAnalyzeGenotype::CalcPhenPlast);
+    
+    // Pair knockouts include the single knockouts.  Knockouts replace sites with the NULL instruction, which must be
+    // activated here since activating it changes the instruction set.
+    if ((need_ko || need_ko_pairs) && !cur_genotype->HasKnockouts(need_ko_pairs)) {
+      m_world->GetHardwareManager().GetInstSet(cur_genotype->GetGenome().Properties().Get("instset").StringValue()).ActivateNullInst();
+      if (need_ko_pairs) jobbatch.AddJob(cur_genotype, &cAnalyzeGenotype::CalcPairKnockouts);
+      else jobbatch.AddJob(cur_genotype, &cAnalyzeGenotype::CalcSingleKnockouts);
+    }
+  }
+  jobbatch.RunBatch();
+}
+
 void cAnalyze::CommandDetailAverage_Body(ostream& fp, int nucoutputs,
                                          tListIterator< tDataEntryCommand<cAnalyzeGenotype> > & output_it)
 {
@@ -3221,63 +3346,30 @@ void cAnalyze::CommandPrintDistances(cString cur_string)
   fout << "# 5: Frac distances above threshold (" << dist_threshold << ")" << endl;
   fout << endl;
   
-  // Loop through all pairs of organisms.
-  int dist_total = 0;
-  int dist_max = 0;
-  int pair_count = 0;
-  int threshold_pair_count = 0;
+  // Calculate the distances of all pairs of genotypes on the job queue...
+  cGenotypeDistanceStats distances(cGenotypeDistanceStats::DIST_EDIT, dist_threshold);
+  distances.Calculate(m_jobqueue, batch[cur_batch].List());
+  
+  // ...then pair each genotype with itself for a distance of 0.
+  double pair_count = distances.GetPairCount();
 	double count = 0;
 	
-  cAnalyzeGenotype * genotype1 = NULL;
-  cAnalyzeGenotype * genotype2 = NULL;
-  tListIterator<cAnalyzeGenotype> batch_it1(batch[cur_batch].List());
-
-  int watermark = 0;
-  
-  while ((genotype1 = batch_it1.Next()) != NULL) {
+  cAnalyzeGenotype* genotype = NULL;
+  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
+  while ((genotype = batch_it.Next()) != NULL) {
 		count ++;
-    const int gen1_count = genotype1->GetNumCPUs();
-
-    // Pair this genotype with itself for a distance of 0.
-    pair_count += gen1_count * (gen1_count - 1) / 2;
-
-    // Loop through the other genotypes this one can be paired with.
-    tListIterator<cAnalyzeGenotype> batch_it2(batch_it1);
-    while ((genotype2 = batch_it2.Next()) != NULL) {
-      const int gen2_count = genotype2->GetNumCPUs();
-      const int cur_pairs = gen1_count * gen2_count;
-      
-      const Genome& genotype1_genome = genotype1->GetGenome();
-      ConstInstructionSequencePtr genotype1_seq_p;
-      ConstGeneticRepresentationPtr genotype1_rep_p = genotype1_genome.Representation();
-      genotype1_seq_p.DynamicCastFrom(genotype1_rep_p);
-      const InstructionSequence& genotype1_seq = *genotype1_seq_p;
-      
-      const Genome& genotype2_genome = genotype2->GetGenome();
-      ConstInstructionSequencePtr genotype2_seq_p;
-      ConstGeneticRepresentationPtr genotype2_rep_p = genotype2_genome.Representation();
-      genotype2_seq_p.DynamicCastFrom(genotype2_rep_p);
-      const InstructionSequence& genotype2_seq = *genotype2_seq_p;
-
-      const int cur_dist = InstructionSequence::FindEditDistance(genotype1_seq, genotype2_seq);
-      dist_total += cur_pairs * cur_dist;
-      if (cur_dist > dist_max) dist_max = cur_dist;
-      pair_count += cur_pairs;
-      if (cur_dist >= dist_threshold) threshold_pair_count += cur_pairs;
-
-      if (pair_count > watermark) {
-	cout << watermark << endl;
-	watermark += 100000;
-      }
-    }
+    const int gen_count = genotype->GetNumCPUs();
+    pair_count += gen_count * (gen_count - 1) / 2;
   }
   
+  const double dist_total = distances.GetDistanceTotal();
+  
 	count = (count * (count-1) ) /2;
-  fout << pair_count << " "
-	     << ((double) dist_total) / count << " " 
-       << ((double) dist_total) / (double) pair_count << " "
-       << dist_max << " "
-       << ((double) threshold_pair_count) / (double) pair_count << " "
+  fout << static_cast<unsigned long long>(pair_count) << " "
+	     << dist_total / count << " " 
+       << dist_total / pair_count << " "
+       << distances.GetMaxDistance() << " "
+       << distances.GetThresholdPairCount() / pair_count << " "
        << endl;
 }
 
@@ -5837,12 +5929,38 @@ void cAnalyze::CommandMapTasks(cString cur_string)
       batch_it.Next();  // Put the list back where it was...
     }
     
-    // Calculate the stats for the genotype we're working with...
-    cCPUTestInfo test_info;
-    if (use_manual_inputs)
-      test_info.UseManualInputs(manual_inputs);
-    test_info.SetResourceOptions(use_resources, m_resources);
-    genotype->Recalculate(m_ctx, &test_info);
+    // Calculate the stats for the genotype we're working with, along with each of its single site knockouts...
+    const Genome& base_genome = genotype->GetGenome();
+    ConstInstructionSequencePtr base_seq_p;
+    ConstGeneticRepresentationPtr rep_p = base_genome.Representation();
+    base_seq_p.DynamicCastFrom(rep_p);
+    const InstructionSequence& base_seq = *base_seq_p;
+    const int max_line = base_seq.GetSize();
+    
+    const Instruction null_inst =
+      m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).ActivateNullInst();
+    
+    Genome mod_genome(base_genome);
+    InstructionSequencePtr mod_seq_p;
+    GeneticRepresentationPtr mod_rep_p = mod_genome.Representation();
+    mod_seq_p.DynamicCastFrom(mod_rep_p);
+    InstructionSequence& mod_seq = *mod_seq_p;
+    
+    Apto::Array<cAnalyzeGenotype*> test_genotypes(max_line + 1);
+    test_genotypes[0] = genotype;
+    for (int line_num = 0; line_num < max_line; line_num++) {
+      mod_seq[line_num] = null_inst;
+      test_genotypes[line_num + 1] = new cAnalyzeGenotype(m_world, mod_genome);
+      mod_seq[line_num] = base_seq[line_num];
+    }
+    
+    // ...fanned out through the job queue
+    cRecalcJob::sSettings settings;
+    settings.use_manual_inputs = use_manual_inputs;
+    settings.manual_inputs = manual_inputs;
+    settings.res_method = use_resources;
+    settings.res = m_resources;
+    cRecalcJob::RunBatch(m_jobqueue, test_genotypes, settings);
     
     // Headers...
     if (file_type == FILE_TYPE_TEXT) {
@@ -5924,19 +6042,6 @@ void cAnalyze::CommandMapTasks(cString cur_string)
       fp << "</tr>" << endl;
     }
     
-    const int max_line = genotype->GetLength();
-    const Genome& base_genome = genotype->GetGenome();
-    ConstInstructionSequencePtr base_seq_p;
-    ConstGeneticRepresentationPtr rep_p = base_genome.Representation();
-    base_seq_p.DynamicCastFrom(rep_p);
-    const InstructionSequence& base_seq = *base_seq_p;
-    
-    Genome mod_genome(base_genome);
-    InstructionSequencePtr mod_seq_p;
-    GeneticRepresentationPtr mod_rep_p = mod_genome.Representation();
-    mod_seq_p.DynamicCastFrom(mod_rep_p);
-    InstructionSequence& mod_seq = *mod_seq_p;
-    
     // Keep track of the number of failues/successes for attributes...
     int * col_pass_count = new int[num_cols];
     int * col_fail_count = new int[num_cols];
@@ -5946,16 +6051,13 @@ void cAnalyze::CommandMapTasks(cString cur_string)
     }
     
     cInstSet& is = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue());
-    const Instruction null_inst = is.ActivateNullInst();
     
-    // Loop through all the lines of code, testing the removal of each.
+    // Loop through all the lines of code, reporting the removal of each.
     for (int line_num = 0; line_num < max_line; line_num++) {
       int cur_inst = base_seq[line_num].GetOp();
       char cur_symbol = base_seq[line_num].GetSymbol()[0]; // hack to work around multichar symbols
       
-      mod_seq[line_num] = null_inst;
-      cAnalyzeGenotype test_genotype(m_world, mod_genome);
-      test_genotype.Recalculate(m_ctx, &test_info);
+      const cAnalyzeGenotype& test_genotype = *test_genotypes[line_num + 1];
       
       if (file_type == FILE_TYPE_HTML) fp << "<tr><td align=right>";
       fp << (line_num + 1) << " ";
@@ -5991,9 +6093,6 @@ void cAnalyze::CommandMapTasks(cString cur_string)
       }
       if (file_type == FILE_TYPE_HTML) fp << "</tr>";
       fp << endl;
-      
-      // Reset the mod_genome back to the original sequence.
-      mod_seq[line_num].SetOp(cur_inst);
     }
     
     
@@ -6019,6 +6118,7 @@ void cAnalyze::CommandMapTasks(cString cur_string)
     
     delete [] col_pass_count;
     delete [] col_fail_count;
+    for (int i = 1; i < test_genotypes.GetSize(); i++) delete test_genotypes[i];
   }
 }
 
@@ -7007,45 +7107,12 @@ void cAnalyze::CommandHamming(cString cur_string)
     cout.flush();
   }
   
-  // Setup some variables;
-  cAnalyzeGenotype * genotype1 = NULL;
-  cAnalyzeGenotype * genotype2 = NULL;
-
-  double total_dist = 0;
-  double total_count = 0;
-  
-  tListIterator<cAnalyzeGenotype> list1_it(batch[batch1].List());
-  tListIterator<cAnalyzeGenotype> list2_it(batch[batch2].List());
-  
-  while ((genotype1 = list1_it.Next()) != NULL) {
-    list2_it.Reset();
-    while ((genotype2 = list2_it.Next()) != NULL) {
-      // Determine the counts...
-      const int count1 = genotype1->GetNumCPUs();
-      const int count2 = genotype2->GetNumCPUs();
-      const int num_pairs = (genotype1 == genotype2) ?
-        ((count1 - 1) * (count2 - 1)) : (count1 * count2);
-      if (num_pairs == 0) continue;
-      
-      // And do the tests...
-      const Genome& genotype1_genome = genotype1->GetGenome();
-      ConstInstructionSequencePtr genotype1_seq_p;
-      ConstGeneticRepresentationPtr genotype1_rep_p = genotype1_genome.Representation();
-      genotype1_seq_p.DynamicCastFrom(genotype1_rep_p);
-      const InstructionSequence& genotype1_seq = *genotype1_seq_p;
-      
-      const Genome& genotype2_genome = genotype2->GetGenome();
-      ConstInstructionSequencePtr genotype2_seq_p;
-      ConstGeneticRepresentationPtr genotype2_rep_p = genotype2_genome.Representation();
-      genotype2_seq_p.DynamicCastFrom(genotype2_rep_p);
-      const InstructionSequence& genotype2_seq = *genotype2_seq_p;
-
-      const int dist = InstructionSequence::FindHammingDistance(genotype1_seq, genotype2_seq);
-      total_dist += dist * num_pairs;
-      total_count += num_pairs;
-    }
-  }
+  // Calculate the distances of all pairs of genotypes between the batches on the job queue.
+  cGenotypeDistanceStats distances(cGenotypeDistanceStats::DIST_HAMMING);
+  distances.Calculate(m_jobqueue, batch[batch1].List(), batch[batch2].List());
   
+  const double total_dist = distances.GetDistanceTotal();
+  const double total_count = distances.GetPairCount();
   
   // Calculate the final answer
   double ave_dist = (double) total_dist / (double) total_count;
@@ -7059,7 +7126,7 @@ void cAnalyze::CommandHamming(cString cur_string)
   df->Write(batch[batch1].Name(), "Name of First Batch");
   df->Write(batch[batch2].Name(), "Name of Second Batch");
   df->Write(ave_dist,             "Average Hamming Distance");
-  df->Write(total_count,          "Total Pairs Test");
+  df->Write(static_cast<long>(total_count), "Total Pairs Test");
   df->Endl();
 }
 
@@ -7085,44 +7152,12 @@ void cAnalyze::CommandLevenstein(cString cur_string)
     cout.flush();
   }
   
-  // Setup some variables;
-  cAnalyzeGenotype * genotype1 = NULL;
-  cAnalyzeGenotype * genotype2 = NULL;
-  double total_dist = 0;
-  double total_count = 0;
-  
-  tListIterator<cAnalyzeGenotype> list1_it(batch[batch1].List());
-  tListIterator<cAnalyzeGenotype> list2_it(batch[batch2].List());
+  // Calculate the distances of all pairs of genotypes between the batches on the job queue.
+  cGenotypeDistanceStats distances(cGenotypeDistanceStats::DIST_EDIT);
+  distances.Calculate(m_jobqueue, batch[batch1].List(), batch[batch2].List());
   
-  // Loop through all of the genotypes in each batch...
-  while ((genotype1 = list1_it.Next()) != NULL) {
-    list2_it.Reset();
-    while ((genotype2 = list2_it.Next()) != NULL) {
-      // Determine the counts...
-      const int count1 = genotype1->GetNumCPUs();
-      const int count2 = genotype2->GetNumCPUs();
-      const int num_pairs = (genotype1 == genotype2) ?
-        ((count1 - 1) * (count2 - 1)) : (count1 * count2);
-      if (num_pairs == 0) continue;
-      
-      // And do the tests...
-      const Genome& genotype1_genome = genotype1->GetGenome();
-      ConstInstructionSequencePtr genotype1_seq_p;
-      ConstGeneticRepresentationPtr genotype1_rep_p = genotype1_genome.Representation();
-      genotype1_seq_p.DynamicCastFrom(genotype1_rep_p);
-      const InstructionSequence& genotype1_seq = *genotype1_seq_p;
-
-      const Genome& genotype2_genome = genotype2->GetGenome();
-      ConstInstructionSequencePtr genotype2_seq_p;
-      ConstGeneticRepresentationPtr genotype2_rep_p = genotype2_genome.Representation();
-      genotype2_seq_p.DynamicCastFrom(genotype2_rep_p);
-      const InstructionSequence& genotype2_seq = *genotype2_seq_p;
-
-      const int dist = InstructionSequence::FindEditDistance(genotype1_seq, genotype2_seq);
-      total_dist += dist * num_pairs;
-      total_count += num_pairs;
-    }
-  }
+  const double total_dist = distances.GetDistanceTotal();
+  const double total_count = distances.GetPairCount();
   
   // Calculate the final answer
   double ave_dist = (double) total_dist / (double) total_count;
@@ -7136,7 +7171,7 @@ void cAnalyze::CommandLevenstein(cString cur_string)
   df->Write(batch[batch1].Name(), "Name of First Batch");
   df->Write(batch[batch2].Name(), "Name of Second Batch");
   df->Write(ave_dist,             "Average Levenstein Distance");
-  df->Write(total_count,          "Total Pairs Test");
+  df->Write(static_cast<long>(total_count), "Total Pairs Test");
   df->Endl();
 }
 
@@ -9962,12 +9997,14 @@ void cAnalyze::BatchRecalculate(cString cur_string)
     }
   }
   
-  cCPUTestInfo test_info;
-  if (use_manual_inputs)
-    test_info.UseManualInputs(manual_inputs);
-  else
-    test_info.UseRandomInputs(use_random_inputs); 
-  test_info.SetResourceOptions(use_resources, m_resources, update, m_resource_time_spent_offset);
+  cRecalcJob::sSettings settings;
+  settings.use_manual_inputs = use_manual_inputs;
+  settings.manual_inputs = manual_inputs;
+  settings.use_random_inputs = use_random_inputs;
+  settings.res_method = use_resources;
+  settings.res = m_resources;
+  settings.update = update;
+  settings.cpu_cycle_offset = m_resource_time_spent_offset;
 
   if (m_world->GetVerbosity() >= VERBOSE_ON) {
     msg.Set("Running batch %d through test CPUs...", cur_batch);
@@ -9982,19 +10019,7 @@ void cAnalyze::BatchRecalculate(cString cur_string)
     cerr << "warning: " << msg << endl;
   }
   
-  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * genotype = NULL;
-  cAnalyzeGenotype * last_genotype = NULL;
-  while ((genotype = batch_it.Next()) != NULL) {    
-    // If the previous genotype was the parent of this one, pass in a pointer
-    // to it for improved recalculate (such as distance to parent, etc.)
-    if (last_genotype != NULL && genotype->GetParentID() == last_genotype->GetID()) {
-      genotype->Recalculate(m_ctx, &test_info, last_genotype);
-    } else {
-      genotype->Recalculate(m_ctx, &test_info);
-    }
-    last_genotype = genotype;
-  }
+  cRecalcJob::RecalculateList(m_jobqueue, batch[cur_batch].List(), settings);
     
   return;
 }
@@ -10055,12 +10080,15 @@ void cAnalyze::BatchRecalculateWithArgs(cString cur_string)
   if (use_manual_inputs)
     use_random_inputs = false;
   
-  cCPUTestInfo test_info;
-  if (use_manual_inputs)
-    test_info.UseManualInputs(manual_inputs);
-  else
-    test_info.UseRandomInputs(use_random_inputs); 
-  test_info.SetResourceOptions(use_resources, m_resources, update, m_resource_time_spent_offset);
+  cRecalcJob::sSettings settings;
+  settings.use_manual_inputs = use_manual_inputs;
+  settings.manual_inputs = manual_inputs;
+  settings.use_random_inputs = use_random_inputs;
+  settings.res_method = use_resources;
+  settings.res = m_resources;
+  settings.update = update;
+  settings.cpu_cycle_offset = m_resource_time_spent_offset;
+  settings.num_trials = num_trials;
   
   // Notifications
   if (m_world->GetVerbosity() >= VERBOSE_ON) {
@@ -10075,19 +10103,7 @@ void cAnalyze::BatchRecalculateWithArgs(cString cur_string)
     cerr << "warning: " << msg << endl;
   }
   
-  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * genotype = NULL;
-  cAnalyzeGenotype * last_genotype = NULL;
-  while ((genotype = batch_it.Next()) != NULL) {    
-    // If the previous genotype was the parent of this one, pass in a pointer
-    // to it for improved recalculate (such as distance to parent, etc.)
-    if (last_genotype != NULL && genotype->GetParentID() == last_genotype->GetID()) {
-      genotype->Recalculate(m_ctx, &test_info, last_genotype, num_trials);
-    } else {
-      genotype->Recalculate(m_ctx, &test_info, NULL, num_trials);
-    }
-    last_genotype = genotype;
-  }
+  cRecalcJob::RecalculateList(m_jobqueue, batch[cur_batch].List(), settings);
   
   return;
 }
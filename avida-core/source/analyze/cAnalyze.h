@@ -193,6 +193,7 @@ private:
   void CommandDetail_Body(std::ostream& fp, int format_type,
                           tListIterator< tDataEntryCommand<cAnalyzeGenotype> > & output_it,
                           int time_step = -1, int max_time = 1);
+  void CommandDetail_Precalc(tListIterator< tDataEntryCommand<cAnalyzeGenotype> >& output_it);
   void CommandDetailAverage_Body(std::ostream& fp, int num_arguments,
                                  tListIterator< tDataEntryCommand<cAnalyzeGenotype> >& output_it);
   void CommandHistogram_Header(std::ostream& fp, int format_type,
@@ -246,6 +246,17 @@ dcm->Add(KEYWORD, new tDataEntryOfType<cAnalyzeGenotype, TYPE>
   ADD_GDATA(double (),         "complexity",   "Basic Complexity (beneficial muts are neutral)", GetComplexity, SetNULL, 0, 0, 0);
   ADD_GDATA(double (),         "land_fitness", "Average Lanscape Fitness",      GetLandscapeFitness, SetNULL,     0, 0, 0);
   
+  ADD_GDATA(int (),            "ko_dead",      "Knockouts Lethal",              GetKO_DeadCount,   SetNULL,       0, 0, 0);
+  ADD_GDATA(int (),            "ko_neg",       "Knockouts Detrimental",         GetKO_NegCount,    SetNULL,       0, 0, 0);
+  ADD_GDATA(int (),            "ko_neut",      "Knockouts Neutral",             GetKO_NeutCount,   SetNULL,       0, 0, 0);
+  ADD_GDATA(int (),            "ko_pos",       "Knockouts Beneficial",          GetKO_PosCount,    SetNULL,       0, 0, 0);
+  ADD_GDATA(int (),            "ko_complexity","Knockout Complexity",           GetKO_Complexity,  SetNULL,       0, 0, 0);
+  ADD_GDATA(int (),            "ko_pair_dead", "Pair Knockouts Lethal",         GetKOPair_DeadCount, SetNULL,     0, 0, 0);
+  ADD_GDATA(int (),            "ko_pair_neg",  "Pair Knockouts Detrimental",    GetKOPair_NegCount,  SetNULL,     0, 0, 0);
+  ADD_GDATA(int (),            "ko_pair_neut", "Pair Knockouts Neutral",        GetKOPair_NeutCount, SetNULL,     0, 0, 0);
+  ADD_GDATA(int (),            "ko_pair_pos",  "Pair Knockouts Beneficial",     GetKOPair_PosCount,  SetNULL,     0, 0, 0);
+  ADD_GDATA(int (),            "ko_pair_complexity", "Pair Knockout Complexity", GetKOPair_Complexity, SetNULL, 0, 0, 0);
+  
   ADD_GDATA(int(),             "mating_type", "Mating type (-1 = juvenile; 0 = female; 1 = male)", GetMatingType, SetMatingType, 0, 0, 0);
   ADD_GDATA(int(),             "mate_preference", "Mate preference", GetMatePreference, SetMatePreference, 0, 0, 0);
   ADD_GDATA(int(),             "mating_display_a", "Mating display A", GetMatingDisplayA, SetMatingDisplayA, 0, 0, 0);
@@ -361,6 +372,11 @@ int cAnalyzeGenotype::CalcMaxGestation() const
 }
 
 void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
+{
+  CalcKnockouts(m_world->GetDefaultContext(), check_pairs, check_chart);
+}
+
+void cAnalyzeGenotype::CalcKnockouts(cAvidaContext& ctx, bool check_pairs, bool check_chart) const
 {
   if (knockout_stats == NULL) {
     // We've never called this before -- setup the stats.
@@ -379,9 +395,7 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
     return;
   }
   
-  cAvidaContext& ctx = m_world->GetDefaultContext();
-  
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   
   // Calculate the base fitness for the genotype we're working with...
   // (This may not have been run already, and cost negligiably more time
@@ -394,7 +408,6 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   // If the base fitness is 0, the organism is dead and has no complexity.
   if (base_fitness == 0.0) {
     knockout_stats->neut_count = length;
-    delete testcpu;
     return;
   }
   
@@ -451,10 +464,7 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   
   // Only continue from here if we are looking at all pairs of knockouts
   // as well.
-  if (check_pairs == false) {
-    delete testcpu;
-    return;
-  }
+  if (check_pairs == false) return;
   
   Apto::Array<int> ko_pair_effect(ko_effect);
   for (int line1 = 0; line1 < length; line1++) {
@@ -522,7 +532,6 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   }
   
   knockout_stats->has_pair_info = true;
-  delete testcpu;
 }
 
 void cAnalyzeGenotype::CheckLand() const
@@ -536,18 +545,28 @@ void cAnalyzeGenotype::CheckLand() const
 }
 
 void cAnalyzeGenotype::CheckPhenPlast() const
+{
+  CheckPhenPlast(m_world->GetDefaultContext());
+}
+
+void cAnalyzeGenotype::CheckPhenPlast(cAvidaContext& ctx) const
 {
   // Implicit genotype recalculation if required
   if (m_phenplast_stats == NULL) {
     cCPUTestInfo test_info;
     
-    cPhenPlastGenotype pp(m_genome, 1000, test_info, m_world, m_world->GetDefaultContext());
+    cPhenPlastGenotype pp(m_genome, 1000, test_info, m_world, ctx);
     m_phenplast_stats = new cPhenPlastSummary(pp);
   }
 }
 
 
 
+void cAnalyzeGenotype::CalcPhenPlast(cAvidaContext& ctx)
+{
+  CheckPhenPlast(ctx);
+}
+
 void cAnalyzeGenotype::CalcLandscape(cAvidaContext& ctx)
 {
   if (m_land == NULL) m_land = new cLandscape(m_world, m_genome);
@@ -599,25 +618,7 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
 
   
   // Setup a new parent stats if we have a parent to work with.
-  if (parent_genotype != NULL) {
-    fitness_ratio = GetFitness() / parent_genotype->GetFitness();
-    efficiency_ratio = GetEfficiency() / parent_genotype->GetEfficiency();
-    comp_merit_ratio = GetCompMerit() / parent_genotype->GetCompMerit();
-    ConstInstructionSequencePtr seq_p;
-    GeneticRepresentationPtr rep_p = m_genome.Representation();
-    seq_p.DynamicCastFrom(rep_p);
-    const InstructionSequence& seq = *seq_p;
-    
-    const Genome& parent_genome = parent_genotype->GetGenome();
-    ConstInstructionSequencePtr parent_seq_p;
-    ConstGeneticRepresentationPtr parent_rep_p = parent_genome.Representation();
-    parent_seq_p.DynamicCastFrom(parent_rep_p);
-    const InstructionSequence& parent_seq = *parent_seq_p;
-    
-    parent_dist = cStringUtil::EditDistance((const char *)seq.AsString(), (const char *)parent_seq.AsString(), parent_muts);
-    
-    ancestor_dist = parent_genotype->GetAncestorDist() + parent_dist;
-  }
+  if (parent_genotype != NULL) CalcParentStats(parent_genotype);
   
   // Summarize plasticity information if multiple recalculations performed
   if (num_trials > 1){
@@ -629,6 +630,27 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
   delete local_test_info;
 }
 
+void cAnalyzeGenotype::CalcParentStats(const cAnalyzeGenotype* parent_genotype)
+{
+  fitness_ratio = GetFitness() / parent_genotype->GetFitness();
+  efficiency_ratio = GetEfficiency() / parent_genotype->GetEfficiency();
+  comp_merit_ratio = GetCompMerit() / parent_genotype->GetCompMerit();
+  ConstInstructionSequencePtr seq_p;
+  GeneticRepresentationPtr rep_p = m_genome.Representation();
+  seq_p.DynamicCastFrom(rep_p);
+  const InstructionSequence& seq = *seq_p;
+  
+  const Genome& parent_genome = parent_genotype->GetGenome();
+  ConstInstructionSequencePtr parent_seq_p;
+  ConstGeneticRepresentationPtr parent_rep_p = parent_genome.Representation();
+  parent_seq_p.DynamicCastFrom(parent_rep_p);
+  const InstructionSequence& parent_seq = *parent_seq_p;
+  
+  parent_dist = cStringUtil::EditDistance((const char *)seq.AsString(), (const char *)parent_seq.AsString(), parent_muts);
+  
+  ancestor_dist = parent_genotype->GetAncestorDist() + parent_dist;
+}
+
 
 void cAnalyzeGenotype::PrintTasks(ofstream& fp, int min_task, int max_task)
 {
@@ -742,6 +764,11 @@ cString cAnalyzeGenotype::DescInstExe(int _inst_id) const
   return desc;
 }
 
+bool cAnalyzeGenotype::HasKnockouts(bool check_pairs) const
+{
+  return (knockout_stats != NULL && (check_pairs == false || knockout_stats->has_pair_info == true));
+}
+
 int cAnalyzeGenotype::GetKO_DeadCount() const
 {
   CalcKnockouts(false);  // Make sure knockouts are calculated
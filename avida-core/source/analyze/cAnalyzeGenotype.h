@@ -207,8 +207,10 @@ private:
 
   int CalcMaxGestation() const;
   void CalcKnockouts(bool check_pairs = false, bool check_chart = false) const;
+  void CalcKnockouts(cAvidaContext& ctx, bool check_pairs, bool check_chart) const;
   void CheckLand() const;
   void CheckPhenPlast() const;
+  void CheckPhenPlast(cAvidaContext& ctx) const;
   void SummarizePhenotypicPlasticity(const cPhenPlastGenotype& pp) const;
   
   static tDataCommandManager<cAnalyzeGenotype>* buildDataCommandManager();
@@ -232,11 +234,18 @@ public:
   void SetCPUTestInfo(cCPUTestInfo& in_cpu_test_info) { m_cpu_test_info = in_cpu_test_info; }
   
   void Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info = NULL, cAnalyzeGenotype* parent_genotype = NULL, int num_trials = 1);
+  void CalcParentStats(const cAnalyzeGenotype* parent_genotype);
   void PrintTasks(std::ofstream& fp, int min_task = 0, int max_task = -1);
   void PrintTasksQuality(std::ofstream& fp, int min_task = 0, int max_task = -1);
   void PrintInternalTasks(std::ofstream& fp, int min_task = 0, int max_task = -1);
   void PrintInternalTasksQuality(std::ofstream& fp, int min_task = 0, int max_task = -1);
   void CalcLandscape(cAvidaContext& ctx);
+  void CalcPhenPlast(cAvidaContext& ctx);
+  void CalcSingleKnockouts(cAvidaContext& ctx) { CalcKnockouts(ctx, false, false); }
+  void CalcPairKnockouts(cAvidaContext& ctx) { CalcKnockouts(ctx, true, false); }
+  bool HasLandscape() const { return (m_land != NULL); }
+  bool HasPhenPlast() const { return (m_phenplast_stats != NULL); }
+  bool HasKnockouts(bool check_pairs) const;
 
   // Set...
   void SetInstSet(const cString& inst_set);
@@ -28,13 +28,18 @@ class cAnalyzeJob
 {
 private:
   int m_id;
+  int m_seed;
+  bool m_seeded;
   
 public:
-  cAnalyzeJob() : m_id(0) { ; }
+  cAnalyzeJob() : m_id(0), m_seed(0), m_seeded(false) { ; }
   virtual ~cAnalyzeJob() { ; }
   
   void SetID(int newid) { m_id = newid; }
   int GetID() { return m_id; }
+  void SetSeed(int seed) { m_seed = seed; m_seeded = true; }
+  int GetSeed() { return m_seed; }
+  bool HasSeed() const { return m_seeded; }
   
   virtual void Run(cAvidaContext& ctx) = 0;
 };
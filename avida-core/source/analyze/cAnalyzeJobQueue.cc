@@ -38,7 +38,8 @@ using namespace Avida;
 
 
 cAnalyzeJobQueue::cAnalyzeJobQueue(cWorld* world)
-: m_world(world), m_last_jobid(0), m_jobs(0), m_pending(0), m_workers(Apto::Platform::AvailableCPUs())
+: m_world(world), m_last_jobid(0), m_jobs(0), m_generation(0), m_terminate(false)
+, m_workers(Apto::Platform::AvailableCPUs())
 {
   const int max_workers = world->GetConfig().MAX_CONCURRENCY.Get();
   if (max_workers > 0 && max_workers < m_workers.GetSize()) m_workers.Resize(max_workers);
@@ -46,8 +47,10 @@ cAnalyzeJobQueue::cAnalyzeJobQueue(cWorld* world)
   m_job_seed_rng = new Apto::RNG::AvidaRNG(world->GetRandom().GetInt(world->GetRandom().MaxSeed()));
   
   if (m_workers.GetSize() > 1) {
+    m_deques.Resize(m_workers.GetSize());
+    for (int i = 0; i < m_deques.GetSize(); i++) m_deques[i] = new sDeque;
     for (int i = 0; i < m_workers.GetSize(); i++) {
-      m_workers[i] = new cAnalyzeJobWorker(this);
+      m_workers[i] = new cAnalyzeJobWorker(this, i);
       m_workers[i]->Start();
     }
   } else {
@@ -57,52 +60,131 @@ cAnalyzeJobQueue::cAnalyzeJobQueue(cWorld* world)
 
 cAnalyzeJobQueue::~cAnalyzeJobQueue()
 {
-  const int num_workers = m_workers.GetSize();
-  
+  // Signal all workers to terminate
   m_mutex.Lock();
-  
-  // Clean out any waiting jobs
-  cAnalyzeJob* job;
-  while ((job = m_queue.Pop())) delete job;
-  
-  // Set job count so that all workers receive NULL jobs
-  m_jobs = num_workers;
-  
+  m_terminate = true;
   m_mutex.Unlock();
-  
-  // Signal all workers to check job queue
   m_cond.Broadcast();
   
-  for (int i = 0; i < num_workers; i++) {
+  for (int i = 0; i < m_workers.GetSize(); i++) {
     m_workers[i]->Join();
     delete m_workers[i];
   }
   
+  // Clean out any waiting jobs
+  for (int i = 0; i < m_deques.GetSize(); i++) {
+    cAnalyzeJob* job;
+    while ((job = m_deques[i]->jobs.Pop())) delete job;
+    delete m_deques[i];
+  }
+  
   delete m_job_seed_rng;
 }
 
 inline void cAnalyzeJobQueue::queueJob(cAnalyzeJob* job)
 {
-  if (m_workers.GetSize()) m_queue.PushRear(job);
-  else singleThreadedJobExecution(job);
+  job->SetID(m_last_jobid++);
+  // Seeds are drawn in job id order, so each job sees the same random stream no matter which worker runs it.  Jobs
+  // seeded by whoever added them (see ParallelFor) keep their seed and do not draw one, so they cannot shift the
+  // seeds of the jobs that follow.
+  if (!job->HasSeed()) job->SetSeed(nextJobSeed());
+  
+  sDeque& deque = *m_deques[job->GetID() % m_deques.GetSize()];
+  deque.mutex.Lock();
+  deque.jobs.PushRear(job);
+  deque.mutex.Unlock();
+  m_jobs++;
 }
 
 void cAnalyzeJobQueue::AddJob(cAnalyzeJob* job)
 {
+  // Without workers the job runs in place, outside of any lock so that it may add further jobs itself
+  if (!m_workers.GetSize()) {
+    m_mutex.Lock();
+    job->SetID(m_last_jobid++);
+    if (!job->HasSeed()) job->SetSeed(nextJobSeed());
+    m_mutex.Unlock();
+    singleThreadedJobExecution(job);
+    return;
+  }
+  
   Apto::MutexAutoLock lock(m_mutex);
-  job->SetID(m_last_jobid++);
   queueJob(job);
-  m_jobs++;
+  m_generation++;
 }
 
 void cAnalyzeJobQueue::AddJobImmediate(cAnalyzeJob* job)
 {
+  AddJob(job);
+  if (m_workers.GetSize()) m_cond.Signal();
+}
+
+void cAnalyzeJobQueue::AddJobs(const Apto::Array<cAnalyzeJob*>& jobs)
+{
+  if (!m_workers.GetSize()) {
+    for (int i = 0; i < jobs.GetSize(); i++) AddJob(jobs[i]);
+    return;
+  }
+  
   m_mutex.Lock();
-  job->SetID(m_last_jobid++);
-  queueJob(job);
-  m_jobs++;
+  for (int i = 0; i < jobs.GetSize(); i++) queueJob(jobs[i]);
+  m_generation++;
   m_mutex.Unlock(); // should unlock prior to signaling condition variable
-  m_cond.Signal();
+  m_cond.Broadcast();
+}
+
+
+cAnalyzeJob* cAnalyzeJobQueue::takeJob(int worker_id)
+{
+  const int num_deques = m_deques.GetSize();
+  
+  // Take from the front of this worker's own deque first...
+  int first_victim = 0;
+  if (worker_id >= 0) {
+    sDeque& own = *m_deques[worker_id];
+    Apto::MutexAutoLock lock(own.mutex);
+    if (own.jobs.GetSize()) return own.jobs.Pop();
+    first_victim = 1;
+  } else {
+    worker_id = 0;
+  }
+  
+  // ...then steal from the back of the other deques
+  for (int i = first_victim; i < num_deques; i++) {
+    sDeque& victim = *m_deques[(worker_id + i) % num_deques];
+    Apto::MutexAutoLock lock(victim.mutex);
+    if (victim.jobs.GetSize()) return victim.jobs.PopRear();
+  }
+  
+  return NULL;
+}
+
+void cAnalyzeJobQueue::completeJobs(int count)
+{
+  if (!count) return;
+  
+  m_mutex.Lock();
+  m_jobs -= count;
+  const bool done = (m_jobs == 0);
+  m_mutex.Unlock();
+  if (done) m_term_cond.Broadcast();
+}
+
+bool cAnalyzeJobQueue::RunQueuedJob()
+{
+  if (!m_workers.GetSize()) return false;
+  
+  cAnalyzeJob* job = takeJob(-1);
+  if (!job) return false;
+  
+  Apto::RNG::AvidaRNG rng(job->GetSeed());
+  cAvidaContext ctx(&m_world->GetDriver(), rng);
+  ctx.SetAnalyzeMode();
+  job->Run(ctx);
+  delete job;
+  
+  completeJobs(1);
+  return true;
 }
 
 
@@ -124,7 +206,7 @@ void cAnalyzeJobQueue::Execute()
   
   // Wait for term signal
   m_mutex.Lock();
-  while (m_jobs > 0 || m_pending > 0) {
+  while (m_jobs > 0) {
     m_term_cond.Wait(m_mutex);
   }
   m_mutex.Unlock();
@@ -135,9 +217,9 @@ void cAnalyzeJobQueue::Execute()
 
 void cAnalyzeJobQueue::singleThreadedJobExecution(cAnalyzeJob* job)
 {
-  Apto::RNG::AvidaRNG rng(GetSeedForJob(job->GetID()));
+  Apto::RNG::AvidaRNG rng(job->GetSeed());
   cAvidaContext ctx(&m_world->GetDriver(), rng);
+  ctx.SetAnalyzeMode();
   job->Run(ctx);
   delete job;
 }
-
@@ -39,27 +39,51 @@ class cWorld;
 const int MT_RANDOM_INDEX_MASK = 0x7F;
 
 
+// cAnalyzeJobQueue - Runs analyze jobs on a pool of worker threads
+//
+// Each worker owns a deque of jobs.  Added jobs are dealt out to the deques in job id order; a worker takes jobs from
+// the front of its own deque and, once that is empty, steals from the back of the other workers' deques.  Deques are
+// locked individually, so workers only contend on the queue-wide lock when they run out of work, and when jobs are
+// added (job ids and seeds are handed out in order, so results do not depend on which worker runs which job).
+//
+// Jobs added from within a running job would draw their seeds in whatever order the running jobs happen to reach
+// that point, so such jobs should be seeded by the code adding them (ParallelFor does so when given a context).
+// Jobs that already have a seed when added keep it.
+//
+// Threads waiting on a batch of jobs (see tAnalyzeJobBatch and ParallelFor) run queued jobs themselves rather than
+// block, so jobs may safely wait on jobs of their own.  Without worker threads, jobs are run as soon as they are added.
+
 class cAnalyzeJobQueue
 {
   friend class cAnalyzeJobWorker;
   
 private:
+  struct sDeque
+  {
+    Apto::Mutex mutex;
+    tList<cAnalyzeJob> jobs;
+  };
+  
   cWorld* m_world;
-  tList<cAnalyzeJob> m_queue;
+  Apto::Array<sDeque*> m_deques;  // one per worker
   int m_last_jobid;
   Apto::Random* m_job_seed_rng;
   Apto::Mutex m_mutex;
   Apto::ConditionVariable m_cond;
   Apto::ConditionVariable m_term_cond;
   
-  volatile int m_jobs;      // count of waiting jobs, used in condition variable constructs
-  volatile int m_pending;   // count of currently executing jobs
+  volatile int m_jobs;        // count of jobs added but not yet reported complete
+  volatile int m_generation;  // incremented whenever jobs are added, idle workers wait for it to change
+  volatile bool m_terminate;
   
   Apto::Array<cAnalyzeJobWorker*> m_workers;
 
 
   void singleThreadedJobExecution(cAnalyzeJob* job);
   inline void queueJob(cAnalyzeJob* job);
+  inline int nextJobSeed() { return m_job_seed_rng->GetInt(m_job_seed_rng->MaxSeed()); }
+  cAnalyzeJob* takeJob(int worker_id);
+  void completeJobs(int count);
 
   
   cAnalyzeJobQueue(); // @not_implemented
@@ -71,13 +95,18 @@ public:
   cAnalyzeJobQueue(cWorld* world);
   ~cAnalyzeJobQueue();
 
+  int GetNumWorkers() const { return m_workers.GetSize(); }
+  
   void AddJob(cAnalyzeJob* job);
   void AddJobImmediate(cAnalyzeJob* job);
+  //! Add a batch of jobs under a single lock, waking the workers once they are all queued.
+  void AddJobs(const Apto::Array<cAnalyzeJob*>& jobs);
+  
+  //! Run one queued job on the calling thread.  Returns false if no job was waiting.
+  bool RunQueuedJob();
 
   void Start();
   void Execute();
-  
-  int GetSeedForJob(int jobid) { Apto::MutexAutoLock lock(m_mutex); return m_job_seed_rng->GetInt(m_job_seed_rng->MaxSeed()); }
 };
 
 #endif
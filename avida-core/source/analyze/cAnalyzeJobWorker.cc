@@ -32,34 +32,37 @@ void cAnalyzeJobWorker::Run()
   cAvidaContext ctx(&m_queue->m_world->GetDriver(), rng);
   ctx.SetAnalyzeMode();
   
-  cAnalyzeJob* job = NULL;
+  int completed = 0;  // jobs completed since last reported to the queue
   
   while (1) {
-    m_queue->m_mutex.Lock();
-    while (m_queue->m_jobs == 0) {
-      m_queue->m_cond.Wait(m_queue->m_mutex);
-    }
-    job = m_queue->m_queue.Pop();
-    m_queue->m_jobs--;
-    m_queue->m_pending++; 
-    m_queue->m_mutex.Unlock();
+    cAnalyzeJob* job = m_queue->takeJob(m_id);
     
-    if (job) {
-      // Set RNG from the waiting pool and execute the job
-      rng.ResetSeed(m_queue->GetSeedForJob(job->GetID()));
-      job->Run(ctx);
-      delete job;
-      m_queue->m_mutex.Lock();
-      int pending = --m_queue->m_pending;
-      m_queue->m_mutex.Unlock();
-      if (!pending) m_queue->m_term_cond.Signal();
-    } else {
-      // Terminate worker on NULL job receipt
+    if (!job) {
+      // Out of work, report completed jobs.  The generation is noted before looking once more, so that any job added
+      // after that look is seen as a generation change rather than missed while waiting.
+      m_queue->completeJobs(completed);
+      completed = 0;
+      
       m_queue->m_mutex.Lock();
-      int pending = --m_queue->m_pending;
+      int generation = m_queue->m_generation;
       m_queue->m_mutex.Unlock();
-      if (!pending) m_queue->m_term_cond.Signal();
-      break;
+      
+      job = m_queue->takeJob(m_id);
+      if (!job) {
+        m_queue->m_mutex.Lock();
+        while (generation == m_queue->m_generation && !m_queue->m_terminate) m_queue->m_cond.Wait(m_queue->m_mutex);
+        bool terminate = m_queue->m_terminate;
+        m_queue->m_mutex.Unlock();
+        
+        if (terminate) break;
+        continue;
+      }
     }
+    
+    // Set RNG from the waiting pool and execute the job
+    rng.ResetSeed(job->GetSeed());
+    job->Run(ctx);
+    delete job;
+    completed++;
   }
 }
@@ -0,0 +1,183 @@
+/*
+ *  cGenotypeDistanceStats.cc
+ *  Avida
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cGenotypeDistanceStats.h"
+
+#include "cAnalyzeGenotype.h"
+#include "cAnalyzeJobQueue.h"
+#include "tAnalyzeJobBatch.h"
+
+
+cGenotypeDistanceStats::cGenotypeDistanceStats(eDistance distance, int threshold)
+  : m_distance(distance), m_threshold(threshold), m_within(false)
+{
+  clearStats(m_stats);
+}
+
+
+void cGenotypeDistanceStats::Calculate(cAnalyzeJobQueue& queue, tList<cAnalyzeGenotype>& batch)
+{
+  calcWithin(queue, batch);
+  clearRows();
+}
+
+
+void cGenotypeDistanceStats::Calculate(cAnalyzeJobQueue& queue, tList<cAnalyzeGenotype>& batch1,
+                                       tList<cAnalyzeGenotype>& batch2)
+{
+  if (&batch1 == &batch2) {
+    // Every pair of distinct genotypes occurs in both orders, and each genotype is also paired with itself
+    calcWithin(queue, batch1);
+    m_stats.dist_total *= 2.0;
+    m_stats.pair_count *= 2.0;
+    m_stats.threshold_pair_count *= 2.0;
+    for (int row = 0; row < m_rows.GetSize(); row++) {
+      const int count = m_rows[row]->GetNumCPUs();
+      const double num_pairs = (count - 1) * (count - 1);
+      m_stats.pair_count += num_pairs;
+      if (0 >= m_threshold) m_stats.threshold_pair_count += num_pairs;
+    }
+    clearRows();
+    return;
+  }
+
+  collectGenotypes(batch1, m_rows, m_row_seqs);
+  collectGenotypes(batch2, m_cols, m_col_seqs);
+  m_within = false;
+  m_row_stats.Resize(m_rows.GetSize());
+
+  ParallelFor(queue, this, &cGenotypeDistanceStats::calcRowJob, 0, m_rows.GetSize());
+  combineRows();
+  clearRows();
+}
+
+
+void cGenotypeDistanceStats::calcWithin(cAnalyzeJobQueue& queue, tList<cAnalyzeGenotype>& batch)
+{
+  collectGenotypes(batch, m_rows, m_row_seqs);
+  m_cols = m_rows;
+  m_col_seqs = m_row_seqs;
+  m_within = true;
+  m_row_stats.Resize(m_rows.GetSize());
+
+  // Job i handles rows i and n - 1 - i, which together hold n - 1 pairs above the diagonal
+  ParallelFor(queue, this, &cGenotypeDistanceStats::calcRowJob, 0, (m_rows.GetSize() + 1) / 2);
+  combineRows();
+}
+
+
+void cGenotypeDistanceStats::collectGenotypes(tList<cAnalyzeGenotype>& batch, Apto::Array<cAnalyzeGenotype*>& genotypes,
+                                              Apto::Array<ConstInstructionSequencePtr>& seqs)
+{
+  genotypes.Resize(0);
+  seqs.Resize(0);
+
+  tListIterator<cAnalyzeGenotype> batch_it(batch);
+  cAnalyzeGenotype* genotype = NULL;
+  while ((genotype = batch_it.Next()) != NULL) {
+    ConstInstructionSequencePtr seq_p;
+    ConstGeneticRepresentationPtr rep_p = genotype->GetGenome().Representation();
+    seq_p.DynamicCastFrom(rep_p);
+    genotypes.Push(genotype);
+    seqs.Push(seq_p);
+  }
+}
+
+
+void cGenotypeDistanceStats::clearStats(sStats& stats)
+{
+  stats.dist_total = 0.0;
+  stats.pair_count = 0.0;
+  stats.threshold_pair_count = 0.0;
+  stats.dist_max = 0;
+}
+
+
+int cGenotypeDistanceStats::distance(const InstructionSequence& seq1, const InstructionSequence& seq2) const
+{
+  switch (m_distance) {
+    case DIST_HAMMING: return InstructionSequence::FindHammingDistance(seq1, seq2);
+    case DIST_SLIDING: return InstructionSequence::FindSlidingDistance(seq1, seq2);
+    case DIST_EDIT: return InstructionSequence::FindEditDistance(seq1, seq2);
+  }
+  return 0;
+}
+
+
+void cGenotypeDistanceStats::calcRow(int row)
+{
+  sStats& stats = m_row_stats[row];
+  clearStats(stats);
+
+  cAnalyzeGenotype* genotype1 = m_rows[row];
+  const InstructionSequence& seq1 = *m_row_seqs[row];
+  const int count1 = genotype1->GetNumCPUs();
+
+  for (int col = (m_within) ? row + 1 : 0; col < m_cols.GetSize(); col++) {
+    cAnalyzeGenotype* genotype2 = m_cols[col];
+    const int count2 = genotype2->GetNumCPUs();
+    const double num_pairs = (genotype1 == genotype2) ? ((count1 - 1) * (count2 - 1)) : (count1 * count2);
+
+    // Pairs between batches that stand for no organisms are skipped entirely
+    if (!m_within && num_pairs == 0) continue;
+
+    const int dist = distance(seq1, *m_col_seqs[col]);
+    stats.dist_total += dist * num_pairs;
+    stats.pair_count += num_pairs;
+    if (dist >= m_threshold) stats.threshold_pair_count += num_pairs;
+    if (dist > stats.dist_max) stats.dist_max = dist;
+  }
+}
+
+
+void cGenotypeDistanceStats::calcRowJob(cAvidaContext&, int job_id)
+{
+  calcRow(job_id);
+
+  if (m_within) {
+    const int mirror_row = m_rows.GetSize() - 1 - job_id;
+    if (mirror_row != job_id) calcRow(mirror_row);
+  }
+}
+
+
+void cGenotypeDistanceStats::combineRows()
+{
+  clearStats(m_stats);
+  for (int row = 0; row < m_row_stats.GetSize(); row++) {
+    const sStats& stats = m_row_stats[row];
+    m_stats.dist_total += stats.dist_total;
+    m_stats.pair_count += stats.pair_count;
+    m_stats.threshold_pair_count += stats.threshold_pair_count;
+    if (stats.dist_max > m_stats.dist_max) m_stats.dist_max = stats.dist_max;
+  }
+}
+
+
+void cGenotypeDistanceStats::clearRows()
+{
+  // Only the summaries are kept, the genotypes may change once the calculation is done
+  m_rows.Resize(0);
+  m_cols.Resize(0);
+  m_row_seqs.Resize(0);
+  m_col_seqs.Resize(0);
+  m_row_stats.Resize(0);
+}
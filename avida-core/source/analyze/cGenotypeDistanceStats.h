@@ -0,0 +1,107 @@
+/*
+ *  cGenotypeDistanceStats.h
+ *  Avida
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cGenotypeDistanceStats_h
+#define cGenotypeDistanceStats_h
+
+#include "avida/core/InstructionSequence.h"
+
+#include "apto/core.h"
+
+#include "tList.h"
+
+#include <climits>
+
+class cAnalyzeGenotype;
+class cAnalyzeJobQueue;
+class cAvidaContext;
+
+using namespace Avida;
+
+
+// cGenotypeDistanceStats - Organism weighted genetic distance statistics over pairs of genotypes
+//
+// Each pair of genotypes stands for the pairs of organisms drawn from them, weighted by the product of their organism
+// counts (one less each when a genotype is paired with itself).  Rows of pairs are spread across the analyze job
+// queue.  Every job summarizes its rows as it goes, and the row summaries are combined in row order once all jobs are
+// done, so no distances are stored and the results do not depend on the number of threads.
+//
+// Within a single batch only the pairs of distinct genotypes above the diagonal are calculated, even when the batch is
+// paired with itself.  Each job takes one row from either end of the batch, so all jobs hold similar numbers of pairs.
+
+class cGenotypeDistanceStats
+{
+public:
+  enum eDistance { DIST_HAMMING, DIST_SLIDING, DIST_EDIT };
+
+private:
+  struct sStats
+  {
+    double dist_total;            // sum of distance times organism pairs
+    double pair_count;            // organism pairs
+    double threshold_pair_count;  // organism pairs at or beyond the threshold distance
+    int dist_max;
+  };
+
+  eDistance m_distance;
+  int m_threshold;
+  bool m_within;
+
+  Apto::Array<cAnalyzeGenotype*> m_rows;
+  Apto::Array<cAnalyzeGenotype*> m_cols;
+  Apto::Array<ConstInstructionSequencePtr> m_row_seqs;
+  Apto::Array<ConstInstructionSequencePtr> m_col_seqs;
+
+  Apto::Array<sStats> m_row_stats;
+  sStats m_stats;
+
+
+  cGenotypeDistanceStats(); // @not_implemented
+  cGenotypeDistanceStats(const cGenotypeDistanceStats&); // @not_implemented
+  cGenotypeDistanceStats& operator=(const cGenotypeDistanceStats&); // @not_implemented
+
+public:
+  explicit cGenotypeDistanceStats(eDistance distance, int threshold = INT_MAX);
+
+  //! Calculate the statistics of all pairs of distinct genotypes in batch, each pair counted once.
+  void Calculate(cAnalyzeJobQueue& queue, tList<cAnalyzeGenotype>& batch);
+  //! Calculate the statistics of every genotype in batch1 paired with every genotype in batch2 (which may be batch1).
+  void Calculate(cAnalyzeJobQueue& queue, tList<cAnalyzeGenotype>& batch1, tList<cAnalyzeGenotype>& batch2);
+
+  double GetDistanceTotal() const { return m_stats.dist_total; }
+  double GetPairCount() const { return m_stats.pair_count; }
+  double GetThresholdPairCount() const { return m_stats.threshold_pair_count; }
+  int GetMaxDistance() const { return m_stats.dist_max; }
+
+private:
+  static void collectGenotypes(tList<cAnalyzeGenotype>& batch, Apto::Array<cAnalyzeGenotype*>& genotypes,
+                               Apto::Array<ConstInstructionSequencePtr>& seqs);
+  static void clearStats(sStats& stats);
+
+  int distance(const InstructionSequence& seq1, const InstructionSequence& seq2) const;
+  void calcRow(int row);
+  void calcRowJob(cAvidaContext& ctx, int job_id);
+  void calcWithin(cAnalyzeJobQueue& queue, tList<cAnalyzeGenotype>& batch);
+  void combineRows();
+  void clearRows();
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "cModularityAnalysis.h"
 
 #include "cAnalyzeGenotype.h"
+#include "cHardwareManager.h"
 #include "cOrganism.h"
 #include "cPhenotype.h"
 #include "tDataCommandManager.h"
@@ -53,7 +54,7 @@ void cModularityAnalysis::Initialize()
 
 void cModularityAnalysis::CalcFunctionalModularity(cAvidaContext& ctx)
 {
-  cTestCPU* testcpu = m_genotype->GetWorld()->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_genotype->GetWorld()->GetHardwareManager(), ctx);
   cCPUTestInfo test_info = m_test_info;
   
   const Genome& base_genome = m_genotype->GetGenome();
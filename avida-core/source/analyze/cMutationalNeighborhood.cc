@@ -34,15 +34,16 @@
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cWorld.h"
-#include "tAnalyzeJob.h"
+#include "tAnalyzeJobBatch.h"
 
 using namespace std;
 
 
 cMutationalNeighborhood::cMutationalNeighborhood(cWorld* world, const Genome& genome, int target)
-  : m_world(world), m_initialized(false)
+  : m_world(world)
   , m_inst_set(m_world->GetHardwareManager().GetInstSet(genome.Properties().Get("instset").StringValue()))
   , m_target(target), m_base_genome(genome)
+  , m_checkpoints(world->GetConfig().TEST_CPU_CHECKPOINT_INTERVAL.Get())
 {
   InstructionSequencePtr seq;
   seq.DynamicCastFrom(m_base_genome.Representation());
@@ -54,118 +55,111 @@ cMutationalNeighborhood::cMutationalNeighborhood(cWorld* world, const Genome& ge
 
 void cMutationalNeighborhood::Process(cAvidaContext& ctx)
 {
-  m_mutex.Lock();
-  if (m_initialized) {
-    int cur_site = m_cur_site++;
-    m_mutex.Unlock();
-
-    if (cur_site < m_base_genome_size) {
-      // Create test infrastructure
-      cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-      cCPUTestInfo test_info;
-      
-      // Setup One Step Data
-      sStep& opdata = m_onestep_point[cur_site];
-      opdata.peak_fitness = m_base_fitness;
-      opdata.peak_genome = m_base_genome;
-      opdata.site_count.Resize(m_base_genome_size, 0);
-
-      sStep& oidata = m_onestep_insert[cur_site];
-      oidata.peak_fitness = m_base_fitness;
-      oidata.peak_genome = m_base_genome;
-      oidata.site_count.Resize(m_base_genome_size + 1, 0);
-
-      sStep& oddata = m_onestep_delete[cur_site];
-      oddata.peak_fitness = m_base_fitness;
-      oddata.peak_genome = m_base_genome;
-      oddata.site_count.Resize(m_base_genome_size, 0);
-      
-      
-      // Setup Data Used in Two Step
-      sStep& tpdata = m_twostep_point[cur_site];
-      tpdata.peak_fitness = m_base_fitness;
-      tpdata.peak_genome = m_base_genome;
-      tpdata.site_count.Resize(m_base_genome_size, 0);
-
-      sStep& tidata = m_twostep_insert[cur_site];
-      tidata.peak_fitness = m_base_fitness;
-      tidata.peak_genome = m_base_genome;
-      tidata.site_count.Resize(m_base_genome_size + 2, 0);
-
-      sStep& tddata = m_twostep_delete[cur_site];
-      tddata.peak_fitness = m_base_fitness;
-      tddata.peak_genome = m_base_genome;
-      tddata.site_count.Resize(m_base_genome_size, 0);
+  ProcessInitialize(ctx);
+  
+  // Process every site in parallel on the job queue, each site accumulating into its own data
+  ParallelFor(m_world->GetAnalyze().GetJobQueue(), ctx, this, &cMutationalNeighborhood::ProcessSite, 0, m_base_genome_size);
+  
+  ProcessComplete(ctx);
+}
 
-      
-      sStep& tipdata = m_insert_point[cur_site];
-      tipdata.peak_fitness = m_base_fitness;
-      tipdata.peak_genome = m_base_genome;
-      tipdata.site_count.Resize(m_base_genome_size + 1, 0);
-      
-      sStep& tiddata = m_insert_delete[cur_site];
-      tiddata.peak_fitness = m_base_fitness;
-      tiddata.peak_genome = m_base_genome;
-      tiddata.site_count.Resize(m_base_genome_size + 1, 0);
-      
-      sStep& tdpdata = m_delete_point[cur_site];
-      tdpdata.peak_fitness = m_base_fitness;
-      tdpdata.peak_genome = m_base_genome;
-      tdpdata.site_count.Resize(m_base_genome_size, 0);
-      
-      
-      // Do the processing, starting with One Step
-      ProcessOneStepPoint(ctx, testcpu, test_info, cur_site);
-      ProcessOneStepInsert(ctx, testcpu, test_info, cur_site);
-      ProcessOneStepDelete(ctx, testcpu, test_info, cur_site);
-
-      // Process the hanging insertion on the first cycle through (to balance execution time)
-      if (cur_site == 0) {
-        cur_site = m_base_genome_size;
-        
-        sStep& oidata2 = m_onestep_insert[cur_site];
-        oidata2.peak_fitness = m_base_fitness;
-        oidata2.peak_genome = m_base_genome;
-        oidata2.site_count.Resize(m_base_genome_size + 1, 0);
-        
-        sStep& tidata2 = m_twostep_insert[cur_site];
-        tidata2.peak_fitness = m_base_fitness;
-        tidata2.peak_genome = m_base_genome;
-        tidata2.site_count.Resize(m_base_genome_size + 2, 0);
-        
-        sStep& tipdata2 = m_insert_point[cur_site];
-        tipdata2.peak_fitness = m_base_fitness;
-        tipdata2.peak_genome = m_base_genome;
-        tipdata2.site_count.Resize(m_base_genome_size + 1, 0);
-        
-        sStep& tiddata2 = m_insert_delete[cur_site];
-        tiddata2.peak_fitness = m_base_fitness;
-        tiddata2.peak_genome = m_base_genome;
-        tiddata2.site_count.Resize(m_base_genome_size + 1, 0);
-        
-        ProcessOneStepInsert(ctx, testcpu, test_info, cur_site); 
-      }
 
-      // Cleanup
-      delete testcpu;
-    }
-  } else {
-    ProcessInitialize(ctx);
-    return;
-  }
+void cMutationalNeighborhood::ProcessSite(cAvidaContext& ctx, int cur_site)
+{
+  // Create test infrastructure
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
+  cCPUTestInfo test_info;
   
-  m_mutex.Lock();
-  if (++m_completed == m_base_genome_size) ProcessComplete(ctx); 
-  m_mutex.Unlock();
+  // Setup One Step Data
+  sStep& opdata = m_onestep_point[cur_site];
+  opdata.peak_fitness = m_base_fitness;
+  opdata.peak_genome = m_base_genome;
+  opdata.site_count.Resize(m_base_genome_size, 0);
+
+  sStep& oidata = m_onestep_insert[cur_site];
+  oidata.peak_fitness = m_base_fitness;
+  oidata.peak_genome = m_base_genome;
+  oidata.site_count.Resize(m_base_genome_size + 1, 0);
+
+  sStep& oddata = m_onestep_delete[cur_site];
+  oddata.peak_fitness = m_base_fitness;
+  oddata.peak_genome = m_base_genome;
+  oddata.site_count.Resize(m_base_genome_size, 0);
+  
+  
+  // Setup Data Used in Two Step
+  sStep& tpdata = m_twostep_point[cur_site];
+  tpdata.peak_fitness = m_base_fitness;
+  tpdata.peak_genome = m_base_genome;
+  tpdata.site_count.Resize(m_base_genome_size, 0);
+
+  sStep& tidata = m_twostep_insert[cur_site];
+  tidata.peak_fitness = m_base_fitness;
+  tidata.peak_genome = m_base_genome;
+  tidata.site_count.Resize(m_base_genome_size + 2, 0);
+
+  sStep& tddata = m_twostep_delete[cur_site];
+  tddata.peak_fitness = m_base_fitness;
+  tddata.peak_genome = m_base_genome;
+  tddata.site_count.Resize(m_base_genome_size, 0);
+
+  
+  sStep& tipdata = m_insert_point[cur_site];
+  tipdata.peak_fitness = m_base_fitness;
+  tipdata.peak_genome = m_base_genome;
+  tipdata.site_count.Resize(m_base_genome_size + 1, 0);
+  
+  sStep& tiddata = m_insert_delete[cur_site];
+  tiddata.peak_fitness = m_base_fitness;
+  tiddata.peak_genome = m_base_genome;
+  tiddata.site_count.Resize(m_base_genome_size + 1, 0);
+  
+  sStep& tdpdata = m_delete_point[cur_site];
+  tdpdata.peak_fitness = m_base_fitness;
+  tdpdata.peak_genome = m_base_genome;
+  tdpdata.site_count.Resize(m_base_genome_size, 0);
+  
+  
+  // Do the processing, starting with One Step
+  ProcessOneStepPoint(ctx, testcpu.Get(), test_info, cur_site);
+  ProcessOneStepInsert(ctx, testcpu.Get(), test_info, cur_site);
+  ProcessOneStepDelete(ctx, testcpu.Get(), test_info, cur_site);
+
+  // Process the hanging insertion on the first cycle through (to balance execution time)
+  if (cur_site == 0) {
+    cur_site = m_base_genome_size;
+    
+    sStep& oidata2 = m_onestep_insert[cur_site];
+    oidata2.peak_fitness = m_base_fitness;
+    oidata2.peak_genome = m_base_genome;
+    oidata2.site_count.Resize(m_base_genome_size + 1, 0);
+    
+    sStep& tidata2 = m_twostep_insert[cur_site];
+    tidata2.peak_fitness = m_base_fitness;
+    tidata2.peak_genome = m_base_genome;
+    tidata2.site_count.Resize(m_base_genome_size + 2, 0);
+    
+    sStep& tipdata2 = m_insert_point[cur_site];
+    tipdata2.peak_fitness = m_base_fitness;
+    tipdata2.peak_genome = m_base_genome;
+    tipdata2.site_count.Resize(m_base_genome_size + 1, 0);
+    
+    sStep& tiddata2 = m_insert_delete[cur_site];
+    tiddata2.peak_fitness = m_base_fitness;
+    tiddata2.peak_genome = m_base_genome;
+    tiddata2.site_count.Resize(m_base_genome_size + 1, 0);
+    
+    ProcessOneStepInsert(ctx, testcpu.Get(), test_info, cur_site); 
+  }
 }
 
 
 void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
 {
   // Generate base information
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   cCPUTestInfo test_info;
-  testcpu->TestGenome(ctx, test_info, m_base_genome);
+  testcpu->TestGenome(ctx, test_info, m_base_genome, m_checkpoints);
   
   cPhenotype& phenotype = test_info.GetColonyOrganism()->GetPhenotype();
   m_base_fitness = test_info.GetColonyFitness();
@@ -178,8 +172,6 @@ void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
   
   // If invalid target supplied, set to the last task
   if (m_target >= m_base_tasks.GetSize() || m_target < 0) m_target = m_base_tasks.GetSize() - 1;
-  
-  delete testcpu;
 
   // Setup state to begin processing
   m_onestep_point.ResizeClear(m_base_genome_size);
@@ -197,21 +189,6 @@ void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
   m_fitness_point.ResizeClear(m_base_genome_size, m_inst_set.GetSize());
   m_fitness_insert.ResizeClear(m_base_genome_size + 1, m_inst_set.GetSize());
   m_fitness_delete.ResizeClear(m_base_genome_size, 1);
-  
-  m_cur_site = 0;
-  m_completed = 0;
-  m_initialized = true;
-  
-  // Unlock internal mutex (was locked on Process() entrance)
-  //  - will allow workers to begin processing if job queue already active
-  m_mutex.Unlock();
-  
-  // Load enough jobs to process all sites
-  cAnalyzeJobQueue& jobqueue = m_world->GetAnalyze().GetJobQueue();
-  for (int i = 0; i < m_base_genome_size; i++)
-    jobqueue.AddJob(new tAnalyzeJob<cMutationalNeighborhood>(this, &cMutationalNeighborhood::Process));
-  
-  jobqueue.Start();
 }
 
 
@@ -239,7 +216,7 @@ void cMutationalNeighborhood::ProcessOneStepPoint(cAvidaContext& ctx, cTestCPU*
     if (cur_inst == inst_num) continue;
     
     seq[cur_site].SetOp(inst_num);
-    m_fitness_point[cur_site][inst_num] = ProcessOneStepGenome(ctx, testcpu, test_info, mod_genome, odata, cur_site);
+    m_fitness_point[cur_site][inst_num] = ProcessOneStepGenome(ctx, testcpu, test_info, mod_genome, odata, cur_site, true);
 
     ProcessTwoStepPoint(ctx, testcpu, test_info, cur_site, mod_genome);
   }
@@ -291,10 +268,12 @@ void cMutationalNeighborhood::ProcessOneStepDelete(cAvidaContext& ctx, cTestCPU*
 
 
 double cMutationalNeighborhood::ProcessOneStepGenome(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info,
-                                                     const Genome& mod_genome, sStep& odata, int cur_site)
+                                                     const Genome& mod_genome, sStep& odata, int cur_site,
+                                                     bool point_mutant)
 {
-  // Run the modified genome through the Test CPU
-  testcpu->TestGenome(ctx, test_info, mod_genome);
+  // Run the modified genome through the Test CPU, point mutants resuming from the base genome's checkpoints
+  if (point_mutant) testcpu->TestPointMutant(ctx, test_info, mod_genome, m_checkpoints, cur_site);
+  else testcpu->TestGenome(ctx, test_info, mod_genome);
   
   // Collect the calculated fitness
   double test_fitness = test_info.GetColonyFitness();
@@ -26,6 +26,7 @@
 #include "avida/core/Genome.h"
 #include "avida/output/Types.h"
 
+#include "cTestCPUCheckpoints.h"
 #include "tList.h"
 #include "tMatrix.h"
 
@@ -51,10 +52,6 @@ private:
   Apto::RWLock m_rwlock;
   Apto::Mutex m_mutex;
   
-  bool m_initialized;
-  int m_cur_site;
-  int m_completed;
-  
   const cInstSet& m_inst_set;  
   int m_target;
   
@@ -70,6 +67,7 @@ private:
   Apto::Array<int> m_base_tasks;
   double m_neut_min;  // These two variables are a range around the base
   double m_neut_max;  //   fitness to be counted as neutral mutations.
+  cTestCPUCheckpoints m_checkpoints;  // Checkpoints of the base genome's gestation, one step point mutants resume from them
   
   
 
@@ -241,12 +239,13 @@ private:
   // Internal Calculation Methods
   // -----------------------------------------------------------------------------------------------------------------------
   void ProcessInitialize(cAvidaContext& ctx);
+  void ProcessSite(cAvidaContext& ctx, int cur_site);
   
   void ProcessOneStepPoint(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site);
   void ProcessOneStepInsert(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site);
   void ProcessOneStepDelete(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site);
   double ProcessOneStepGenome(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, const Genome& mod_genome,
-                              sStep& odata, int cur_site);
+                              sStep& odata, int cur_site, bool point_mutant = false);
   void AggregateOneStep(Apto::Array<sStep>& steps, sOneStepAggregate& osa);
 
   void ProcessTwoStepPoint(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site, Genome& mod_genome);
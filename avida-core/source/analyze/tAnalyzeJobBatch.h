@@ -26,10 +26,9 @@
 #include "apto/platform.h"
 
 #include "cAnalyzeJobQueue.h"
+#include "cAvidaContext.h"
 #include "tAnalyzeJob.h"
 
-class cAvidaContext;
-
 #if APTO_PLATFORM(WINDOWS) && defined(AddJob)
 # undef AddJob
 #endif
@@ -39,7 +38,9 @@ template<class JobClass> class tAnalyzeJobBatch
 {
 protected:
   template<class T> class tAnalyzeBatchJob;
+  template<class T> class tAnalyzeRangeJob;
   friend class tAnalyzeBatchJob<JobClass>;
+  friend class tAnalyzeRangeJob<JobClass>;
   
 protected:
   cAnalyzeJobQueue& m_queue;
@@ -61,17 +62,50 @@ public:
     m_queue.AddJob(new tAnalyzeBatchJob<JobClass>(this, target, funJ));
   }
   
+  //! Add jobs calling (target->*funJ)(ctx, i) for each i in [begin, end), grain consecutive indices to a job.
+  //! With a base_seed of zero or more, the job for the k-th range is seeded with base_seed + k rather than by the queue.
+  void AddRange(JobClass* target, void (JobClass::*funJ)(cAvidaContext&, int), int begin, int end, int grain = 1,
+                int base_seed = -1)
+  {
+    if (grain < 1) grain = 1;
+    
+    Apto::Array<cAnalyzeJob*> jobs;
+    for (int i = begin; i < end; i += grain) {
+      cAnalyzeJob* job = new tAnalyzeRangeJob<JobClass>(this, target, funJ, i, (end - i > grain) ? i + grain : end);
+      if (base_seed >= 0) job->SetSeed(base_seed + jobs.GetSize());
+      jobs.Push(job);
+    }
+    
+    m_mutex.Lock();
+    m_jobs += jobs.GetSize();
+    m_mutex.Unlock();
+    m_queue.AddJobs(jobs);
+  }
+  
   void RunBatch()
   {
     m_queue.Start();
     m_mutex.Lock();
     while (m_jobs > 0) {
-      m_cond.Wait(m_mutex);
+      // Rather than just block (possibly holding up one of the workers), run queued jobs while the batch completes
+      m_mutex.Unlock();
+      bool ran_job = m_queue.RunQueuedJob();
+      m_mutex.Lock();
+      if (!ran_job && m_jobs > 0) m_cond.Wait(m_mutex);
     }
     m_mutex.Unlock();
   }
   
 protected:
+  void completeJob()
+  {
+    // Signal while holding the lock, the batch may be gone as soon as the waiting thread sees the last job complete
+    m_mutex.Lock();
+    m_jobs--;
+    m_cond.Broadcast();
+    m_mutex.Unlock();
+  }
+  
   template<class T> class tAnalyzeBatchJob : public tAnalyzeJob<T>
   {
   protected:
@@ -84,14 +118,52 @@ protected:
     void Run(cAvidaContext& ctx)
     {
       tAnalyzeJob<T>::Run(ctx);
-      
-      m_batch->m_mutex.Lock();
-      m_batch->m_jobs--;
-      m_batch->m_mutex.Unlock();
-      m_batch->m_cond.Signal();
+      m_batch->completeJob();
+    }
+  };
+  
+  template<class T> class tAnalyzeRangeJob : public cAnalyzeJob
+  {
+  protected:
+    tAnalyzeJobBatch<T>* m_batch;
+    T* m_target;
+    void (T::*JobTask)(cAvidaContext&, int);
+    int m_begin;
+    int m_end;
+    
+  public:
+    tAnalyzeRangeJob(tAnalyzeJobBatch<T>* batch, T* target, void (T::*funJ)(cAvidaContext&, int), int begin, int end)
+      : m_batch(batch), m_target(target), JobTask(funJ), m_begin(begin), m_end(end) { ; }
+    
+    void Run(cAvidaContext& ctx)
+    {
+      for (int i = m_begin; i < m_end; i++) (m_target->*JobTask)(ctx, i);
+      m_batch->completeJob();
     }
   };
 };
 
 
+//! Call (target->*funJ)(ctx, i) for each i in [begin, end) on the analyze job queue, returning once all have completed.
+//! Safe to call from within a running job, since the waiting thread runs queued jobs itself.
+template<class T> void ParallelFor(cAnalyzeJobQueue& queue, T* target, void (T::*funJ)(cAvidaContext&, int),
+                                   int begin, int end, int grain = 1)
+{
+  tAnalyzeJobBatch<T> batch(queue);
+  batch.AddRange(target, funJ, begin, end, grain);
+  batch.RunBatch();
+}
+
+//! As above, but the jobs are seeded from the caller's random stream plus their range index rather than by the queue.
+//! Use this form from within a running job whenever the jobs use their random stream, so results do not depend on
+//! the order in which the running jobs reached this point.
+template<class T> void ParallelFor(cAnalyzeJobQueue& queue, cAvidaContext& ctx, T* target,
+                                   void (T::*funJ)(cAvidaContext&, int), int begin, int end, int grain = 1)
+{
+  tAnalyzeJobBatch<T> batch(queue);
+  batch.AddRange(target, funJ, begin, end, grain, ctx.GetRandom().GetInt(ctx.GetRandom().MaxSeed()));
+  batch.RunBatch();
+}
+
+
 #endif
@@ -26,6 +26,14 @@
 
 #include "AvidaTools.h"
 
+#include <cassert>
+#include <climits>
+#include <cstring>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
 using namespace AvidaTools;
 
 
@@ -34,6 +42,189 @@ const double MEMORY_INCREASE_FACTOR = 1.5;
 const double MEMORY_SHRINK_TEST_FACTOR = 4.0;
 
 
+// Genetic Distance Kernels
+// --------------------------------------------------------------------------------------------------------------
+//
+// The distance methods work on the raw instruction bytes of both sequences (an Instruction is a single byte).
+
+namespace {
+  typedef char tInstructionIsOneByte[(sizeof(Avida::Instruction) == 1) ? 1 : -1];
+  typedef unsigned long long tWord;
+  
+  const int WORD_BITS = 64;
+  const tWord WORD_HIGH_BIT = 1ULL << 63;
+  const int STACK_BLOCKS = 4;            // pattern blocks held on the stack by the bit-parallel edit distance
+  const int MAX_BAND_WIDTH = 65;         // widest diagonal band handled by the banded edit distance
+  
+  inline int countBits(tWord x)
+  {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+  }
+  
+  // Count the differing sites of two runs of instruction bytes, 16 sites at a time with SSE2 and 8 at a time otherwise.
+  // Counting stops early once more than limit differences have been found.
+  int countMismatches(const unsigned char* seq1, const unsigned char* seq2, int size, int limit)
+  {
+    int mismatches = 0;
+    int i = 0;
+    
+#if defined(__SSE2__)
+    for (; i + 16 <= size; i += 16) {
+      const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(seq1 + i)),
+                                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(seq2 + i)));
+      mismatches += 16 - countBits(static_cast<tWord>(_mm_movemask_epi8(eq)));
+      if (mismatches > limit) return mismatches;
+    }
+#endif
+    
+    const tWord low7 = 0x7F7F7F7F7F7F7F7FULL;
+    for (; i + 8 <= size; i += 8) {
+      tWord word1, word2;
+      memcpy(&word1, seq1 + i, sizeof(tWord));
+      memcpy(&word2, seq2 + i, sizeof(tWord));
+      
+      // Set the high bit of every byte that differs
+      const tWord diff = word1 ^ word2;
+      mismatches += countBits((((diff & low7) + low7) | diff) & ~low7);
+      if (mismatches > limit) return mismatches;
+    }
+    
+    for (; i < size; i++) if (seq1[i] != seq2[i]) mismatches++;
+    
+    return mismatches;
+  }
+  
+  // Levenshtein distance by Myers' bit-vector algorithm, using Hyyro's block formulation for patterns longer than a word.
+  // Each text site advances the vertical difference vectors of all pattern rows 64 at a time.
+  int bitParallelEditDistance(const unsigned char* pattern, int pattern_size, const unsigned char* text, int text_size)
+  {
+    const int num_blocks = (pattern_size + WORD_BITS - 1) / WORD_BITS;
+    
+    // Only clear the match masks of ops that actually occur
+    int num_ops = 0;
+    for (int i = 0; i < pattern_size; i++) if (pattern[i] >= num_ops) num_ops = pattern[i] + 1;
+    for (int i = 0; i < text_size; i++) if (text[i] >= num_ops) num_ops = text[i] + 1;
+    
+    tWord stack_peq[256 * STACK_BLOCKS];
+    tWord stack_pv[STACK_BLOCKS];
+    tWord stack_mv[STACK_BLOCKS];
+    Apto::Array<tWord> heap_words;
+    tWord* peq = stack_peq;
+    tWord* pv = stack_pv;
+    tWord* mv = stack_mv;
+    if (num_blocks > STACK_BLOCKS) {
+      heap_words.Resize((num_ops + 2) * num_blocks);
+      peq = &heap_words[0];
+      pv = peq + num_ops * num_blocks;
+      mv = pv + num_blocks;
+    }
+    
+    memset(peq, 0, sizeof(tWord) * num_ops * num_blocks);
+    for (int i = 0; i < pattern_size; i++) peq[pattern[i] * num_blocks + i / WORD_BITS] |= 1ULL << (i % WORD_BITS);
+    for (int b = 0; b < num_blocks; b++) {
+      pv[b] = ~0ULL;
+      mv[b] = 0;
+    }
+    
+    // The score is the distance from the whole pattern to the text seen so far, read from the last pattern row
+    const tWord last_row_bit = 1ULL << ((pattern_size - 1) % WORD_BITS);
+    int score = pattern_size;
+    
+    for (int j = 0; j < text_size; j++) {
+      const tWord* eq_blocks = peq + text[j] * num_blocks;
+      int h_in = 1;  // the row above the pattern increases by one at every text site
+      
+      for (int b = 0; b < num_blocks; b++) {
+        tWord eq = eq_blocks[b];
+        const tWord pv_b = pv[b];
+        const tWord mv_b = mv[b];
+        
+        const tWord xv = eq | mv_b;
+        if (h_in < 0) eq |= 1;
+        const tWord xh = (((eq & pv_b) + pv_b) ^ pv_b) | eq;
+        tWord ph = mv_b | ~(xh | pv_b);
+        tWord mh = pv_b & xh;
+        
+        const tWord out_bit = (b == num_blocks - 1) ? last_row_bit : WORD_HIGH_BIT;
+        const int h_out = (ph & out_bit) ? 1 : ((mh & out_bit) ? -1 : 0);
+        
+        ph <<= 1;
+        mh <<= 1;
+        if (h_in < 0) mh |= 1;
+        else if (h_in > 0) ph |= 1;
+        
+        pv[b] = mh | ~(xv | ph);
+        mv[b] = ph & xv;
+        h_in = h_out;
+      }
+      
+      score += h_in;
+    }
+    
+    return score;
+  }
+  
+  // Levenshtein distance limited to the diagonals within max_dist of the main one (Ukkonen's band).  Cells are capped at
+  // max_dist + 1, which is returned as soon as every cell of a row exceeds max_dist.
+  int bandedEditDistance(const unsigned char* seq1, int size1, const unsigned char* seq2, int size2, int max_dist)
+  {
+    const int width = 2 * max_dist + 1;
+    const int cap = max_dist + 1;
+    assert(width <= MAX_BAND_WIDTH);
+    
+    // Band index t holds column j = i + t - max_dist of row i
+    int rows[2][MAX_BAND_WIDTH];
+    int* prev_row = rows[0];
+    int* cur_row = rows[1];
+    for (int t = 0; t < width; t++) {
+      const int j = t - max_dist;
+      prev_row[t] = (j < 0 || j > size2) ? cap : Apto::Min(j, cap);
+    }
+    
+    for (int i = 1; i <= size1; i++) {
+      int row_min = cap;
+      for (int t = 0; t < width; t++) {
+        const int j = i + t - max_dist;
+        if (j < 0 || j > size2) {
+          cur_row[t] = cap;
+          continue;
+        }
+        
+        int value = i;
+        if (j > 0) {
+          value = prev_row[t] + ((seq1[i - 1] != seq2[j - 1]) ? 1 : 0);
+          if (t + 1 < width && prev_row[t + 1] + 1 < value) value = prev_row[t + 1] + 1;
+          if (t > 0 && cur_row[t - 1] + 1 < value) value = cur_row[t - 1] + 1;
+        }
+        if (value > cap) value = cap;
+        cur_row[t] = value;
+        if (value < row_min) row_min = value;
+      }
+      if (row_min > max_dist) return cap;
+      
+      int* temp_row = prev_row;
+      prev_row = cur_row;
+      cur_row = temp_row;
+    }
+    
+    return prev_row[size2 - size1 + max_dist];
+  }
+  
+  // Count the sites that match at the front and, of what remains, at the end of two sequences
+  void trimMatches(const unsigned char* seq1, int size1, const unsigned char* seq2, int size2, int& match_front, int& match_end)
+  {
+    const int min_size = (size1 < size2) ? size1 : size2;
+    match_front = 0;
+    match_end = 0;
+    while (match_front < min_size && seq1[match_front] == seq2[match_front]) match_front++;
+    while (match_end < min_size && seq1[size1 - match_end - 1] == seq2[size2 - match_end - 1]) match_end++;
+  }
+}
+
+
 Avida::InstructionSequence::InstructionSequence(const InstructionSequence& seq)
 : GeneticRepresentation(seq), m_seq(seq.GetSize()), m_active_size(seq.GetSize())
 {
@@ -492,12 +683,11 @@ int Avida::InstructionSequence::FindHammingDistance(const InstructionSequence& s
   const int overlap = FindOverlap(seq1, seq2, offset);
   
   // Initialize the hamming distance to anything protruding past the overlap.
-  
   int hamming_distance = seq1.GetSize() + seq2.GetSize() - 2 * overlap;
   
-  // Cycle through the overlap adding all differences to the distance.
-  for (int i = 0; i < overlap; i++) {
-    if (seq1[start1 + i] != seq2[start2 + i])  hamming_distance++;
+  // Add all differences within the overlap.
+  if (overlap > 0) {
+    hamming_distance += countMismatches(seq1.rawSites() + start1, seq2.rawSites() + start2, overlap, INT_MAX);
   }
   
   return hamming_distance;
@@ -508,28 +698,30 @@ int Avida::InstructionSequence::FindBestOffset(const InstructionSequence& seq1,
 {
   const int size1 = seq1.GetSize();
   const int size2 = seq2.GetSize();
+  const unsigned char* sites1 = seq1.rawSites();
+  const unsigned char* sites2 = seq2.rawSites();
   
   int best_offset = 0;
-  int cur_distance = FindHammingDistance(seq1, seq2);
-  int best_distance = cur_distance;
-  
-  // Check positive offsets...
-  for (int i = 1; i < size1 || i < size2; i++) {
-    if (size1 + size2 - 2 * FindOverlap(seq1, seq2, i) > best_distance) break;
-    cur_distance = FindHammingDistance(seq1, seq2, i);
-    if (cur_distance < best_distance) {
-      best_distance = cur_distance;
-      best_offset = i;
-    }
-  }
-  
-  // Check negative offsets...
-  for (int i = 1; i < size1 || i < size2; i++) {
-    if (size1 + size2 - 2 * FindOverlap(seq1, seq2, -i) > best_distance) break;
-    cur_distance = FindHammingDistance(seq1, seq2, -i);
-    if (cur_distance < best_distance) {
-      best_distance = cur_distance;
-      best_offset = -i;
+  int best_distance = FindHammingDistance(seq1, seq2);
+  
+  // Check positive offsets, then negative ones.  Only offsets that beat the best distance so far matter, so counting
+  // the differences of an offset stops as soon as it cannot.
+  for (int sign = 1; sign >= -1; sign -= 2) {
+    for (int i = 1; i < size1 || i < size2; i++) {
+      const int overlap = FindOverlap(seq1, seq2, sign * i);
+      const int protrusion = size1 + size2 - 2 * overlap;
+      if (protrusion > best_distance) break;
+      
+      int cur_distance = protrusion;
+      if (overlap > 0) {
+        const int start1 = (sign > 0) ? i : 0;
+        const int start2 = (sign > 0) ? 0 : i;
+        cur_distance += countMismatches(sites1 + start1, sites2 + start2, overlap, best_distance - protrusion - 1);
+      }
+      if (cur_distance < best_distance) {
+        best_distance = cur_distance;
+        best_offset = sign * i;
+      }
     }
   }
   
@@ -548,66 +740,55 @@ int Avida::InstructionSequence::FindEditDistance(const InstructionSequence& seq1
 {
   const int size1 = seq1.GetSize();
   const int size2 = seq2.GetSize();
-  const int min_size = (size1 < size2) ? size1 : size2;
   
   // If either size is zero, return the other one!
-  if (!min_size) return (size1 > size2) ? size1 : size2;
+  if (!size1 || !size2) return (size1 > size2) ? size1 : size2;
   
-  // Count how many direct matches we have at the front and end.
-  int match_front = 0, match_end = 0;
-  while (match_front < min_size && seq1[match_front] == seq2[match_front]) match_front++;
-  while (match_end < min_size && seq1[size1 - match_end - 1] == seq2[size2 - match_end - 1]) match_end++;
+  // Count how many direct matches we have at the front and end, these sites have distance zero.
+  const unsigned char* sites1 = seq1.rawSites();
+  const unsigned char* sites2 = seq2.rawSites();
+  int match_front, match_end;
+  trimMatches(sites1, size1, sites2, size2, match_front, match_end);
   
-  // We can ignore the last match_end sites since we know they have distance zero.
   const int test_size1 = size1 - match_front - match_end;
   const int test_size2 = size2 - match_front - match_end;
   
   if (test_size1 <= 0 || test_size2 <=0) return abs(test_size1 - test_size2);
   
-  // Now match everything else...
-  int* cur_row  = new int[test_size1];  // The row we are calculating
-  int* prev_row = new int[test_size1];  // The last row we calculated
+  // Now match everything else, using the shorter remainder as the pattern.
+  if (test_size1 <= test_size2) {
+    return bitParallelEditDistance(sites1 + match_front, test_size1, sites2 + match_front, test_size2);
+  }
+  return bitParallelEditDistance(sites2 + match_front, test_size2, sites1 + match_front, test_size1);
+}
+
+
+int Avida::InstructionSequence::FindEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2,
+                                                 int max_distance)
+{
+  assert(max_distance >= 0);
+  
+  const int size1 = seq1.GetSize();
+  const int size2 = seq2.GetSize();
   
-  // Initialize the previous row to record the differece from nothing.
-  for (int i = 0; i < test_size1; i++)  prev_row[i] = i + 1;
+  // Every edit changes the length by at most one.
+  if (abs(size1 - size2) > max_distance) return max_distance + 1;
   
-  // Loop through each subsequent character in the test code
-  for (int i = 0; i < test_size2; i++) {
-    // Initialize the first entry in cur_row.
-    if (seq1[match_front] == seq2[match_front + i]) cur_row[0] = i;
-    else cur_row[0] = (i < prev_row[0]) ? (i+1) : (prev_row[0] + 1);
-    
-    // Move down the cur_row and fill it out.
-    for (int j = 1; j < test_size1; j++) {
-      // If the values are equal, keep the value in the upper left.
-      if (seq1[match_front + j] == seq2[match_front + i]) {
-        cur_row[j] = prev_row[j-1];
-      }
-      
-      // Otherwise, set the current position the the minimal of the three
-      // numbers above (insertion), to the left (deletion), or upper left
-      // (mutation) in the chart, plus one.
-      else {
-        cur_row[j] = (prev_row[j] < prev_row[j-1]) ? prev_row[j] : prev_row[j-1];
-        if (cur_row[j-1] < cur_row[j]) cur_row[j] = cur_row[j-1];
-        cur_row[j]++;
-      }
-    }
-    
-    // Swap cur_row and prev_row. (we only really need to move the cur row
-    // over to prev, but this saves us from having to keep re-allocating
-    // new rows.  We recycle!
-    int* temp_row = cur_row;
-    cur_row = prev_row;
-    prev_row = temp_row;
-  }
+  if (!size1 || !size2) return (size1 > size2) ? size1 : size2;
   
-  // Now that we are done, return the bottom-right corner of the chart.
+  const unsigned char* sites1 = seq1.rawSites();
+  const unsigned char* sites2 = seq2.rawSites();
+  int match_front, match_end;
+  trimMatches(sites1, size1, sites2, size2, match_front, match_end);
   
-  const int value = prev_row[test_size1 - 1];
+  const int test_size1 = size1 - match_front - match_end;
+  const int test_size2 = size2 - match_front - match_end;
   
-  delete [] cur_row;
-  delete [] prev_row;
+  if (test_size1 <= 0 || test_size2 <=0) return abs(test_size1 - test_size2);
   
-  return value;
+  // Narrow bounds only need the diagonals near the main one, wide ones are no cheaper than the full distance.
+  if (2 * max_distance + 1 <= MAX_BAND_WIDTH) {
+    return bandedEditDistance(sites1 + match_front, test_size1, sites2 + match_front, test_size2, max_distance);
+  }
+  return Apto::Min(FindEditDistance(seq1, seq2), max_distance + 1);
 }
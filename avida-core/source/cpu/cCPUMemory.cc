@@ -22,10 +22,14 @@
 
 #include "cCPUMemory.h"
 
+#include "cCodeLabel.h"
+#include "cInstSet.h"
+
 using namespace std;
 using namespace Avida;
 
-cCPUMemory::cCPUMemory(const cCPUMemory& in_memory) : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize())
+cCPUMemory::cCPUMemory(const cCPUMemory& in_memory)
+  : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize()), m_label_nops(0), m_label_runs_valid(false)
 {
   for (int i = 0; i < m_flag_array.GetSize(); i++) m_flag_array[i] = in_memory.m_flag_array[i];
 }
@@ -33,6 +37,9 @@ cCPUMemory::cCPUMemory(const cCPUMemory& in_memory) : InstructionSequence(in_mem
 
 void cCPUMemory::adjustCapacity(int new_size)
 {
+  // Every resizing edit goes through here, the label index is rebuilt on the next search
+  m_label_runs_valid = false;
+  
   InstructionSequence::adjustCapacity(new_size);
   if (m_seq.GetSize() != m_flag_array.GetSize()) m_flag_array.Resize(m_seq.GetSize()); 
 }
@@ -95,7 +102,7 @@ void cCPUMemory::Copy(int to, int from)
   assert(from >= 0);
   assert(from < m_seq.GetSize());
   
-  m_seq[to] = m_seq[from];
+  SetInst(to, m_seq[from]);
   m_flag_array[to] = m_flag_array[from];
 }
 
@@ -143,6 +150,7 @@ void cCPUMemory::Replace(int pos, int num_sites, const InstructionSequence& geno
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
   
   const int size_change = genome.GetSize() - num_sites;
+  m_label_runs_valid = false;
   
   // First, get the size right
   if (size_change > 0) prepareInsert(pos, size_change);
@@ -179,3 +187,145 @@ void cCPUMemory::operator=(const InstructionSequence& other_genome)
   }
 }
 
+
+int cCPUMemory::FindLabelForward(const cCodeLabel& label, const cInstSet& inst_set, int pos) const
+{
+  assert(pos >= 0 && pos < m_active_size);
+  
+  const int label_size = label.GetSize();
+  
+  // Move off the template we are on
+  if (pos + label_size >= m_active_size) return -1;
+  if (!m_label_runs_valid || m_label_nops != inst_set.GetNumNops()) buildLabelRuns(inst_set.GetNumNops());
+  
+  // Every run of nops that extends past the template is a candidate, but never look back before pos
+  for (int run = findLabelRun(pos + label_size); run < m_label_runs.GetSize(); run++) {
+    const int start = (m_label_runs[run].start > pos) ? m_label_runs[run].start : pos;
+    const int end = m_label_runs[run].end;
+    for (int offset = start; offset + label_size <= end; offset++) {
+      if (matchLabel(label, inst_set, offset)) return offset + label_size;
+    }
+  }
+  
+  return -1;
+}
+
+
+int cCPUMemory::FindLabelBackward(const cCodeLabel& label, const cInstSet& inst_set, int pos) const
+{
+  assert(pos < m_active_size);
+  
+  const int label_size = label.GetSize();
+  
+  // Move off the template we are on
+  const int first = pos - label_size;
+  if (first < 0) return -1;
+  if (!m_label_runs_valid || m_label_nops != inst_set.GetNumNops()) buildLabelRuns(inst_set.GetNumNops());
+  
+  // Candidates are the runs of nops starting at or before first, searched back from the last of them.  Runs never
+  // extend past pos, and a match returns the end of the run it was found in.
+  int run = findLabelRun(first);
+  if (run == m_label_runs.GetSize() || m_label_runs[run].start > first) run--;
+  for (; run >= 0; run--) {
+    const int start = m_label_runs[run].start;
+    const int end = (m_label_runs[run].end < pos) ? m_label_runs[run].end : pos;
+    for (int offset = start; offset + label_size <= end; offset++) {
+      if (matchLabel(label, inst_set, offset)) return end;
+    }
+  }
+  
+  return -1;
+}
+
+
+void cCPUMemory::buildLabelRuns(int num_nops) const
+{
+  m_label_runs.Resize(0);
+  m_label_nops = num_nops;
+  
+  int pos = 0;
+  while (pos < m_active_size) {
+    if (m_seq[pos].GetOp() >= num_nops) {
+      pos++;
+      continue;
+    }
+    sLabelRun run;
+    run.start = pos;
+    while (pos < m_active_size && m_seq[pos].GetOp() < num_nops) pos++;
+    run.end = pos;
+    m_label_runs.Push(run);
+  }
+  
+  m_label_runs_valid = true;
+}
+
+
+// Index of the first run of nops that ends after pos (the run containing pos, if any)
+int cCPUMemory::findLabelRun(int pos) const
+{
+  int lo = 0;
+  int hi = m_label_runs.GetSize();
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_label_runs[mid].end > pos) hi = mid;
+    else lo = mid + 1;
+  }
+  return lo;
+}
+
+
+// Update the runs for the site at pos changing to (or from) a nop
+void cCPUMemory::updateLabelRuns(int pos, bool is_nop)
+{
+  const int run = findLabelRun(pos);
+  const int num_runs = m_label_runs.GetSize();
+  
+  if (is_nop) {
+    const bool join_prev = (run > 0 && m_label_runs[run - 1].end == pos);
+    const bool join_next = (run < num_runs && m_label_runs[run].start == pos + 1);
+    if (join_prev && join_next) {
+      // The site bridges two runs, merge them
+      m_label_runs[run - 1].end = m_label_runs[run].end;
+      for (int i = run + 1; i < num_runs; i++) m_label_runs[i - 1] = m_label_runs[i];
+      m_label_runs.Resize(num_runs - 1);
+    } else if (join_prev) {
+      m_label_runs[run - 1].end = pos + 1;
+    } else if (join_next) {
+      m_label_runs[run].start = pos;
+    } else {
+      // A new run of a single nop
+      m_label_runs.Resize(num_runs + 1);
+      for (int i = num_runs; i > run; i--) m_label_runs[i] = m_label_runs[i - 1];
+      m_label_runs[run].start = pos;
+      m_label_runs[run].end = pos + 1;
+    }
+  } else {
+    assert(run < num_runs && m_label_runs[run].start <= pos);
+    sLabelRun& cur_run = m_label_runs[run];
+    if (cur_run.start == pos && cur_run.end == pos + 1) {
+      for (int i = run + 1; i < num_runs; i++) m_label_runs[i - 1] = m_label_runs[i];
+      m_label_runs.Resize(num_runs - 1);
+    } else if (cur_run.start == pos) {
+      cur_run.start++;
+    } else if (cur_run.end == pos + 1) {
+      cur_run.end--;
+    } else {
+      // The site splits its run in two
+      const int end = cur_run.end;
+      cur_run.end = pos;
+      m_label_runs.Resize(num_runs + 1);
+      for (int i = num_runs; i > run + 1; i--) m_label_runs[i] = m_label_runs[i - 1];
+      m_label_runs[run + 1].start = pos + 1;
+      m_label_runs[run + 1].end = end;
+    }
+  }
+}
+
+
+bool cCPUMemory::matchLabel(const cCodeLabel& label, const cInstSet& inst_set, int pos) const
+{
+  for (int i = 0; i < label.GetSize(); i++) {
+    if (label[i] != inst_set.GetNopMod(m_seq[pos + i])) return false;
+  }
+  return true;
+}
@@ -25,6 +25,9 @@
 
 #include "avida/core/InstructionSequence.h"
 
+class cCodeLabel;
+class cInstSet;
+
 
 class cCPUMemory : public Avida::InstructionSequence
 {
@@ -40,16 +43,41 @@ private:
   
   Apto::Array<unsigned char> m_flag_array;
 
+  // Label index - the maximal runs of nop instructions in memory, in order.  Single site writes through SetInst and
+  // Copy keep it up to date, all other edits (including writes through operator[]) mark it to be rebuilt by the
+  // next label search.
+  struct sLabelRun
+  {
+    int start;
+    int end;
+  };
+  mutable Apto::Array<sLabelRun> m_label_runs;
+  mutable int m_label_nops;         // number of nop instructions the runs were built for
+  mutable bool m_label_runs_valid;
+
   void adjustCapacity(int new_size);
   void prepareInsert(int pos, int num_sites);
 
+  void buildLabelRuns(int num_nops) const;
+  int findLabelRun(int pos) const;
+  void updateLabelRuns(int pos, bool is_nop);
+  bool matchLabel(const cCodeLabel& label, const cInstSet& inst_set, int pos) const;
+
 public:
   cCPUMemory(const cCPUMemory& in_memory);
-  cCPUMemory(const InstructionSequence& in_genome) : InstructionSequence(in_genome), m_flag_array(in_genome.GetSize()) { ; }
-  explicit cCPUMemory(int size = 1)  : InstructionSequence(size), m_flag_array(size) { ClearFlags(); }
-  cCPUMemory(const Apto::String& in_string) : InstructionSequence(in_string), m_flag_array(in_string.GetSize()) { ; }
+  cCPUMemory(const InstructionSequence& in_genome)
+    : InstructionSequence(in_genome), m_flag_array(in_genome.GetSize()), m_label_nops(0), m_label_runs_valid(false) { ; }
+  explicit cCPUMemory(int size = 1)
+    : InstructionSequence(size), m_flag_array(size), m_label_nops(0), m_label_runs_valid(false) { ClearFlags(); }
+  cCPUMemory(const Apto::String& in_string)
+    : InstructionSequence(in_string), m_flag_array(in_string.GetSize()), m_label_nops(0), m_label_runs_valid(false) { ; }
   ~cCPUMemory() { ; }
 
+  // Mutable access may be used to write, so it drops the label index; prefer SetInst for writes
+  inline Avida::Instruction& operator[](int idx) { m_label_runs_valid = false; return InstructionSequence::operator[](idx); }
+  inline const Avida::Instruction& operator[](int idx) const { return InstructionSequence::operator[](idx); }
+  inline void SetInst(int pos, const Avida::Instruction& inst);
+
   inline bool FlagCopied(int pos) const     { return (MASK_COPIED   & m_flag_array[pos]) != 0; }
   inline bool FlagMutated(int pos) const    { return (MASK_MUTATED  & m_flag_array[pos]) != 0; }
   inline bool FlagExecuted(int pos) const   { return (MASK_EXECUTED & m_flag_array[pos]) != 0; }
@@ -74,6 +102,7 @@ public:
   
   void Clear()
 	{
+    m_label_runs_valid = false;
 		for (int i = 0; i < m_active_size; i++) {
 			m_seq[i].SetOp(0);
 			m_flag_array[i] = 0;
@@ -93,6 +122,22 @@ public:
 
   void operator=(const cCPUMemory& other_memory);
   void operator=(const InstructionSequence& other_genome);
+
+  // Search for the complement label starting after (forward) or before (backward) pos, using the label index.  The
+  // label may be found inside a longer run of nops.  Returns the first line after the found label, or -1.
+  int FindLabelForward(const cCodeLabel& label, const cInstSet& inst_set, int pos) const;
+  int FindLabelBackward(const cCodeLabel& label, const cInstSet& inst_set, int pos) const;
 };
 
+
+inline void cCPUMemory::SetInst(int pos, const Avida::Instruction& inst)
+{
+  assert(pos >= 0 && pos < m_active_size);
+  if (m_label_runs_valid) {
+    const bool is_nop = (inst.GetOp() < m_label_nops);
+    if (is_nop != (m_seq[pos].GetOp() < m_label_nops)) updateLabelRuns(pos, is_nop);
+  }
+  m_seq[pos] = inst;
+}
+
 #endif
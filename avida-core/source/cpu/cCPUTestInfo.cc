@@ -102,6 +102,26 @@ void cCPUTestInfo::Clear()
     org_array[i] = NULL;
   }
 }
+
+void cCPUTestInfo::CopySettings(const cCPUTestInfo& test_info)
+{
+  Clear();
+  
+  generation_tests = test_info.generation_tests;
+  org_array.Resize(generation_tests);
+  org_array.SetAll(NULL);
+  
+  trace_task_order = test_info.trace_task_order;
+  use_random_inputs = test_info.use_random_inputs;
+  use_manual_inputs = test_info.use_manual_inputs;
+  manual_inputs = test_info.manual_inputs;
+  m_mut_rates = test_info.m_mut_rates;
+  m_cur_sg = test_info.m_cur_sg;
+  m_res_method = test_info.m_res_method;
+  m_res = test_info.m_res;
+  m_res_update = test_info.m_res_update;
+  m_res_cpu_cycle_offset = test_info.m_res_cpu_cycle_offset;
+}
  
 
 double cCPUTestInfo::GetGenotypeFitness()
@@ -82,6 +82,8 @@ public:
   ~cCPUTestInfo();
 
   void Clear();
+  //! Copy the input, mutation rate and resource settings of another test info, but none of its results or organisms.
+  void CopySettings(const cCPUTestInfo& test_info);
  
   // Input Setup
   void TraceTaskOrder(bool _trace=true) { trace_task_order = _trace; }
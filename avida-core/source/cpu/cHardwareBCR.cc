@@ -295,6 +295,9 @@ cHardwareBCR::cHardwareBCR(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   
   m_no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
   
+  m_process_features = (m_has_any_costs) ? PROCESS_COSTS : 0;
+  selectSingleProcess();
+  
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
   const Genome& in_genome = in_organism->GetGenome();
@@ -434,8 +437,39 @@ void cHardwareBCR::Thread::Reset(cHardwareBCR* in_hardware, const Head& start_po
 
 bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
 {
+  return (speculative) ? (this->*m_single_process_spec)(ctx) : (this->*m_single_process)(ctx);
+}
+
+// Every combination of features gets its own variant, so that each one only checks the features actually in use.
+// This hardware has no promoter or thread features, those bits share the variants without them.
+const cHardwareBCR::tMethod cHardwareBCR::s_single_process[PROCESS_VARIANTS] = {
+  &cHardwareBCR::singleProcess<0x00>, &cHardwareBCR::singleProcess<0x01>, &cHardwareBCR::singleProcess<0x02>, &cHardwareBCR::singleProcess<0x03>,
+  &cHardwareBCR::singleProcess<0x00>, &cHardwareBCR::singleProcess<0x01>, &cHardwareBCR::singleProcess<0x02>, &cHardwareBCR::singleProcess<0x03>,
+  &cHardwareBCR::singleProcess<0x08>, &cHardwareBCR::singleProcess<0x09>, &cHardwareBCR::singleProcess<0x0A>, &cHardwareBCR::singleProcess<0x0B>,
+  &cHardwareBCR::singleProcess<0x08>, &cHardwareBCR::singleProcess<0x09>, &cHardwareBCR::singleProcess<0x0A>, &cHardwareBCR::singleProcess<0x0B>,
+  &cHardwareBCR::singleProcess<0x00>, &cHardwareBCR::singleProcess<0x01>, &cHardwareBCR::singleProcess<0x02>, &cHardwareBCR::singleProcess<0x03>,
+  &cHardwareBCR::singleProcess<0x00>, &cHardwareBCR::singleProcess<0x01>, &cHardwareBCR::singleProcess<0x02>, &cHardwareBCR::singleProcess<0x03>,
+  &cHardwareBCR::singleProcess<0x08>, &cHardwareBCR::singleProcess<0x09>, &cHardwareBCR::singleProcess<0x0A>, &cHardwareBCR::singleProcess<0x0B>,
+  &cHardwareBCR::singleProcess<0x08>, &cHardwareBCR::singleProcess<0x09>, &cHardwareBCR::singleProcess<0x0A>, &cHardwareBCR::singleProcess<0x0B>,
+};
+
+// Must be called whenever the configuration or a trace changes
+void cHardwareBCR::selectSingleProcess()
+{
+  int features = m_process_features;
+  if (m_tracer || m_microtrace || m_topnavtrace) features |= PROCESS_TRACE;
+  
+  m_single_process = s_single_process[features];
+  m_single_process_spec = s_single_process[features | PROCESS_SPECULATIVE];
+}
+
+
+template <int FEATURES> bool cHardwareBCR::singleProcess(cAvidaContext& ctx)
+{
+  const bool speculative = ((FEATURES & PROCESS_SPECULATIVE) != 0);
+  
   // If speculatively stalled, stay that way until a real instruction comes
-  if (speculative && m_spec_stall) return false;
+  if (speculative && (m_spec_stall || m_implicit_repro_pending)) return false;
   
   
   // Mark this organism as running...
@@ -490,7 +524,7 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
       ip.Adjust();
       
       // Print the status of this CPU at each step...
-      if (m_tracer) m_tracer->TraceHardware(ctx, *this);
+      if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this);
     
       // Find the instruction to be executed
       const Instruction cur_inst = ip.GetInst();
@@ -503,7 +537,7 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
       
       // Print the short form status of this CPU at each step... 
-      if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
+      if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
     
       bool exec = true;
       int exec_success = 0;
@@ -514,7 +548,7 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
       if (behav_class < BEHAV_CLASS_NONE && m_behav_class_used[behav_class]) {
         m_threads[m_cur_thread].active = false;
         m_threads[m_cur_thread].wait_reg = -1;
-        if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+        if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
         continue;
       }
 
@@ -522,8 +556,8 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
       
       // record any failure due to costs being paid
       // before we try to execute the instruction, is this org currently paying precosts for it
-      bool on_pause = IsPayingActiveCost(ctx, m_cur_thread);
-      if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+      bool on_pause = (FEATURES & PROCESS_COSTS) && IsPayingActiveCost(ctx, m_cur_thread);
+      if ((FEATURES & PROCESS_COSTS) && m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
       if (!exec) exec_success = -1;
       
       // Now execute the instruction...
@@ -542,8 +576,10 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
         
         if (exec == true) {
           if (SingleProcess_ExecuteInst(ctx, cur_inst)) {
-            SingleProcess_PayPostResCosts(ctx, cur_inst);
-            SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread);
+            if (FEATURES & PROCESS_COSTS) {
+              SingleProcess_PayPostResCosts(ctx, cur_inst);
+              SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread);
+            }
             // record execution success
             exec_success = 1;
           }
@@ -551,7 +587,7 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
         
         // Check if the instruction just executed caused premature death, break out of execution if so
         if (phenotype.GetToDelete()) {
-          if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+          if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
           break;
         }
         
@@ -567,7 +603,7 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
       
       // if using mini traces, report success or failure of execution
-      if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+      if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
       
       bool do_record = false;
       // record exec failed if the org just now started paying precosts
@@ -582,14 +618,14 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
       if (do_record) {
         // this will differ from time used
         phenotype.IncNumExecs();
-        if (m_microtrace || m_topnavtrace) {
+        if ((FEATURES & PROCESS_TRACE) && (m_microtrace || m_topnavtrace)) {
           RecordMicroTrace(cur_inst);
           if (m_topnavtrace) RecordNavTrace(m_use_avatar);
         }
       }
       
       if (phenotype.GetToDelete()) {
-        if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+        if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
         break;
       }
     }
@@ -606,7 +642,7 @@ bool cHardwareBCR::SingleProcess(cAvidaContext& ctx, bool speculative)
   if (!speculative && phenotype.GetToDelete()) m_spec_die = true;
   
   m_organism->SetRunning(false);
-  CheckImplicitRepro(ctx);
+  if (!m_spec_die || !speculative) CheckImplicitRepro(ctx, false, speculative);
   
   return !m_spec_die && !m_spec_stall;
 }
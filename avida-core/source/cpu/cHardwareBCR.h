@@ -276,6 +276,9 @@ private:
     unsigned int m_running_threads:4;
   };
   bool m_behav_class_used[3];
+  int m_process_features;       // SingleProcess features required by the configuration of this hardware
+  tMethod m_single_process;     // singleProcess variant for the features currently in use (see selectSingleProcess)
+  tMethod m_single_process_spec;
   
   cHeadCPU m_placeholder_head;
   
@@ -351,6 +354,9 @@ public:
   
 private:
   // --------  Core Execution Methods  --------
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx);
+  static const tMethod s_single_process[PROCESS_VARIANTS];
+  void selectSingleProcess();
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst);
   void internalReset();
   void internalResetOnFailedDivide();
@@ -27,7 +27,6 @@
 
 #include "cAvidaContext.h"
 #include "cCodeLabel.h"
-#include "cCPUTestInfo.h"
 #include "cEnvironment.h"
 #include "cHardwareManager.h"
 #include "cHardwareStatusPrinter.h"
@@ -35,10 +34,10 @@
 #include "cInstSet.h"
 #include "cOrganism.h"
 #include "cPhenotype.h"
+#include "cPhenotypeCache.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
 #include "cStats.h"
-#include "cTestCPU.h"
 #include "cWorld.h"
 #include "nHardware.h"
 
@@ -49,13 +48,28 @@ using namespace AvidaTools;
 cHardwareBase::cHardwareBase(cWorld* world, cOrganism* in_organism, cInstSet* inst_set)
 : m_world(world), m_organism(in_organism), m_inst_set(inst_set), m_tracer(NULL)
 , m_minitrace(false), m_microtrace(false), m_topnavtrace(false), m_reprotrace(false)
-, m_has_costs(inst_set->HasCosts()), m_has_ft_costs(inst_set->HasFTCosts()) , m_has_energy_costs(m_inst_set->HasEnergyCosts())
-, m_has_res_costs(m_inst_set->HasResCosts()), m_has_fem_res_costs(m_inst_set->HasFemResCosts())
-, m_has_female_costs(m_inst_set->HasFemaleCosts()), m_has_choosy_female_costs(m_inst_set->HasChoosyFemaleCosts())
-, m_has_post_costs(inst_set->HasPostCosts()), m_has_bonus_costs(inst_set->HasBonusCosts())
 {
 	m_task_switching_cost=0;
-	int switch_cost =  world->GetConfig().TASK_SWITCH_PENALTY.Get();
+  loadBaseConfig();
+  m_implicit_repro_pending = false;
+  m_checkpoints = NULL;
+	
+  assert(m_organism != NULL);
+}
+
+void cHardwareBase::loadBaseConfig()
+{
+  m_has_costs = m_inst_set->HasCosts();
+  m_has_ft_costs = m_inst_set->HasFTCosts();
+  m_has_energy_costs = m_inst_set->HasEnergyCosts();
+  m_has_res_costs = m_inst_set->HasResCosts();
+  m_has_fem_res_costs = m_inst_set->HasFemResCosts();
+  m_has_female_costs = m_inst_set->HasFemaleCosts();
+  m_has_choosy_female_costs = m_inst_set->HasChoosyFemaleCosts();
+  m_has_post_costs = m_inst_set->HasPostCosts();
+  m_has_bonus_costs = m_inst_set->HasBonusCosts();
+  
+	int switch_cost =  m_world->GetConfig().TASK_SWITCH_PENALTY.Get();
 	m_has_any_costs = (m_has_costs | m_has_ft_costs | m_has_energy_costs | m_has_res_costs | m_has_fem_res_costs | switch_cost | m_has_female_costs | 
                      m_has_choosy_female_costs | m_has_post_costs | m_has_bonus_costs);
   m_implicit_repro_active = (m_world->GetConfig().IMPLICIT_REPRO_TIME.Get() ||
@@ -63,8 +77,25 @@ cHardwareBase::cHardwareBase(cWorld* world, cOrganism* in_organism, cInstSet* in
                              m_world->GetConfig().IMPLICIT_REPRO_BONUS.Get() ||
                              m_world->GetConfig().IMPLICIT_REPRO_END.Get() ||
                              m_world->GetConfig().IMPLICIT_REPRO_ENERGY.Get());
-	
-  assert(m_organism != NULL);
+}
+
+void cHardwareBase::recycleBase(cOrganism* in_organism)
+{
+  assert(in_organism != NULL);
+  
+  // Restore the state set up by the constructor, everything else is reinitialized by Reset().  The configuration
+  // and instruction set may have been changed since this hardware was built, so they are read again.
+  m_organism = in_organism;
+  m_tracer = HardwareTracerPtr(NULL);
+  m_minitrace = false;
+  m_microtrace = false;
+  m_topnavtrace = false;
+  m_reprotrace = false;
+  m_task_switching_cost = 0;
+  m_ext_mem.Resize(0);
+  m_implicit_repro_pending = false;
+  m_checkpoints = NULL;
+  loadBaseConfig();
 }
 
 
@@ -78,6 +109,7 @@ void cHardwareBase::Reset(cAvidaContext& ctx)
   m_inst_cost = 0;
   ResizeCostArrays(m_world->GetConfig().MAX_CPU_THREADS.Get());
   m_female_cost = 0;
+  m_implicit_repro_pending = false;
   
   const int num_inst_cost = m_inst_set->GetSize();
   
@@ -885,19 +917,17 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-  cCPUTestInfo test_info;
-  test_info.UseRandomInputs();
-  testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
-  const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
+  cPhenotypeCache::sResult test_result;
+  cPhenotypeCache::TestGenome(m_world, ctx, m_organism->SystematicsGroup("genotype"), m_organism->OffspringGenome(), NULL,
+                              test_result);
+  const double child_fitness = test_result.fitness;
   
   bool revert = false;
   bool sterilize = false;
   
   // If implicit mutations are turned off, make sure this won't spawn one.
   if (m_organism->GetSterilizeUnstable() == true) {
-    if (test_info.GetMaxDepth() > 0) sterilize = true;
+    if (test_result.max_depth > 0) sterilize = true;
   }
   
   if (child_fitness == 0.0) {
@@ -924,7 +954,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
     RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-    const Apto::Array<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+    const Apto::Array<int>& childtasks = test_result.task_counts;
     bool del = false;
     bool added = false;
     for (int i=0; i<childtasks.GetSize(); i++)
@@ -949,7 +979,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const Apto::Array<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const Apto::Array<int>& child_tasks = test_result.task_counts;
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -997,22 +1027,20 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-  cCPUTestInfo test_info;
-  test_info.UseRandomInputs();
-  testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
-  const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
+  cPhenotypeCache::sResult test_result;
+  cPhenotypeCache::TestGenome(m_world, ctx, m_organism->SystematicsGroup("genotype"), m_organism->OffspringGenome(), NULL,
+                              test_result);
+  const double child_fitness = test_result.fitness;
   
   bool revert = false;
   bool sterilize = false;
   
   // If implicit mutations are turned off, make sure this won't spawn one.
   if (m_organism->GetSterilizeUnstable() > 0) {
-    if (test_info.GetMaxDepth() > 0) sterilize = true;
+    if (test_result.max_depth > 0) sterilize = true;
   }
   
-  if (m_organism->GetSterilizeUnstable() > 1 && !test_info.IsViable()) {
+  if (m_organism->GetSterilizeUnstable() > 1 && !test_result.is_viable) {
     sterilize = true;
   }
   
@@ -1038,7 +1066,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
 	  RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-	  const Apto::Array<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+	  const Apto::Array<int>& childtasks = test_result.task_counts;
 	  bool del = false;
 	  bool added = false;
 	  for (int i=0; i<childtasks.GetSize(); i++)
@@ -1063,7 +1091,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const Apto::Array<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const Apto::Array<int>& child_tasks = test_result.task_counts;
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -1176,6 +1204,23 @@ tBuffer<int>& cHardwareBase::GetOutputBuf()
 }
 
 
+// Execute up to num_cycles cycles back to back, stopping early if the organism is flagged for deletion.
+// Returns the number of cycles actually executed.
+int cHardwareBase::ProcessBurst(cAvidaContext& ctx, int num_cycles)
+{
+  assert(num_cycles > 0);
+  
+  const cPhenotype& phenotype = m_organism->GetPhenotype();
+  int executed = 0;
+  while (executed < num_cycles) {
+    SingleProcess(ctx);
+    executed++;
+    if (phenotype.GetToDelete()) break;
+  }
+  return executed;
+}
+
+
 bool cHardwareBase::Inst_Nop(cAvidaContext&)          // Do Nothing.
 {
   return true;
@@ -1183,7 +1228,7 @@ bool cHardwareBase::Inst_Nop(cAvidaContext&)          // Do Nothing.
 
 
 // @JEB Check implicit repro conditions -- meant to be called at the end of SingleProcess
-void cHardwareBase::checkImplicitRepro(cAvidaContext& ctx, bool exec_last_inst)         
+void cHardwareBase::checkImplicitRepro(cAvidaContext& ctx, bool exec_last_inst, bool speculative)         
 {  
   //Dividing a dead organism causes all kinds of problems
   if (m_organism->IsDead()) return;
@@ -1194,10 +1239,23 @@ void cHardwareBase::checkImplicitRepro(cAvidaContext& ctx, bool exec_last_inst)
      || (m_world->GetConfig().IMPLICIT_REPRO_END.Get() && exec_last_inst)
      || (m_world->GetConfig().IMPLICIT_REPRO_ENERGY.Get() && (m_organism->GetPhenotype().GetStoredEnergy() >= m_world->GetConfig().IMPLICIT_REPRO_ENERGY.Get())) )
   {
-    Inst_Repro(ctx);
+    // Repro reaches the rest of the population, so a speculative cycle only records it for ResolveSpeculative
+    if (speculative) m_implicit_repro_pending = true;
+    else Inst_Repro(ctx);
   }
 }
 
+// Perform work deferred by speculative execution, once the scheduler has caught up with the speculative window
+void cHardwareBase::ResolveSpeculative(cAvidaContext& ctx)
+{
+  if (!m_implicit_repro_pending) return;
+  
+  m_implicit_repro_pending = false;
+  m_organism->SetRunning(true);
+  Inst_Repro(ctx);
+  m_organism->SetRunning(false);
+}
+
 //This must be overridden by the specific CPU to function properly
 bool cHardwareBase::Inst_Repro(cAvidaContext&) 
 {
@@ -1429,6 +1487,7 @@ void cHardwareBase::SetMiniTrace(const cString& filename)
 {
   m_tracer = HardwareTracerPtr(new cHardwareStatusPrinter(m_world->GetNewWorld(), (const char*)filename, true));
   m_minitrace = true;
+  selectSingleProcess();
 }
 
 void cHardwareBase::RecordMicroTrace(const Instruction& cur_inst)
@@ -1441,6 +1500,7 @@ void cHardwareBase::PrintMicroTrace(int gen_id)
   if (m_microtrace) {
     m_world->GetStats().PrintMicroTraces(m_microtracer, m_organism->GetPhenotype().GetUpdateBorn(), m_organism->GetID(), m_organism->GetForageTarget(), gen_id);
     m_microtrace = false;
+    selectSingleProcess();
   }
 }
 
@@ -1466,6 +1526,7 @@ void cHardwareBase::DeleteMiniTrace(bool print_reacs, bool repro_split)
     
     m_tracer = HardwareTracerPtr(NULL);
     m_minitrace = false;
+    selectSingleProcess();
   }
 }
 
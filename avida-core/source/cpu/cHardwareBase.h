@@ -38,10 +38,12 @@
 class cAvidaContext;
 class cCodeLabel;
 class cCPUMemory;
+class cHardwareCheckpoint;
 class cHeadCPU;
 class cMutation;
 class cOrganism;
 class cString;
+class cTestCPUCheckpoints;
 class cWorld;
 
 using namespace std;
@@ -99,6 +101,8 @@ protected:
   // --------  Base Hardware Feature Support  ---------
   Apto::Array<int, Apto::Smart> m_ext_mem;
   bool m_implicit_repro_active;
+  bool m_implicit_repro_pending;   // implicit repro triggered while speculating, performed by ResolveSpeculative
+  cTestCPUCheckpoints* m_checkpoints;   // set while a test CPU records checkpoints of this hardware's gestation
   
 	// --------  Bit masks  ---------
 	static const unsigned int MASK_SIGNBIT = 0x7FFFFFFF;	
@@ -112,6 +116,17 @@ protected:
 	static const unsigned int MASKOFF_LOWEST8        = 0xFFFFFF00;
 	static const unsigned int MASKOFF_LOWEST4        = 0xFFFFFFF0;
 	
+  // --------  SingleProcess Features  ---------
+  // Hardware may implement SingleProcess as a template over these feature bits.  A variant compiled without a feature
+  // skips its per-cycle checks entirely, so it may only be selected while that feature is not in use.
+  static const int PROCESS_SPECULATIVE = 0x01;  // speculative pre-execution, instructions that must stall are rejected
+  static const int PROCESS_COSTS       = 0x02;  // instruction costs
+  static const int PROCESS_PROMOTERS   = 0x04;  // promoters and constitutive regulation
+  static const int PROCESS_TRACE       = 0x08;  // hardware tracer, micro and navigation traces
+  static const int PROCESS_THREADS     = 0x10;  // multiple threads, resuming a cycle stalled part way
+  static const int PROCESS_ALL         = PROCESS_COSTS | PROCESS_PROMOTERS | PROCESS_TRACE | PROCESS_THREADS;
+  static const int PROCESS_VARIANTS    = (PROCESS_ALL | PROCESS_SPECULATIVE) + 1;  // size of a table indexed by feature bits
+	
   cHardwareBase(); // @not_implemented
   cHardwareBase(const cHardwareBase&); // @not_implemented
   cHardwareBase& operator=(const cHardwareBase&); // @not_implemented
@@ -134,21 +149,41 @@ public:
   // --------  Core Functionality  --------
   void Reset(cAvidaContext& ctx);
   virtual bool SingleProcess(cAvidaContext& ctx, bool speculative = false) = 0;
+  int ProcessBurst(cAvidaContext& ctx, int num_cycles);
+  bool HasSpeculativeRepro() const { return m_implicit_repro_pending; }
+  void ResolveSpeculative(cAvidaContext& ctx);
   virtual void ProcessBonusInst(cAvidaContext& ctx, const Instruction& inst) = 0;
 
   int Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier = 1.0, const int maxmut = INT_MAX);
   bool Divide_TestFitnessMeasures(cAvidaContext& ctx);
   
+  // --------  Recycling  --------
+  // Hardware that supports recycling is pooled by cHardwareManager when its organism dies, and later reinitialized
+  // in place for a new organism using the same instruction set, exactly as if it had been newly constructed.
+  virtual bool SupportsRecycling() const { return false; }
+  virtual void Recycle(cAvidaContext& ctx, cOrganism* in_organism) { (void)ctx; (void)in_organism; assert(false); }
+  
+  // --------  Checkpoints  --------
+  // Hardware that supports checkpoints reports the memory sites each cycle is about to read, and can save and load
+  // its complete state, while a test CPU records the deterministic prefix of a gestation (see cTestCPUCheckpoints).
+  virtual bool SupportsCheckpoints() const { return false; }
+  void SetCheckpoints(cTestCPUCheckpoints* checkpoints) { m_checkpoints = checkpoints; }
+  //! Observe the sites read by the next cycle, returns false if that cycle might depend on anything else.
+  virtual bool ObserveCycle() { return false; }
+  virtual cHardwareCheckpoint* SaveCheckpoint() const { assert(false); return NULL; }
+  virtual void LoadCheckpoint(const cHardwareCheckpoint& checkpoint) { (void)checkpoint; assert(false); }
+  
   // --------  Helper methods  --------
   virtual int GetType() const = 0;
   virtual bool SupportsSpeculative() const = 0;
+  inline bool SupportsConcurrentSpeculation() const;
   virtual void PrintStatus(std::ostream& fp) = 0;
   virtual void PrintMiniTraceStatus(cAvidaContext& ctx, std::ostream& fp) = 0;
   virtual void PrintMiniTraceSuccess(std::ostream& fp, const int exec_success) = 0;
-  void SetTrace(HardwareTracerPtr tracer) { m_tracer = tracer; }
+  void SetTrace(HardwareTracerPtr tracer) { m_tracer = tracer; selectSingleProcess(); }
   void SetMiniTrace(const cString& filename);
-  void SetMicroTrace() { m_microtrace = true; } 
-  void SetTopNavTrace(bool nav_trace) { m_topnavtrace = nav_trace; }
+  void SetMicroTrace() { m_microtrace = true; selectSingleProcess(); } 
+  void SetTopNavTrace(bool nav_trace) { m_topnavtrace = nav_trace; selectSingleProcess(); }
   bool IsTopNavTrace() { return m_topnavtrace; }
   void SetReproTrace(bool repro_trace) { m_reprotrace = repro_trace; }
   bool IsReproTrace() { return m_reprotrace; }
@@ -252,6 +287,8 @@ protected:
   bool IsPayingActiveCost(cAvidaContext& ctx, const int thread_id);
   virtual void internalReset() = 0;
 	virtual void internalResetOnFailedDivide() = 0;
+  //! Called whenever a SingleProcess feature may have been turned on or off, so hardware can pick the matching variant.
+  virtual void selectSingleProcess() { ; }
   
   
   // --------  No-Operation Instruction  --------
@@ -259,8 +296,8 @@ protected:
   
   
   // --------  Implicit Repro Check/Instruction  -------- @JEB
-  inline void CheckImplicitRepro(cAvidaContext& ctx, bool exec_last_inst = false)
-    { if (m_implicit_repro_active) checkImplicitRepro(ctx, exec_last_inst); }
+  inline void CheckImplicitRepro(cAvidaContext& ctx, bool exec_last_inst = false, bool speculative = false)
+    { if (m_implicit_repro_active) checkImplicitRepro(ctx, exec_last_inst, speculative); }
   virtual bool Inst_Repro(cAvidaContext& ctx);
 
   
@@ -284,6 +321,11 @@ protected:
   virtual int calcCopiedSize(const int parent_size, const int child_size) = 0;  
   
   
+  // --------  Recycling Support  --------
+  void loadBaseConfig();
+  void recycleBase(cOrganism* in_organism);
+  
+  
   // --------  Division Support Methods  --------
   bool Divide_CheckViable(cAvidaContext& ctx, const int parent_size, const int child_size, bool using_repro = false);
   unsigned Divide_DoExactMutations(cAvidaContext& ctx, double mut_multiplier = 1.0, const int pointmut = INT_MAX);
@@ -291,8 +333,18 @@ protected:
   
 
 private:
-  void checkImplicitRepro(cAvidaContext& ctx, bool exec_last_inst = false);
+  void checkImplicitRepro(cAvidaContext& ctx, bool exec_last_inst, bool speculative);
 };
 
 
+// Speculative execution on a worker thread must not reach any state shared with other organisms or the world
+inline bool cHardwareBase::SupportsConcurrentSpeculation() const
+{
+  if (!SupportsSpeculative()) return false;
+  if (m_tracer || m_minitrace) return false;
+  if (m_has_res_costs || m_has_fem_res_costs) return false;
+  return (m_task_switching_cost == 0);
+}
+
+
 #endif
@@ -46,6 +46,7 @@
 #include "cStateGrid.h"
 #include "cStringUtil.h"
 #include "cTestCPU.h"
+#include "cTestCPUCheckpoints.h"
 #include "cWorld.h"
 #include "tInstLibEntry.h"
 
@@ -774,23 +775,58 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   m_functions = s_inst_slib->GetFunctions();
   
   m_spec_die = false;
+  m_spec_stall = false;
+  m_spec_stall_inst = 0;
   m_epigenetic_state = false;
   
+  loadConfig();
+  decodeInstSet();
+  
+  // Initialize memory...
+  const Genome& in_genome = in_organism->GetGenome();
+  ConstInstructionSequencePtr in_seq_p;
+  in_seq_p.DynamicCastFrom(in_genome.Representation());
+  m_memory = *in_seq_p;
+  
+  Reset(ctx);                            // Setup the rest of the hardware...
+  internalReset();
+}
+
+void cHardwareCPU::loadConfig()
+{
   m_thread_slicing_parallel = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1);
-  m_no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
   
   m_promoters_enabled = m_world->GetConfig().PROMOTERS_ENABLED.Get();
   m_constitutive_regulation = m_world->GetConfig().CONSTITUTIVE_REGULATION.Get();
   
+  m_process_features = 0;
+  if (m_has_any_costs) m_process_features |= PROCESS_COSTS;
+  if (m_promoters_enabled || m_constitutive_regulation) m_process_features |= PROCESS_PROMOTERS;
+  selectSingleProcess();
+  
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
+}
+
+void cHardwareCPU::Recycle(cAvidaContext& ctx, cOrganism* in_organism)
+{
+  recycleBase(in_organism);
+  
+  // The configuration may have changed while this hardware was pooled.  The decoded instruction set is checked against
+  // the modification count of the instruction set by decodeInst(), so it needs no refresh here.
+  loadConfig();
+  
+  m_spec_die = false;
+  m_spec_stall = false;
+  m_spec_stall_inst = 0;
+  m_epigenetic_state = false;
+  m_epigenetic_saved_stack.Clear();
   
-  // Initialize memory...
   const Genome& in_genome = in_organism->GetGenome();
   ConstInstructionSequencePtr in_seq_p;
   in_seq_p.DynamicCastFrom(in_genome.Representation());
   m_memory = *in_seq_p;
   
-  Reset(ctx);                            // Setup the rest of the hardware...
+  Reset(ctx);
   internalReset();
 }
 
@@ -832,6 +868,8 @@ void cHardwareCPU::internalReset()
   
   m_mal_active = false;
   m_executedmatchstrings = false;
+  m_spec_stall = false;
+  selectSingleProcess();
   
   
   // Promoter model
@@ -879,6 +917,25 @@ void cHardwareCPU::cLocalThread::operator=(const cLocalThread& in_thread)
   m_messageTriggerType = in_thread.m_messageTriggerType;
 }
 
+void cHardwareCPU::cLocalThread::Copy(const cLocalThread& in_thread, cHardwareBase* in_hardware)
+{
+  m_id = in_thread.m_id;
+  m_promoter_inst_executed = in_thread.m_promoter_inst_executed;
+  m_messageTriggerType = in_thread.m_messageTriggerType;
+  
+  for (int i = 0; i < NUM_REGISTERS; i++) reg[i] = in_thread.reg[i];
+  for (int i = 0; i < NUM_HEADS; i++) {
+    heads[i].Reset(in_hardware, in_thread.heads[i].GetMemSpace());
+    heads[i].AbsSet(in_thread.heads[i].GetPosition());
+  }
+  
+  stack = in_thread.stack;
+  cur_stack = in_thread.cur_stack;
+  cur_head = in_thread.cur_head;
+  read_label = in_thread.read_label;
+  next_label = in_thread.next_label;
+}
+
 void cHardwareCPU::cLocalThread::Reset(cHardwareBase* in_hardware, int in_id)
 {
   m_id = in_id;
@@ -907,7 +964,38 @@ void cHardwareCPU::SetupMiniTraceFileHeader(Avida::Output::File& df, const int g
 
 bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
 {
-  assert(!speculative || (speculative && !m_thread_slicing_parallel));
+  return (speculative) ? (this->*m_single_process_spec)(ctx) : (this->*m_single_process)(ctx);
+}
+
+// Every combination of features gets its own variant, so that each one only checks the features actually in use
+const cHardwareCPU::tMethod cHardwareCPU::s_single_process[PROCESS_VARIANTS] = {
+  &cHardwareCPU::singleProcess<0x00>, &cHardwareCPU::singleProcess<0x01>, &cHardwareCPU::singleProcess<0x02>, &cHardwareCPU::singleProcess<0x03>,
+  &cHardwareCPU::singleProcess<0x04>, &cHardwareCPU::singleProcess<0x05>, &cHardwareCPU::singleProcess<0x06>, &cHardwareCPU::singleProcess<0x07>,
+  &cHardwareCPU::singleProcess<0x08>, &cHardwareCPU::singleProcess<0x09>, &cHardwareCPU::singleProcess<0x0A>, &cHardwareCPU::singleProcess<0x0B>,
+  &cHardwareCPU::singleProcess<0x0C>, &cHardwareCPU::singleProcess<0x0D>, &cHardwareCPU::singleProcess<0x0E>, &cHardwareCPU::singleProcess<0x0F>,
+  &cHardwareCPU::singleProcess<0x10>, &cHardwareCPU::singleProcess<0x11>, &cHardwareCPU::singleProcess<0x12>, &cHardwareCPU::singleProcess<0x13>,
+  &cHardwareCPU::singleProcess<0x14>, &cHardwareCPU::singleProcess<0x15>, &cHardwareCPU::singleProcess<0x16>, &cHardwareCPU::singleProcess<0x17>,
+  &cHardwareCPU::singleProcess<0x18>, &cHardwareCPU::singleProcess<0x19>, &cHardwareCPU::singleProcess<0x1A>, &cHardwareCPU::singleProcess<0x1B>,
+  &cHardwareCPU::singleProcess<0x1C>, &cHardwareCPU::singleProcess<0x1D>, &cHardwareCPU::singleProcess<0x1E>, &cHardwareCPU::singleProcess<0x1F>,
+};
+
+// Must be called whenever the configuration, the tracer, the number of threads or a speculative stall changes
+void cHardwareCPU::selectSingleProcess()
+{
+  int features = m_process_features;
+  if (m_tracer) features |= PROCESS_TRACE;
+  if (m_spec_stall || m_threads.GetSize() > 1) features |= PROCESS_THREADS;
+  
+  m_single_process = s_single_process[features];
+  m_single_process_spec = s_single_process[features | PROCESS_SPECULATIVE];
+}
+
+template <int FEATURES> bool cHardwareCPU::singleProcess(cAvidaContext& ctx)
+{
+  const bool speculative = ((FEATURES & PROCESS_SPECULATIVE) != 0);
+  
+  // If speculatively stalled, stay that way until a real instruction comes
+  if (speculative && (m_spec_stall || m_implicit_repro_pending)) return false;
   
   int last_IP_pos = getIP().GetPosition();
   
@@ -922,18 +1010,25 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
   
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
-  // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
-  
-  // Count the cpu cycles used
-  phenotype.IncCPUCyclesUsed();
-  if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed();
-  
-  int num_threads = m_threads.GetSize();
+  int num_threads = (FEATURES & PROCESS_THREADS) ? m_threads.GetSize() : 1;
+  int num_inst_exec = 0;
   
-  // If we have threads turned on and we executed each thread in a single
-  // timestep, adjust the number of instructions executed accordingly.
-  int num_inst_exec = m_thread_slicing_parallel ? num_threads : 1;
+  if ((FEATURES & PROCESS_THREADS) && m_spec_stall) {
+    // Resume the partially executed cycle, it has already been counted
+    m_spec_stall = false;
+    num_inst_exec = m_spec_stall_inst;
+  } else {
+    // First instruction - check whether we should be starting at a promoter, when enabled.
+    if ((FEATURES & PROCESS_PROMOTERS) && phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
+    
+    // Count the cpu cycles used
+    phenotype.IncCPUCyclesUsed();
+    if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed();
+    
+    // If we have threads turned on and we executed each thread in a single
+    // timestep, adjust the number of instructions executed accordingly.
+    num_inst_exec = ((FEATURES & PROCESS_THREADS) && m_thread_slicing_parallel) ? num_threads : 1;
+  }
   
   //  bool isInterruptEnabled(false);
   //  if (m_world->GetConfig().ACTIVE_MESSAGES_ENABLED.Get() == 1)
@@ -953,40 +1048,48 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     
     // Print the status of this CPU at each step...
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this);
+    if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this);
     
     // Find the instruction to be executed
     const Instruction cur_inst = ip.GetInst();
+    const sDecodedInst& decoded = decodeInst(cur_inst);
     
-    if (speculative && (m_spec_die || m_inst_set->ShouldStall(cur_inst))) {
-      // Speculative instruction reject, flush and return
+    if (speculative && (m_spec_die || decoded.stall)) {
       m_cur_thread = last_thread;
-      phenotype.DecCPUCyclesUsed();
-      if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
+      if (i > 0) {
+        // Other threads already executed part of this cycle, stall and let the real call finish it
+        m_spec_stall = true;
+        m_spec_stall_inst = num_inst_exec - i;
+        selectSingleProcess();
+      } else {
+        // Speculative instruction reject, flush and return
+        phenotype.DecCPUCyclesUsed();
+        if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed(-1);
+      }
       m_organism->SetRunning(false);
       return false;
     }
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+    if ((FEATURES & PROCESS_COSTS) && m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
     
     // Constitutive regulation applied here
-    if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+    if ((FEATURES & PROCESS_PROMOTERS) && m_constitutive_regulation) Inst_SenseRegulate(ctx); 
     
     // If there are no active promoters and a certain mode is set, then don't execute any further instructions
-    if (m_promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
+    if ((FEATURES & PROCESS_PROMOTERS) && m_promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
     
     // Now execute the instruction...
     if (exec == true) {
       // NOTE: This call based on the cur_inst must occur prior to instruction
       //       execution, because this instruction reference may be invalid after
       //       certain classes of instructions (namely divide instructions) @DMB
-      const int time_cost = m_inst_set->GetAddlTimeCost(cur_inst);
+      const int time_cost = decoded.addl_time_cost;
       
       // Prob of exec (moved from SingleProcess_PayCosts so that we advance IP after a fail)
-      if (m_inst_set->GetProbFail(cur_inst) > 0.0) {
-        exec = !( ctx.GetRandom().P(m_inst_set->GetProbFail(cur_inst)) );
+      if (decoded.prob_fail > 0.0) {
+        exec = !( ctx.GetRandom().P(decoded.prob_fail) );
       }
       
       // Flag instruction as executed even if it failed (moved from SingleProcess_ExecuteInst)
@@ -996,10 +1099,10 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       getIP().SetFlagExecuted();
       
       // Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if ((FEATURES & PROCESS_PROMOTERS) && m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
-        if (SingleProcess_ExecuteInst(ctx, cur_inst)) { 
+        if (SingleProcess_ExecuteInst(ctx, cur_inst) && (FEATURES & PROCESS_COSTS)) { 
           SingleProcess_PayPostResCosts(ctx, cur_inst); 
           SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
         }
@@ -1016,7 +1119,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if ((FEATURES & PROCESS_PROMOTERS) && m_promoters_enabled) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) Inst_Terminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() && (m_threads[m_cur_thread].GetPromoterInstExecuted() >= m_world->GetConfig().PROMOTER_INST_MAX.Get())) 
@@ -1050,7 +1153,9 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
   if (!speculative && phenotype.GetToDelete()) m_spec_die = true;
   
   // Note: if organism just died, this will NOT let it repro.
-  CheckImplicitRepro(ctx, last_IP_pos > m_threads[m_cur_thread].heads[nHardware::HEAD_IP].GetPosition());
+  if (!m_spec_die || !speculative) {
+    CheckImplicitRepro(ctx, last_IP_pos > m_threads[m_cur_thread].heads[nHardware::HEAD_IP].GetPosition(), speculative);
+  }
   
   m_organism->SetRunning(false);
   
@@ -1065,13 +1170,13 @@ bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instructi
   Instruction actual_inst = cur_inst;
   
   // Get a pointer to the corresponding method...
-  int inst_idx = m_inst_set->GetLibFunctionIndex(actual_inst);
+  const tMethod method = decodeInst(actual_inst).method;
   
   // instruction execution count incremented
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
 	
   // And execute it.
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  const bool exec_success = (this->*method)(ctx);
   
   // NOTE: Organism may be dead now if instruction executed killed it (such as some divides, "die", or "explode")
   
@@ -1094,6 +1199,135 @@ bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instructi
 }
 
 
+// Resolve every instruction in the instruction set to its method, failure probability, time cost, stall and checkpoint
+// flags, so that executing an instruction needs a single table lookup by op.  Memory holds instruction ops, so nothing here
+// has to be refreshed when memory is written; decodeInst() rebuilds the table whenever the instruction set is modified.
+void cHardwareCPU::decodeInstSet()
+{
+  // Instructions that only touch the registers, heads, stacks and memory of this hardware and never draw random
+  // numbers, so that a test CPU may record checkpoints across them (see ObserveCycle)
+  static const tMethod checkpoint_methods[] = {
+    &cHardwareCPU::Inst_Nop, &cHardwareCPU::Inst_IfNEqu, &cHardwareCPU::Inst_IfLess, &cHardwareCPU::Inst_IfLabel,
+    &cHardwareCPU::Inst_MoveHead, &cHardwareCPU::Inst_JumpHead, &cHardwareCPU::Inst_GetHead, &cHardwareCPU::Inst_SetFlow,
+    &cHardwareCPU::Inst_ShiftR, &cHardwareCPU::Inst_ShiftL, &cHardwareCPU::Inst_Inc, &cHardwareCPU::Inst_Dec,
+    &cHardwareCPU::Inst_Push, &cHardwareCPU::Inst_Pop, &cHardwareCPU::Inst_SwitchStack, &cHardwareCPU::Inst_Swap,
+    &cHardwareCPU::Inst_Add, &cHardwareCPU::Inst_Sub, &cHardwareCPU::Inst_Nand,
+    &cHardwareCPU::Inst_HeadCopy, &cHardwareCPU::Inst_MaxAlloc, &cHardwareCPU::Inst_HeadSearch
+  };
+  const int num_checkpoint_methods = sizeof(checkpoint_methods) / sizeof(tMethod);
+  
+  const int num_insts = m_inst_set->GetSize();
+  m_decoded.ResizeClear(num_insts);
+  m_decoded_mod_count = m_inst_set->GetModCount();
+  for (int i = 0; i < num_insts; i++) {
+    const Instruction inst(i);
+    m_decoded[i].method = m_functions[m_inst_set->GetLibFunctionIndex(inst)];
+    m_decoded[i].prob_fail = m_inst_set->GetProbFail(inst);
+    m_decoded[i].addl_time_cost = m_inst_set->GetAddlTimeCost(inst);
+    m_decoded[i].stall = m_inst_set->ShouldStall(inst);
+    
+    m_decoded[i].checkpoint = false;
+    for (int j = 0; j < num_checkpoint_methods; j++) {
+      if (m_decoded[i].method == checkpoint_methods[j]) m_decoded[i].checkpoint = true;
+    }
+  }
+  
+  // Allocated space is only left blank (rather than filled from the dead or random instructions) with the default method
+  if (m_world->GetConfig().ALLOC_METHOD.Get() != ALLOC_METHOD_DEFAULT) {
+    for (int i = 0; i < num_insts; i++) if (m_decoded[i].method == &cHardwareCPU::Inst_MaxAlloc) m_decoded[i].checkpoint = false;
+  }
+}
+
+
+// --------  Checkpoints  --------
+
+class cHardwareCPU::cCheckpoint : public cHardwareCheckpoint
+{
+public:
+  cCPUMemory memory;
+  cCPUStack global_stack;
+  Apto::Array<cLocalThread> threads;
+  int thread_id_chart;
+  int cur_thread;
+  bool mal_active;
+  bool advance_ip;
+  bool executedmatchstrings;
+  
+  cCheckpoint(const cCPUMemory& in_memory) : memory(in_memory) { ; }
+};
+
+
+// Observe the sites the next cycle reads, for the test CPU recording checkpoints of this gestation.  Only the common
+// configuration is covered (a single thread, no costs, tracing, promoters, implicit reproduction or copy mutations),
+// in which a cycle executing an instruction flagged checkpoint depends on nothing but the state of this hardware.
+bool cHardwareCPU::ObserveCycle()
+{
+  assert(m_checkpoints != NULL);
+  
+  if (m_tracer || m_minitrace || m_has_any_costs || m_implicit_repro_active) return false;
+  if (m_promoters_enabled || m_constitutive_regulation || m_spec_stall || m_threads.GetSize() != 1) return false;
+  
+  const cMutationRates& mut_rates = m_organism->MutationRates();
+  if (mut_rates.GetCopyMutProb() > 0.0 || mut_rates.GetCopyInsProb() > 0.0 || mut_rates.GetCopyDelProb() > 0.0 ||
+      mut_rates.GetCopyUniformProb() > 0.0 || mut_rates.GetCopySlipProb() > 0.0) {
+    return false;
+  }
+  
+  cHeadCPU ip(m_threads[0].heads[nHardware::HEAD_IP]);
+  ip.Adjust();
+  const sDecodedInst& decoded = decodeInst(ip.GetInst());
+  if (!decoded.checkpoint || decoded.stall || decoded.prob_fail > 0.0) return false;
+  
+  // The instruction executed, plus the sites its modifiers and label may be read from...
+  const int mem_size = m_memory.GetSize();
+  m_checkpoints->ObserveSite(ip.GetPosition());
+  for (int i = 1; i <= cCodeLabel::MAX_LENGTH + 1; i++) m_checkpoints->ObserveLabelSite((ip.GetPosition() + i) % mem_size);
+  
+  // ...and the sites under the copy heads (label searches are observed by FindLabel)
+  cHeadCPU read_head(m_threads[0].heads[nHardware::HEAD_READ]);
+  cHeadCPU write_head(m_threads[0].heads[nHardware::HEAD_WRITE]);
+  read_head.Adjust();
+  write_head.Adjust();
+  m_checkpoints->ObserveSite(read_head.GetPosition());
+  m_checkpoints->ObserveSite(write_head.GetPosition());
+  
+  return true;
+}
+
+cHardwareCheckpoint* cHardwareCPU::SaveCheckpoint() const
+{
+  cCheckpoint* checkpoint = new cCheckpoint(m_memory);
+  checkpoint->global_stack = m_global_stack;
+  checkpoint->threads.Resize(m_threads.GetSize());
+  for (int i = 0; i < m_threads.GetSize(); i++) checkpoint->threads[i].Copy(m_threads[i], NULL);
+  checkpoint->thread_id_chart = m_thread_id_chart;
+  checkpoint->cur_thread = m_cur_thread;
+  checkpoint->mal_active = m_mal_active;
+  checkpoint->advance_ip = m_advance_ip;
+  checkpoint->executedmatchstrings = m_executedmatchstrings;
+  
+  return checkpoint;
+}
+
+void cHardwareCPU::LoadCheckpoint(const cHardwareCheckpoint& checkpoint)
+{
+  const cCheckpoint& saved = static_cast<const cCheckpoint&>(checkpoint);
+  
+  m_memory = saved.memory;
+  m_global_stack = saved.global_stack;
+  m_threads.Resize(saved.threads.GetSize());
+  for (int i = 0; i < m_threads.GetSize(); i++) m_threads[i].Copy(saved.threads[i], this);
+  m_thread_id_chart = saved.thread_id_chart;
+  m_cur_thread = saved.cur_thread;
+  m_mal_active = saved.mal_active;
+  m_advance_ip = saved.advance_ip;
+  m_executedmatchstrings = saved.executedmatchstrings;
+  m_spec_stall = false;
+  m_spec_die = false;
+  selectSingleProcess();
+}
+
+
 void cHardwareCPU::ProcessBonusInst(cAvidaContext& ctx, const Instruction& inst)
 {
   // Mark this organism as running...
@@ -1188,20 +1422,28 @@ cHeadCPU cHardwareCPU::FindLabel(int direction)
     return inst_ptr;
   }
   
-  // Call special functions depending on if jump is forwards or backwards.
+  // Search the memory label index depending on if jump is forwards or backwards.
   int found_pos = 0;
   if ( direction < 0 ) {
-    found_pos = FindLabel_Backward(search_label, m_memory, inst_ptr.GetPosition() - search_label.GetSize());
+    found_pos = m_memory.FindLabelBackward(search_label, *m_inst_set, inst_ptr.GetPosition() - search_label.GetSize());
   }
   
   // Jump forward.
   else if (direction > 0) {
-    found_pos = FindLabel_Forward(search_label, m_memory, inst_ptr.GetPosition());
+    found_pos = m_memory.FindLabelForward(search_label, *m_inst_set, inst_ptr.GetPosition());
   }
   
   // Jump forward from the very beginning.
   else {
-    found_pos = FindLabel_Forward(search_label, m_memory, 0);
+    found_pos = m_memory.FindLabelForward(search_label, *m_inst_set, 0);
+  }
+  
+  // While checkpoints are recorded, observe every site the search depended on.  Forward searches examine the sites up to
+  // and including the one following the label, or to the end of memory if it was not found.
+  if (m_checkpoints) {
+    const int scan_begin = (direction > 0) ? inst_ptr.GetPosition() : 0;
+    const int scan_end = (direction < 0 || found_pos < 0) ? m_memory.GetSize() : found_pos + 1;
+    for (int i = scan_begin; i < scan_end; i++) m_checkpoints->ObserveLabelSite(i);
   }
   
   // Return the last line of the found label, if it was found.
@@ -1212,166 +1454,6 @@ cHeadCPU cHardwareCPU::FindLabel(int direction)
 }
 
 
-// Search forwards for search_label from _after_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-
-int cHardwareCPU::FindLabel_Forward(const cCodeLabel & search_label,
-                                    const InstructionSequence & search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize() && pos >= 0);
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos += label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos < search_genome.GetSize()) {
-    
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop(search_genome[pos])) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > search_start &&
-             m_inst_set->IsNop( search_genome[start_pos - 1] )) {
-        start_pos--;
-      }
-      while (end_pos < search_genome.GetSize() &&
-             m_inst_set->IsNop( search_genome[end_pos] )) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      int offset = start_pos;
-      for (offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod( search_genome[offset + matches] )) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        // pos = end_pos;
-        pos = label_size + offset;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just after the current label being
-      // checked.
-      pos = end_pos;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos += label_size;
-  }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
-}
-
-// Search backwards for search_label from _before_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-
-int cHardwareCPU::FindLabel_Backward(const cCodeLabel & search_label,
-                                     const InstructionSequence & search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize());
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos -= label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos >= 0) {
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop( search_genome[pos] )) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > 0 && m_inst_set->IsNop(search_genome[start_pos - 1])) {
-        start_pos--;
-      }
-      while (end_pos < search_start &&
-             m_inst_set->IsNop(search_genome[end_pos])) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      for (int offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod(search_genome[offset + matches])) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        pos = end_pos;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just before the current label
-      // being checked.
-      pos = start_pos - 1;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos -= label_size;
-  }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
-}
-
 // Search for 'in_label' anywhere in the hardware.
 cHeadCPU cHardwareCPU::FindLabel(const cCodeLabel & in_label, int direction)
 {
@@ -1509,6 +1591,7 @@ bool cHardwareCPU::ForkThread()
   
   // Make room for the new thread.
   m_threads.Resize(num_threads + 1);
+  selectSingleProcess();
   
   // Initialize the new thread to the same values as the current one.
   m_threads[num_threads] = m_threads[m_cur_thread];
@@ -1609,6 +1692,7 @@ bool cHardwareCPU::KillThread()
   
   // Kill the thread!
   m_threads.Resize(m_threads.GetSize() - 1);
+  selectSingleProcess();
   
   if (m_cur_thread > kill_thread) m_cur_thread--;
 	
@@ -5119,7 +5203,8 @@ bool cHardwareCPU::Inst_DonateEditDist(cAvidaContext& ctx)
         neighbor_seq_p.DynamicCastFrom(neighbor_genome.Representation());
         const InstructionSequence& neighbor_seq = *neighbor_seq_p;
         
-        edit_dist = InstructionSequence::FindEditDistance(org_seq, neighbor_seq);
+        // Only whether the neighbor is within max_dist matters here, so stop once it cannot be
+        edit_dist = InstructionSequence::FindEditDistance(org_seq, neighbor_seq, max_dist);
       }
       if (edit_dist <= max_dist) {
         found = true;
@@ -85,6 +85,8 @@ protected:
     ~cLocalThread() { ; }
 
     void operator=(const cLocalThread& in_thread);
+    //! Copy the complete state of in_thread (operator= skips the labels and stack selection), binding the heads to in_hardware.
+    void Copy(const cLocalThread& in_thread, cHardwareBase* in_hardware);
 
     void Reset(cHardwareBase* in_hardware, int in_id);
     int GetID() const { return m_id; }
@@ -95,6 +97,8 @@ protected:
     void setMessageTriggerType(int value) { m_messageTriggerType = value; }
     int getMessageTriggerType() { return m_messageTriggerType; }
   };
+  
+  class cCheckpoint;
 
 
   // --------  Static Variables  --------
@@ -105,12 +109,28 @@ protected:
   // --------  Member Variables  --------
   const tMethod* m_functions;
 
+  // Instruction set entries needed on every cycle, resolved once and indexed by instruction op (see decodeInstSet)
+  struct sDecodedInst
+  {
+    tMethod method;
+    double prob_fail;
+    int addl_time_cost;
+    bool stall;
+    bool checkpoint;      // only touches the hardware and never draws random numbers (see ObserveCycle)
+  };
+  Apto::Array<sDecodedInst> m_decoded;
+  int m_decoded_mod_count;      // instruction set modification count m_decoded was built from
+
   cCPUMemory m_memory;          // Memory...
   cCPUStack m_global_stack;     // A stack that all threads share.
 
   Apto::Array<cLocalThread> m_threads;
   int m_thread_id_chart;
   int m_cur_thread;
+  int m_spec_stall_inst;        // thread instructions left in a cycle stalled mid-way by speculation
+  int m_process_features;       // SingleProcess features required by the configuration of this hardware
+  tMethod m_single_process;     // singleProcess variant for the features currently in use (see selectSingleProcess)
+  tMethod m_single_process_spec;
 
   // Flags...
   struct {
@@ -118,9 +138,9 @@ protected:
     bool m_advance_ip:1;         // Should the IP advance after this instruction?
     bool m_executedmatchstrings:1;	// Have we already executed the match strings instruction?
     bool m_spec_die:1;
+    bool m_spec_stall:1;
 
     bool m_thread_slicing_parallel:1;
-    bool m_no_cpu_cycle_time:1;
 
     bool m_promoters_enabled:1;
     bool m_constitutive_regulation:1;
@@ -153,7 +173,13 @@ protected:
   // Epigenetic State -->
 
 
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx);
+  static const tMethod s_single_process[PROCESS_VARIANTS];
+  void selectSingleProcess();
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst);
+  void loadConfig();
+  void decodeInstSet();
+  inline const sDecodedInst& decodeInst(const Instruction& inst);
   
   // --------  Stack Manipulation...  --------
   inline void StackPush(int value);
@@ -173,8 +199,6 @@ protected:
   cCodeLabel& GetLabel() { return m_threads[m_cur_thread].next_label; }
   void ReadLabel(int max_size=cCodeLabel::MAX_LENGTH);
   cHeadCPU FindLabel(int direction);
-  int FindLabel_Forward(const cCodeLabel & search_label, const InstructionSequence& search_genome, int pos);
-  int FindLabel_Backward(const cCodeLabel & search_label, const InstructionSequence& search_genome, int pos);
   cHeadCPU FindLabel(const cCodeLabel & in_label, int direction);
   void FindLabelInMemory(const cCodeLabel& label, cHeadCPU& search_head);
 
@@ -248,6 +272,12 @@ public:
   // --------  Helper methods  --------
   int GetType() const { return HARDWARE_TYPE_CPU_ORIGINAL; }  
   bool SupportsSpeculative() const { return true; }
+  bool SupportsRecycling() const { return true; }
+  void Recycle(cAvidaContext& ctx, cOrganism* in_organism);
+  bool SupportsCheckpoints() const { return true; }
+  bool ObserveCycle();
+  cHardwareCheckpoint* SaveCheckpoint() const;
+  void LoadCheckpoint(const cHardwareCheckpoint& checkpoint);
   void PrintStatus(std::ostream& fp);
   void SetupMiniTraceFileHeader(Avida::Output::File& df, const int gen_id, const Apto::String& genotype);
   void PrintMiniTraceStatus(cAvidaContext& ctx, std::ostream& fp) { (void)ctx, (void)fp; }
@@ -1093,6 +1123,13 @@ inline void cHardwareCPU::StackFlip()
   }
 }
 
+inline const cHardwareCPU::sDecodedInst& cHardwareCPU::decodeInst(const Instruction& inst)
+{
+  // The instruction set may have been modified (such as by SetProbFail or activating the null instruction) since it was decoded
+  if (m_decoded_mod_count != m_inst_set->GetModCount() || inst.GetOp() >= m_decoded.GetSize()) decodeInstSet();
+  return m_decoded[inst.GetOp()];
+}
+
 inline int cHardwareCPU::GetStack(int depth, int stack_id, int in_thread) const
 {
   int value = 0;
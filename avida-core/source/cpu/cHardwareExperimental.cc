@@ -439,6 +439,8 @@ cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world,
   m_functions = s_inst_slib->GetFunctions();
   
   m_spec_die = false;
+  m_spec_stall = false;
+  m_spec_stall_inst = 0;
   
   m_thread_slicing_parallel = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1);
   m_no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
@@ -449,6 +451,11 @@ cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world,
     m_no_active_promoter_halt = (m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2);
   }
   
+  m_process_features = 0;
+  if (m_has_any_costs) m_process_features |= PROCESS_COSTS;
+  if (m_promoters_enabled) m_process_features |= PROCESS_PROMOTERS;
+  selectSingleProcess();
+  
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
   const Genome& in_genome = in_organism->GetGenome();
@@ -480,6 +487,8 @@ void cHardwareExperimental::internalReset()
   
   m_mal_active = false;
   m_executedmatchstrings = false;
+  m_spec_stall = false;
+  selectSingleProcess();
   
   // Promoter model
   if (m_promoters_enabled) {
@@ -561,7 +570,38 @@ void cHardwareExperimental::cLocalThread::Reset(cHardwareExperimental* in_hardwa
 
 bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
 {
-  assert(!speculative || (speculative && !m_thread_slicing_parallel));
+  return (speculative) ? (this->*m_single_process_spec)(ctx) : (this->*m_single_process)(ctx);
+}
+
+// Every combination of features gets its own variant, so that each one only checks the features actually in use
+const cHardwareExperimental::tMethod cHardwareExperimental::s_single_process[PROCESS_VARIANTS] = {
+  &cHardwareExperimental::singleProcess<0x00>, &cHardwareExperimental::singleProcess<0x01>, &cHardwareExperimental::singleProcess<0x02>, &cHardwareExperimental::singleProcess<0x03>,
+  &cHardwareExperimental::singleProcess<0x04>, &cHardwareExperimental::singleProcess<0x05>, &cHardwareExperimental::singleProcess<0x06>, &cHardwareExperimental::singleProcess<0x07>,
+  &cHardwareExperimental::singleProcess<0x08>, &cHardwareExperimental::singleProcess<0x09>, &cHardwareExperimental::singleProcess<0x0A>, &cHardwareExperimental::singleProcess<0x0B>,
+  &cHardwareExperimental::singleProcess<0x0C>, &cHardwareExperimental::singleProcess<0x0D>, &cHardwareExperimental::singleProcess<0x0E>, &cHardwareExperimental::singleProcess<0x0F>,
+  &cHardwareExperimental::singleProcess<0x10>, &cHardwareExperimental::singleProcess<0x11>, &cHardwareExperimental::singleProcess<0x12>, &cHardwareExperimental::singleProcess<0x13>,
+  &cHardwareExperimental::singleProcess<0x14>, &cHardwareExperimental::singleProcess<0x15>, &cHardwareExperimental::singleProcess<0x16>, &cHardwareExperimental::singleProcess<0x17>,
+  &cHardwareExperimental::singleProcess<0x18>, &cHardwareExperimental::singleProcess<0x19>, &cHardwareExperimental::singleProcess<0x1A>, &cHardwareExperimental::singleProcess<0x1B>,
+  &cHardwareExperimental::singleProcess<0x1C>, &cHardwareExperimental::singleProcess<0x1D>, &cHardwareExperimental::singleProcess<0x1E>, &cHardwareExperimental::singleProcess<0x1F>,
+};
+
+// Must be called whenever the configuration, a trace, the number of threads or a speculative stall changes
+void cHardwareExperimental::selectSingleProcess()
+{
+  int features = m_process_features;
+  if (m_tracer || m_microtrace || m_topnavtrace) features |= PROCESS_TRACE;
+  if (m_spec_stall || m_threads.GetSize() > 1) features |= PROCESS_THREADS;
+  
+  m_single_process = s_single_process[features];
+  m_single_process_spec = s_single_process[features | PROCESS_SPECULATIVE];
+}
+
+template <int FEATURES> bool cHardwareExperimental::singleProcess(cAvidaContext& ctx)
+{
+  const bool speculative = ((FEATURES & PROCESS_SPECULATIVE) != 0);
+  
+  // If speculatively stalled, stay that way until a real instruction comes
+  if (speculative && (m_spec_stall || m_implicit_repro_pending)) return false;
   
   // Mark this organism as running...
   m_organism->SetRunning(true);
@@ -574,17 +614,25 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
-  // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) PromoterTerminate(ctx);
-  
-  m_cycle_count++;
-  assert(m_cycle_count < 0x8000);
-  phenotype.IncCPUCyclesUsed();
-  if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed();
+  int num_inst_exec = 0;
   
-  // If we have threads turned on and we executed each thread in a single
-  // timestep, adjust the number of instructions executed accordingly.
-  const int num_inst_exec = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1) ? m_threads.GetSize() : 1;
+  if ((FEATURES & PROCESS_THREADS) && m_spec_stall) {
+    // Resume the partially executed cycle, it has already been counted
+    m_spec_stall = false;
+    num_inst_exec = m_spec_stall_inst;
+  } else {
+    // First instruction - check whether we should be starting at a promoter, when enabled.
+    if ((FEATURES & PROCESS_PROMOTERS) && phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) PromoterTerminate(ctx);
+    
+    m_cycle_count++;
+    assert(m_cycle_count < 0x8000);
+    phenotype.IncCPUCyclesUsed();
+    if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed();
+    
+    // If we have threads turned on and we executed each thread in a single
+    // timestep, adjust the number of instructions executed accordingly.
+    num_inst_exec = ((FEATURES & PROCESS_THREADS) && m_thread_slicing_parallel) ? m_threads.GetSize() : 1;
+  }
   
   int num_active = 0;
   for (int i = 0; i < m_threads.GetSize(); i++) {
@@ -615,22 +663,30 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       <<  " cell: " << m_organism->GetOrgInterface().GetAVCellID() << endl; */
 
     // Print the status of this CPU at each step...
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this);
+    if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this);
     
     // Find the instruction to be executed
     const Instruction cur_inst = ip.GetInst();
     
     if (speculative && (m_spec_die || m_inst_set->ShouldStall(cur_inst))) {
-      // Speculative instruction reject, flush and return
       m_cur_thread = last_thread;
-      phenotype.DecCPUCyclesUsed();
-      if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
+      if (i > 0) {
+        // Other threads already executed part of this cycle, stall and let the real call finish it
+        m_spec_stall = true;
+        m_spec_stall_inst = num_inst_exec - i;
+        selectSingleProcess();
+      } else {
+        // Speculative instruction reject, flush and return
+        m_cycle_count--;
+        phenotype.DecCPUCyclesUsed();
+        if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
+      }
       m_organism->SetRunning(false);
       return false;
     }
     
     // Print the short form status of this CPU at each step... 
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
+    if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
@@ -638,11 +694,11 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     // record any failure due to costs being paid
     // before we try to execute the instruction, is this org currently paying precosts for it
-    bool on_pause = IsPayingActiveCost(ctx, m_cur_thread);
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);    
+    bool on_pause = (FEATURES & PROCESS_COSTS) && IsPayingActiveCost(ctx, m_cur_thread);
+    if ((FEATURES & PROCESS_COSTS) && m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);    
     if (!exec) exec_success = -1;
 
-    if (m_promoters_enabled) {
+    if ((FEATURES & PROCESS_PROMOTERS) && m_promoters_enabled) {
       // Constitutive regulation applied here
       if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
       
@@ -665,19 +721,21 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
       
       //Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if ((FEATURES & PROCESS_PROMOTERS) && m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
         if (SingleProcess_ExecuteInst(ctx, cur_inst)) {
-          SingleProcess_PayPostResCosts(ctx, cur_inst); 
-          SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          if (FEATURES & PROCESS_COSTS) {
+            SingleProcess_PayPostResCosts(ctx, cur_inst); 
+            SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          }
           // record execution success
           exec_success = 1;
         }
       }
       // Check if the instruction just executed caused premature death, break out of execution if so
       if (phenotype.GetToDelete()) {
-        if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+        if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
         break;
       }
       
@@ -689,7 +747,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(addl_time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if ((FEATURES & PROCESS_PROMOTERS) && m_promoters_enabled) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) PromoterTerminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() &&
@@ -699,7 +757,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
     }
     // if using mini traces, report success or failure of execution
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+    if ((FEATURES & PROCESS_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
     
     bool do_record = false;
     // record exec failed if the org just now started paying precosts
@@ -714,7 +772,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
     if (do_record) {
       // this will differ from time used 
       phenotype.IncNumExecs();
-      if (m_microtrace || m_topnavtrace) {
+      if ((FEATURES & PROCESS_TRACE) && (m_microtrace || m_topnavtrace)) {
         RecordMicroTrace(cur_inst);
         if (m_topnavtrace) RecordNavTrace(m_use_avatar);      
       }
@@ -730,7 +788,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   if (!speculative && phenotype.GetToDelete()) m_spec_die = true;
   
   m_organism->SetRunning(false);
-  CheckImplicitRepro(ctx);
+  if (!m_spec_die || !speculative) CheckImplicitRepro(ctx, false, speculative);
   
   return !m_spec_die;
 }
@@ -1320,6 +1378,7 @@ bool cHardwareExperimental::ForkThread()
   
   // Make room for the new thread.
   m_threads.Resize(num_threads + 1);
+  selectSingleProcess();
   
   // Initialize the new thread to the same values as the current one.
   assert(m_threads[m_cur_thread].active);
@@ -1342,6 +1401,7 @@ bool cHardwareExperimental::ThreadCreate(const cHeadCPU& start_pos)
   
   // Make room for the new thread.
   m_threads.Resize(thread_id + 1);
+  selectSingleProcess();
   
   // Find the first free bit in m_thread_id_chart to determine the new
   // thread id.
@@ -1376,6 +1436,7 @@ bool cHardwareExperimental::ExitThread()
   
   // Kill the thread!
   m_threads.Resize(m_threads.GetSize() - 1);
+  selectSingleProcess();
   
   if (m_cur_thread > kill_thread) m_cur_thread--;
   
@@ -193,6 +193,10 @@ private:
   Apto::Array<cLocalThread, Apto::ManagedPointer> m_threads;
   int m_thread_id_chart;
   int m_cur_thread;
+  int m_spec_stall_inst;        // thread instructions left in a cycle stalled mid-way by speculation
+  int m_process_features;       // SingleProcess features required by the configuration of this hardware
+  tMethod m_single_process;     // singleProcess variant for the features currently in use (see selectSingleProcess)
+  tMethod m_single_process_spec;
   
   int m_use_avatar;
   cOrgSensor m_sensor;
@@ -210,6 +214,7 @@ private:
     bool m_advance_ip:1;         // Should the IP advance after this instruction?
     bool m_executedmatchstrings:1;	// Have we already executed the match strings instruction?
     bool m_spec_die:1;
+    bool m_spec_stall:1;
     
     bool m_thread_slicing_parallel:1;
     bool m_no_cpu_cycle_time:1;
@@ -307,6 +312,9 @@ public:
 private:
   
   // --------  Core Execution Methods  --------
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx);
+  static const tMethod s_single_process[PROCESS_VARIANTS];
+  void selectSingleProcess();
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst);
   void internalReset();
   void internalResetOnFailedDivide();
@@ -390,7 +390,7 @@ void cHardwareGP8::Thread::Reset(cHardwareGP8* in_hardware, const Head& start_po
 bool cHardwareGP8::SingleProcess(cAvidaContext& ctx, bool speculative)
 {
   // If speculatively stalled, stay that way until a real instruction comes
-  if (speculative && m_spec_stall) return false;
+  if (speculative && (m_spec_stall || m_implicit_repro_pending)) return false;
   
   
   // Mark this organism as running...
@@ -602,7 +602,7 @@ bool cHardwareGP8::SingleProcess(cAvidaContext& ctx, bool speculative)
   if (!speculative && phenotype.GetToDelete()) m_spec_die = true;
   
   m_organism->SetRunning(false);
-  CheckImplicitRepro(ctx);
+  if (!m_spec_die || !speculative) CheckImplicitRepro(ctx, false, speculative);
   
   return !m_spec_die && !m_spec_stall;
 }
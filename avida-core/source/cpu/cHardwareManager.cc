@@ -34,6 +34,7 @@
 #include "cHardwareStatusPrinter.h"
 #include "cInitFile.h"
 #include "cInstSet.h"
+#include "cStats.h"
 #include "cStringList.h"
 #include "cStringUtil.h"
 #include "cWorld.h"
@@ -43,7 +44,7 @@ using namespace Avida;
 static const Apto::BasicString<Apto::ThreadSafe> s_prop_id_instset("instset");
 
 cHardwareManager::cHardwareManager(cWorld* world)
-: m_world(world)
+: m_world(world), m_hw_pool_size(world->GetConfig().HARDWARE_POOL_SIZE.Get())
 {
   cString filename = world->GetConfig().INST_SET.Get();
   m_is_name_map.Set("(default)", 0);
@@ -52,6 +53,10 @@ cHardwareManager::cHardwareManager(cWorld* world)
 
 cHardwareManager::~cHardwareManager()
 {
+  for (int i = 0; i < m_hw_pools.GetSize(); i++) {
+    for (int j = 0; j < m_hw_pools[i].GetSize(); j++) delete m_hw_pools[i][j];
+  }
+  for (int i = 0; i < m_test_cpu_pool.GetSize(); i++) delete m_test_cpu_pool[i];
   for (int i = 0; i < m_inst_sets.GetSize(); i++) delete m_inst_sets[i];
 }
 
@@ -256,6 +261,24 @@ cHardwareBase* cHardwareManager::Create(cAvidaContext& ctx, cOrganism* org, cons
   }
   
   cHardwareBase* hw = 0;
+  
+  // Reuse released hardware for this instruction set when available, keeping its memory and array capacities
+  m_hw_pool_mutex.Lock();
+  if (inst_set_id < m_hw_pools.GetSize() && m_hw_pools[inst_set_id].GetSize()) {
+    Apto::Array<cHardwareBase*>& pool = m_hw_pools[inst_set_id];
+    hw = pool[pool.GetSize() - 1];
+    pool.Resize(pool.GetSize() - 1);
+  }
+  // Test CPU organisms are counted apart, so that analysis and test runs do not skew the population's pool stats
+  if (ctx.GetTestMode()) m_world->GetStats().AddTestHardwarePoolRequest(hw != 0);
+  else m_world->GetStats().AddHardwarePoolRequest(hw != 0);
+  m_hw_pool_mutex.Unlock();
+  
+  if (hw) {
+    hw->Recycle(ctx, org);
+    return hw;
+  }
+  
   switch (inst_set->GetHardwareType()) {
     case HARDWARE_TYPE_CPU_ORIGINAL:
       hw = new cHardwareCPU(ctx, m_world, org, inst_set);
@@ -282,6 +305,61 @@ cHardwareBase* cHardwareManager::Create(cAvidaContext& ctx, cOrganism* org, cons
   return hw;
 }
 
+void cHardwareManager::Release(cHardwareBase* hw)
+{
+  if (hw == NULL) return;
+  if (!hw->SupportsRecycling()) {
+    delete hw;
+    return;
+  }
+  
+  int inst_set_id = 0;
+  while (inst_set_id < m_inst_sets.GetSize() && m_inst_sets[inst_set_id] != &hw->GetInstSet()) inst_set_id++;
+  if (inst_set_id == m_inst_sets.GetSize()) {
+    delete hw;
+    return;
+  }
+  
+  // Drop the tracer now, so that any trace output is finished as it would be when the hardware is deleted
+  hw->SetTrace(HardwareTracerPtr(NULL));
+  
+  m_hw_pool_mutex.Lock();
+  if (inst_set_id >= m_hw_pools.GetSize()) m_hw_pools.Resize(inst_set_id + 1);
+  if (m_hw_pools[inst_set_id].GetSize() < m_hw_pool_size) {
+    m_hw_pools[inst_set_id].Push(hw);
+    hw = NULL;
+  }
+  m_hw_pool_mutex.Unlock();
+  
+  // The pool is full, release the hardware outside of the lock
+  delete hw;
+}
+
+cTestCPU* cHardwareManager::AcquireTestCPU(cAvidaContext& ctx)
+{
+  cTestCPU* test_cpu = NULL;
+  
+  m_test_cpu_pool_mutex.Lock();
+  if (m_test_cpu_pool.GetSize()) {
+    test_cpu = m_test_cpu_pool[m_test_cpu_pool.GetSize() - 1];
+    m_test_cpu_pool.Resize(m_test_cpu_pool.GetSize() - 1);
+  }
+  m_test_cpu_pool_mutex.Unlock();
+  
+  if (!test_cpu) return new cTestCPU(ctx, m_world);
+  
+  test_cpu->Reset(ctx);
+  return test_cpu;
+}
+
+void cHardwareManager::ReleaseTestCPU(cTestCPU* test_cpu)
+{
+  if (test_cpu == NULL) return;
+  
+  Apto::MutexAutoLock lock(m_test_cpu_pool_mutex);
+  m_test_cpu_pool.Push(test_cpu);
+}
+
 bool cHardwareManager::RegisterInstSet(const Apto::String& name, cInstSet* inst_set)
 {
   if (m_is_name_map.Has(name)) return false;
@@ -22,6 +22,8 @@
 #ifndef cHardwareManager_h
 #define cHardwareManager_h
 
+#include "apto/core/Mutex.h"
+
 #include "cTestCPU.h"
 
 namespace Avida {
@@ -47,6 +49,15 @@ private:
   Apto::Array<cInstSet*> m_inst_sets;
   Apto::Map<Apto::String, int> m_is_name_map;
 
+  // Released hardware kept for reuse by later organisms, one pool of at most m_hw_pool_size per instruction set
+  Apto::Array<Apto::Array<cHardwareBase*> > m_hw_pools;
+  int m_hw_pool_size;
+  Apto::Mutex m_hw_pool_mutex;
+
+  // Test CPUs returned through ReleaseTestCPU, kept for reuse (see cTestCPUHandle)
+  Apto::Array<cTestCPU*> m_test_cpu_pool;
+  Apto::Mutex m_test_cpu_pool_mutex;
+
   
   cHardwareManager(); // @not_implemented
   cHardwareManager(const cHardwareManager&); // @not_implemented
@@ -65,7 +76,12 @@ public:
   bool ConvertLegacyInstSetFile(cString filename, cStringList& str_list, cUserFeedback* feedback = NULL);
   
   cHardwareBase* Create(cAvidaContext& ctx, cOrganism* org, const Genome& mg);
+  //! Return hardware no longer used by its organism, pooling it for reuse when its type supports recycling.
+  void Release(cHardwareBase* hw);
   inline cTestCPU* CreateTestCPU(cAvidaContext& ctx) { return new cTestCPU(ctx, m_world); }
+  //! Check out a test CPU, reset as if newly created.  Prefer cTestCPUHandle, which returns it automatically.
+  cTestCPU* AcquireTestCPU(cAvidaContext& ctx);
+  void ReleaseTestCPU(cTestCPU* test_cpu);
 
   inline bool IsInstSet(const Apto::String& name) const { return m_is_name_map.Has(name); }
   
@@ -76,6 +92,7 @@ public:
   const cInstSet& GetDefaultInstSet() const { return *m_inst_sets[0]; }
   
   int GetNumInstSets() const { return m_inst_sets.GetSize(); }
+  int GetInstSetID(const Apto::String& name) const { return (name == "(default)") ? 0 : m_is_name_map.GetWithDefault(name, -1); }
   
   bool RegisterInstSet(const Apto::String& name, cInstSet* inst_set);
     
@@ -84,6 +101,29 @@ private:
 };
 
 
+// cTestCPUHandle - Scoped checkout of a pooled test CPU, returned to the hardware manager on destruction
+
+class cTestCPUHandle
+{
+private:
+  cHardwareManager& m_mgr;
+  cTestCPU* m_test_cpu;
+
+
+  cTestCPUHandle(); // @not_implemented
+  cTestCPUHandle(const cTestCPUHandle&); // @not_implemented
+  cTestCPUHandle& operator=(const cTestCPUHandle&); // @not_implemented
+
+public:
+  cTestCPUHandle(cHardwareManager& mgr, cAvidaContext& ctx) : m_mgr(mgr), m_test_cpu(mgr.AcquireTestCPU(ctx)) { ; }
+  ~cTestCPUHandle() { m_mgr.ReleaseTestCPU(m_test_cpu); }
+
+  cTestCPU* Get() const { return m_test_cpu; }
+  cTestCPU* operator->() const { return m_test_cpu; }
+  cTestCPU& operator*() const { return *m_test_cpu; }
+};
+
+
 inline const cInstSet& cHardwareManager::GetInstSet(const Apto::String& name) const
 {
   return (name == "(default)") ? *m_inst_sets[0] : *m_inst_sets[m_is_name_map.GetWithDefault(name, -1)];
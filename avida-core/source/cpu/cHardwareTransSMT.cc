@@ -422,22 +422,21 @@ cHeadCPU cHardwareTransSMT::FindLabel(int direction)
     return inst_ptr;
   }
 	
-  // Call special functions depending on if jump is forwards or backwards.
+  // Search the memory label index depending on if jump is forwards or backwards.
+  const cCPUMemory& memory = inst_ptr.GetMemory();
   int found_pos = 0;
   if( direction < 0 ) {
-    found_pos = FindLabel_Backward(search_label, inst_ptr.GetMemory(),
-																	 inst_ptr.GetPosition() - search_label.GetSize());
+    found_pos = memory.FindLabelBackward(search_label, *m_inst_set, inst_ptr.GetPosition() - search_label.GetSize());
   }
 	
   // Jump forward.
   else if (direction > 0) {
-    found_pos = FindLabel_Forward(search_label, inst_ptr.GetMemory(),
-																	inst_ptr.GetPosition());
+    found_pos = memory.FindLabelForward(search_label, *m_inst_set, inst_ptr.GetPosition());
   }
 	
   // Jump forward from the very beginning.
   else {
-    found_pos = FindLabel_Forward(search_label, inst_ptr.GetMemory(), 0);
+    found_pos = memory.FindLabelForward(search_label, *m_inst_set, 0);
   }
   
   // Return the last line of the found label, if it was found.
@@ -448,164 +447,6 @@ cHeadCPU cHardwareTransSMT::FindLabel(int direction)
 }
 
 
-// Search forwards for search_label from _after_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-int cHardwareTransSMT::FindLabel_Forward(const cCodeLabel& search_label,
-                                         const InstructionSequence& search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize() && pos >= 0);
-	
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-	
-  // Move off the template we are on.
-  pos += label_size;
-	
-  // Search until we find the complement or exit the memory.
-  while (pos < search_genome.GetSize()) {
-		
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-		
-    if (m_inst_set->IsNop(search_genome[pos])) {
-      // Find the start and end of the label we're in the middle of.
-			
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > search_start &&
-						 m_inst_set->IsNop( search_genome[start_pos - 1] )) {
-				start_pos--;
-      }
-      while (end_pos < search_genome.GetSize() &&
-						 m_inst_set->IsNop( search_genome[end_pos] )) {
-				end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-			
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      int offset = start_pos;
-      for (offset = start_pos; offset < start_pos + max_offset; offset++) {
-				
-				// Test the number of matches for this offset.
-				int matches;
-				for (matches = 0; matches < label_size; matches++) {
-					if (search_label[matches] !=
-							m_inst_set->GetNopMod( search_genome[offset + matches] )) {
-						break;
-					}
-				}
-				
-				// If we have found it, break out of this loop!
-				if (matches == label_size) {
-					found_label = true;
-					break;
-				}
-      }
-			
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-			
-      if (found_label == true) {
-				// pos = end_pos;
-				pos = label_size + offset;
-				break;
-      }
-			
-      // We haven't found it; jump pos to just after the current label being
-      // checked.
-      pos = end_pos;
-    }
-		
-    // Jump up a block to the next possible point to find a label,
-    pos += label_size;
-  }
-	
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-	
-  return pos;
-}
-
-// Search backwards for search_label from _before_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-int cHardwareTransSMT::FindLabel_Backward(const cCodeLabel & search_label,
-                                          const InstructionSequence & search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize());
-	
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-	
-  // Move off the template we are on.
-  pos -= label_size;
-	
-  // Search until we find the complement or exit the memory.
-  while (pos >= 0) {
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-		
-    if (m_inst_set->IsNop( search_genome[pos] )) {
-      // Find the start and end of the label we're in the middle of.
-			
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > 0 && m_inst_set->IsNop(search_genome[start_pos - 1])) {
-				start_pos--;
-      }
-      while (end_pos < search_start &&
-						 m_inst_set->IsNop(search_genome[end_pos])) {
-				end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-			
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      for (int offset = start_pos; offset < start_pos + max_offset; offset++) {
-				
-				// Test the number of matches for this offset.
-				int matches;
-				for (matches = 0; matches < label_size; matches++) {
-					if (search_label[matches] !=
-							m_inst_set->GetNopMod(search_genome[offset + matches])) {
-						break;
-					}
-				}
-				
-				// If we have found it, break out of this loop!
-				if (matches == label_size) {
-					found_label = true;
-					break;
-				}
-      }
-			
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-			
-      if (found_label == true) {
-				pos = end_pos;
-				break;
-      }
-			
-      // We haven't found it; jump pos to just before the current label
-      // being checked.
-      pos = start_pos - 1;
-    }
-		
-    // Jump up a block to the next possible point to find a label,
-    pos -= label_size;
-  }
-	
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-	
-  return pos;
-}
-
 // Search for 'in_label' anywhere in the hardware.
 cHeadCPU cHardwareTransSMT::FindLabel(const cCodeLabel& in_label, int direction)
 {
@@ -44,6 +44,8 @@ cInstSet::cInstSet(const cInstSet& _in)
   , m_inst_lib(_in.m_inst_lib)
   , m_lib_name_map(_in.m_lib_name_map)
   , m_mutation_index(NULL)
+  , m_mutation_alias(_in.m_mutation_alias)
+  , m_alias_sampling(_in.m_alias_sampling)
   , m_has_costs(_in.m_has_costs)
   , m_has_ft_costs(_in.m_has_ft_costs)
   , m_has_energy_costs(_in.m_has_energy_costs)
@@ -53,6 +55,7 @@ cInstSet::cInstSet(const cInstSet& _in)
   , m_has_choosy_female_costs(_in.m_has_choosy_female_costs)
   , m_has_post_costs(_in.m_has_post_costs)
   , m_has_bonus_costs(_in.m_has_bonus_costs)
+  , m_mod_count(0)
 {
   m_mutation_index = new cOrderedWeightedIndex(*_in.m_mutation_index);
 }
@@ -65,6 +68,8 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
   m_inst_lib = _in.m_inst_lib;
   m_lib_name_map = _in.m_lib_name_map;
   m_mutation_index = NULL;
+  m_mutation_alias = _in.m_mutation_alias;
+  m_alias_sampling = _in.m_alias_sampling;
   m_has_costs = _in.m_has_costs;
   m_has_ft_costs = _in.m_has_ft_costs;
   m_has_energy_costs = _in.m_has_energy_costs;
@@ -74,6 +79,7 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
   m_has_choosy_female_costs = _in.m_has_choosy_female_costs;
   m_has_post_costs = _in.m_has_post_costs;
   m_has_bonus_costs = _in.m_has_bonus_costs;
+  m_mod_count++;
 
   m_mutation_index = new cOrderedWeightedIndex(*_in.m_mutation_index);
   return *this;
@@ -82,6 +88,8 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
 
 Instruction cInstSet::GetRandomInst(cAvidaContext& ctx) const
 {
+  if (m_alias_sampling) return Instruction(m_mutation_alias.Draw(ctx.GetRandom()));
+  
   double weight = ctx.GetRandom().GetDouble(m_mutation_index->GetTotalWeight());
   unsigned inst_ndx = m_mutation_index->FindPosition(weight);
   return Instruction(inst_ndx);
@@ -102,6 +110,7 @@ Instruction cInstSet::ActivateNullInst()
   
   // Increase the size of the array...
   m_lib_name_map.Resize(inst_id + 1);
+  m_mod_count++;
   
   // Setup the new function...
   m_lib_name_map[inst_id].lib_fun_id = null_fun_id;
@@ -298,6 +307,8 @@ bool cInstSet::LoadWithStringList(const cStringList& sl, cUserFeedback* feedback
     delete args;
   }
 
+  m_mod_count++;
+  
   //Setup mutation indexing based on redundancies
   m_mutation_index = new cOrderedWeightedIndex();
   for (int id=0; id < m_lib_name_map.GetSize(); id++)
@@ -309,10 +320,26 @@ bool cInstSet::LoadWithStringList(const cStringList& sl, cUserFeedback* feedback
      }
      m_mutation_index->SetWeight(id, m_lib_name_map[id].redundancy);
   }
+  m_alias_sampling = (m_world->GetConfig().MUTATION_SAMPLING.Get() == 1);
+  if (m_alias_sampling) buildMutationAlias();
   return success;
 }
 
 
+void cInstSet::buildMutationAlias()
+{
+  // Mirror every entry of the ordered index (including those appended by SetRedundancy), so both samplers agree
+  const int num_entries = m_mutation_index->GetSize();
+  Apto::Array<double> weights(num_entries);
+  Apto::Array<int> values(num_entries);
+  for (int i = 0; i < num_entries; i++) {
+    weights[i] = m_mutation_index->GetWeight(i);
+    values[i] = m_mutation_index->GetValue(i);
+  }
+  m_mutation_alias.Build(weights, values);
+}
+
+
 void cInstSet::SaveInstructionSequence(ofstream& of, const InstructionSequence& seq) const
 {
   for (int i = 0; i < seq.GetSize(); i++) of << GetName(seq[i]) << endl;  
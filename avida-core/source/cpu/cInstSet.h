@@ -28,6 +28,7 @@
 #include "avida/core/InstructionSequence.h"
 
 #include "cString.h"
+#include "cAliasTable.h"
 #include "cInstLib.h"
 #include "cOrderedWeightedIndex.h"
 
@@ -78,6 +79,8 @@ public:
   Apto::Array<int> m_lib_nopmod_map;
   
   cOrderedWeightedIndex* m_mutation_index;     // Weighted index for instructions 
+  cAliasTable m_mutation_alias;                // Same weights, sampled in constant time (MUTATION_SAMPLING 1)
+  bool m_alias_sampling;
   
   bool m_has_costs;
   bool m_has_ft_costs;
@@ -92,14 +95,16 @@ public:
   int m_stack_size;
   int m_uops_per_cycle;
   
+  int m_mod_count;      // Incremented by every modification, so that decoded copies of the set know to refresh
+  
   cInstSet(); // @not_implemented
 
 public:
   inline cInstSet(cWorld* world, const cString& name, int hw_type, cInstLib* inst_lib, int stack_size, int uops_per_cycle)
-    : m_world(world), m_name(name), m_hw_type(hw_type), m_inst_lib(inst_lib), m_mutation_index(NULL)
+    : m_world(world), m_name(name), m_hw_type(hw_type), m_inst_lib(inst_lib), m_mutation_index(NULL), m_alias_sampling(false)
     , m_has_costs(false), m_has_ft_costs(false), m_has_energy_costs(false), m_has_res_costs(false), m_has_fem_res_costs(false)
     , m_has_female_costs(false), m_has_choosy_female_costs(false), m_has_post_costs(false), m_has_bonus_costs(false), m_stack_size(stack_size)
-    , m_uops_per_cycle(uops_per_cycle) { ; }
+    , m_uops_per_cycle(uops_per_cycle), m_mod_count(0) { ; }
   cInstSet(const cInstSet&); 
   cInstSet& operator=(const cInstSet&); 
   inline ~cInstSet() { if (m_mutation_index != NULL) delete m_mutation_index; }
@@ -152,6 +157,8 @@ public:
   int GetStackSize() const { return m_stack_size; }
   int GetUOpsPerCycle() const { return m_uops_per_cycle; }
   
+  int GetModCount() const { return m_mod_count; }
+  
   // Instruction Analysis.
   int IsNop(const Instruction& inst) const { return (inst.GetOp() < m_lib_nopmod_map.GetSize()); }
   bool IsLabel(const Instruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).IsLabel(); }
@@ -168,8 +175,14 @@ public:
   Instruction ActivateNullInst();
   
   // Modification of instructions during run.
-  void SetProbFail(const Instruction& inst, double _prob_fail) { m_lib_name_map[inst.GetOp()].prob_fail = _prob_fail; }
-  void SetRedundancy(const Instruction& inst, int _redundancy) { m_lib_name_map[inst.GetOp()].redundancy = _redundancy; m_mutation_index->SetWeight(inst.GetOp(), _redundancy);}
+  void SetProbFail(const Instruction& inst, double _prob_fail) { m_lib_name_map[inst.GetOp()].prob_fail = _prob_fail; m_mod_count++; }
+  void SetRedundancy(const Instruction& inst, int _redundancy)
+  {
+    m_mod_count++;
+    m_lib_name_map[inst.GetOp()].redundancy = _redundancy;
+    m_mutation_index->SetWeight(inst.GetOp(), _redundancy);
+    if (m_alias_sampling) buildMutationAlias();
+  }
 
   // accessors for instruction library
   cInstLib* GetInstLib() { return m_inst_lib; }
@@ -185,6 +198,9 @@ public:
   bool LoadWithStringList(const cStringList& sl, cUserFeedback* errors = NULL);
   
   void SaveInstructionSequence(ofstream& of, const InstructionSequence& seq) const;
+
+private:
+  void buildMutationAlias();
 };
 
 
@@ -0,0 +1,138 @@
+/*
+ *  cPhenotypeCache.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cPhenotypeCache.h"
+
+#include "avida/core/Genome.h"
+
+#include "cAvidaContext.h"
+#include "cCPUTestInfo.h"
+#include "cHardwareManager.h"
+#include "cPhenotype.h"
+#include "cStats.h"
+#include "cStringUtil.h"
+#include "cTestCPU.h"
+#include "cWorld.h"
+
+const Apto::String cPhenotypeCache::ObjectKey("cPhenotypeCache");
+
+// Guards attaching caches to groups and the shared hit/miss counters
+static Apto::Mutex s_cache_mutex;
+
+
+bool cPhenotypeCache::Serialize(ArchivePtr) const
+{
+  // Cached results are recomputed on demand and never saved
+  return false;
+}
+
+
+bool cPhenotypeCache::Lookup(const Apto::String& key, sResult& result)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+
+  int entry_id = -1;
+  if (!m_index.Get(key, entry_id)) return false;
+
+  m_entries[entry_id].referenced = true;
+  result = m_entries[entry_id].result;
+  return true;
+}
+
+void cPhenotypeCache::Insert(const Apto::String& key, const sResult& result)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+
+  if (m_index.Has(key)) return;  // another thread tested the same genome first
+
+  int entry_id = m_entries.GetSize();
+  if (entry_id < m_capacity) {
+    m_entries.Resize(entry_id + 1);
+  } else {
+    // Sweep the clock hand, giving recently used entries a second chance
+    while (m_entries[m_hand].referenced) {
+      m_entries[m_hand].referenced = false;
+      m_hand = (m_hand + 1) % m_entries.GetSize();
+    }
+    entry_id = m_hand;
+    m_hand = (m_hand + 1) % m_entries.GetSize();
+    m_index.Remove(m_entries[entry_id].key);
+  }
+
+  m_entries[entry_id].key = key;
+  m_entries[entry_id].result = result;
+  m_entries[entry_id].referenced = false;
+  m_index.Set(key, entry_id);
+}
+
+
+void cPhenotypeCache::TestGenome(cWorld* world, cAvidaContext& ctx, Systematics::GroupPtr group, const Genome& genome,
+                                 const Apto::Array<int>* inputs, sResult& result)
+{
+  // Random inputs make each test a fresh draw, so only tests with fixed inputs are cached
+  const int capacity = world->GetConfig().PHENOTYPE_CACHE_SIZE.Get();
+  if (capacity <= 0 || !group || !inputs) {
+    runTest(world, ctx, genome, inputs, result);
+    return;
+  }
+
+  Apto::SmartPtr<cPhenotypeCache> cache;
+  s_cache_mutex.Lock();
+  cache = group->GetData<cPhenotypeCache>();
+  if (!cache) {
+    cache = Apto::SmartPtr<cPhenotypeCache>(new cPhenotypeCache(capacity));
+    group->AttachData(cache);
+  }
+  s_cache_mutex.Unlock();
+
+  Apto::String key(genome.AsString());
+  for (int i = 0; i < inputs->GetSize(); i++) key += (const char*)cStringUtil::Stringf(":%d", (*inputs)[i]);
+
+  const bool hit = cache->Lookup(key, result);
+  s_cache_mutex.Lock();
+  world->GetStats().AddPhenotypeCacheRequest(hit);
+  s_cache_mutex.Unlock();
+  if (hit) return;
+
+  // Test outside of any lock; concurrent misses on the same key simply compute the same result
+  runTest(world, ctx, genome, inputs, result);
+  cache->Insert(key, result);
+}
+
+
+void cPhenotypeCache::runTest(cWorld* world, cAvidaContext& ctx, const Genome& genome, const Apto::Array<int>* inputs,
+                              sResult& result)
+{
+  cTestCPUHandle test_cpu(world->GetHardwareManager(), ctx);
+  cCPUTestInfo test_info;
+  if (inputs) test_info.UseManualInputs(*inputs);
+  else test_info.UseRandomInputs();
+  test_cpu->TestGenome(ctx, test_info, genome);
+
+  cPhenotype& phenotype = test_info.GetTestPhenotype();
+  result.is_viable = test_info.IsViable();
+  result.max_depth = test_info.GetMaxDepth();
+  result.fitness = test_info.GetGenotypeFitness();
+  result.merit = phenotype.GetMerit();
+  result.gestation_time = phenotype.GetGestationTime();
+  result.inst_counts = phenotype.GetLastInstCount();
+  result.task_counts = phenotype.GetLastTaskCount();
+}
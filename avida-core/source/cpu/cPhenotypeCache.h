@@ -0,0 +1,104 @@
+/*
+ *  cPhenotypeCache.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cPhenotypeCache_h
+#define cPhenotypeCache_h
+
+#include "apto/core.h"
+#include "apto/core/Mutex.h"
+#include "avida/systematics/Group.h"
+
+#include "cMerit.h"
+
+namespace Avida {
+  class Genome;
+};
+
+class cAvidaContext;
+class cWorld;
+
+using namespace Avida;
+
+
+// cPhenotypeCache - Bounded memo of test CPU results, attached to a systematics genotype group
+//
+// PRECALC_PHENOTYPE and test-on-divide run the test CPU on every birth, although offspring are usually identical to
+// a genome that has already been tested.  Results are cached on the genotype group of the organism performing the
+// test, keyed by the tested genome and its inputs.  Tests with random inputs are not deterministic, so they are run
+// every time and never cached.  Tests always start from the initial resource levels, so no further resource state
+// enters the key.  Each cache holds at most PHENOTYPE_CACHE_SIZE results, evicted in clock (second chance) order.
+// All access is thread-safe.
+
+class cPhenotypeCache : public Systematics::GroupData
+{
+public:
+  static const Apto::String ObjectKey;
+
+  struct sResult
+  {
+    bool is_viable;
+    int max_depth;
+    double fitness;
+    cMerit merit;
+    int gestation_time;
+    Apto::Array<int> inst_counts;
+    Apto::Array<int> task_counts;
+  };
+
+private:
+  struct sEntry
+  {
+    Apto::String key;
+    sResult result;
+    bool referenced;
+  };
+
+  Apto::Mutex m_mutex;
+  Apto::Map<Apto::String, int> m_index;
+  Apto::Array<sEntry> m_entries;
+  int m_capacity;
+  int m_hand;
+
+
+  cPhenotypeCache(); // @not_implemented
+  cPhenotypeCache(const cPhenotypeCache&); // @not_implemented
+  cPhenotypeCache& operator=(const cPhenotypeCache&); // @not_implemented
+
+public:
+  explicit cPhenotypeCache(int capacity) : m_capacity(capacity), m_hand(0) { ; }
+  ~cPhenotypeCache() { ; }
+
+  bool Serialize(ArchivePtr ar) const;
+
+  bool Lookup(const Apto::String& key, sResult& result);
+  void Insert(const Apto::String& key, const sResult& result);
+
+  //! Test genome on behalf of group, with the given inputs (NULL for random ones, which are never cached), reusing a
+  //! cached result if enabled.
+  static void TestGenome(cWorld* world, cAvidaContext& ctx, Systematics::GroupPtr group, const Genome& genome,
+                         const Apto::Array<int>* inputs, sResult& result);
+
+private:
+  static void runTest(cWorld* world, cAvidaContext& ctx, const Genome& genome, const Apto::Array<int>* inputs,
+                      sResult& result);
+};
+
+#endif
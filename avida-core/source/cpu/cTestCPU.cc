@@ -38,6 +38,7 @@
 #include "cResourceHistory.h"
 #include "cResourceLib.h"
 #include "cStringUtil.h"
+#include "cTestCPUCheckpoints.h"
 #include "cTestCPUInterface.h"
 #include "cWorld.h"
 #include "tMatrix.h"
@@ -51,11 +52,20 @@ using namespace AvidaTools;
 cTestCPU::cTestCPU(cAvidaContext& ctx, cWorld* world)
 {
   m_world = world;
+  Reset(ctx);
+}  
+
+void cTestCPU::Reset(cAvidaContext& ctx)
+{
 	m_use_manual_inputs = false;
   m_test_solo_res = -1;
   m_test_solo_res_lev = 0;
+  m_record_checkpoints = NULL;
+  m_resume_checkpoints = NULL;
+  m_resume_checkpoint = -1;
+  m_resume_site = -1;
   InitResources(ctx);
-}  
+}
 
  
 void cTestCPU::InitResources(cAvidaContext& ctx, int res_method, cResourceHistory* res, int update, int cpu_cycle_offset)
@@ -165,8 +175,20 @@ bool cTestCPU::ProcessGestation(cAvidaContext& ctx, cCPUTestInfo& test_info, int
   int time_used = m_res_cpu_cycle_offset; // Note: the offset is zero by default if no resources being used @JEB
   
   organism.GetHardware().SetTrace(test_info.GetTracer());
+  
+  // Record checkpoints of this gestation, or resume it from one if this is a point mutant.  Resource levels that
+  // change over the course of the test are not part of a checkpoint, so no checkpoints are recorded with them.
+  bool recording = false;
+  if (cur_depth == 0 && m_record_checkpoints && m_res_method < RES_UPDATED_DEPLETABLE) {
+    recording = m_record_checkpoints->Begin(organism, *seq);
+  } else if (cur_depth == 0 && m_resume_checkpoints) {
+    time_used = m_resume_checkpoints->Load(m_resume_checkpoint, organism, m_resume_site);
+  }
+  
   while (time_used < time_allocated && organism.GetPhenotype().GetNumDivides() == 0 && !organism.IsDead())
   {
+    if (recording) recording = m_record_checkpoints->Observe(organism, time_used);
+    
     time_used++;
     
     // @CAO Need to watch out for parasites.
@@ -177,6 +199,7 @@ bool cTestCPU::ProcessGestation(cAvidaContext& ctx, cCPUTestInfo& test_info, int
     organism.GetHardware().SingleProcess(ctx);
   }
   
+  if (recording) organism.GetHardware().SetCheckpoints(NULL);
   organism.GetHardware().SetTrace(HardwareTracerPtr(NULL));
 
   // Print out some final info in trace...
@@ -197,6 +220,36 @@ bool cTestCPU::TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Gen
   return test_info.is_viable;
 }
 
+bool cTestCPU::TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome,
+                          cTestCPUCheckpoints& checkpoints)
+{
+  checkpoints.Clear();
+  m_record_checkpoints = &checkpoints;
+  const bool is_viable = TestGenome(ctx, test_info, genome);
+  m_record_checkpoints = NULL;
+  
+  return is_viable;
+}
+
+bool cTestCPU::TestPointMutant(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome,
+                               const cTestCPUCheckpoints& checkpoints, int site)
+{
+  ConstInstructionSequencePtr seq;
+  seq.DynamicCastFrom(genome.Representation());
+  
+  // Mutants read before the first checkpoint, or traced, are tested in full
+  const int checkpoint_id = checkpoints.FindCheckpoint(site, (*seq)[site]);
+  if (checkpoint_id < 0 || test_info.GetTracer()) return TestGenome(ctx, test_info, genome);
+  
+  m_resume_checkpoints = &checkpoints;
+  m_resume_checkpoint = checkpoint_id;
+  m_resume_site = site;
+  const bool is_viable = TestGenome(ctx, test_info, genome);
+  m_resume_checkpoints = NULL;
+  
+  return is_viable;
+}
+
 bool cTestCPU::TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, ofstream& out_fp)
 {
   ctx.SetTestMode();
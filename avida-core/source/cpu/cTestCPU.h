@@ -36,6 +36,7 @@ class cBioGroup;
 class cInstSet;
 class cResourceCount;
 class cResourceHistory;
+class cTestCPUCheckpoints;
 
 using namespace Avida;
 
@@ -66,6 +67,12 @@ private:
   cResourceCount m_faced_cell_resource_count;
   cResourceCount m_deme_resource_count;
   cResourceCount m_cell_resource_count;
+  
+  // Checkpoints being recorded, or resumed from, by the current test (see TestPointMutant)
+  cTestCPUCheckpoints* m_record_checkpoints;
+  const cTestCPUCheckpoints* m_resume_checkpoints;
+  int m_resume_checkpoint;
+  int m_resume_site;
     
 
   bool ProcessGestation(cAvidaContext& ctx, cCPUTestInfo& test_info, int cur_depth);
@@ -87,8 +94,17 @@ public:
   cTestCPU(cAvidaContext& ctx, cWorld* world);
   ~cTestCPU() { }
   
+  //! Return to the state of a newly constructed test CPU (used when pooled by cHardwareManager).
+  void Reset(cAvidaContext& ctx);
+  
   bool TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome);
   bool TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, std::ofstream& out_fp);
+  //! Test a genome, recording checkpoints of its gestation that the tests of its point mutants can resume from.
+  bool TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, cTestCPUCheckpoints& checkpoints);
+  //! Test a genome differing from the one checkpoints were recorded for only at site, resuming its gestation from the
+  //! latest usable checkpoint.  test_info must be set up as it was for the recording; results match TestGenome.
+  bool TestPointMutant(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome,
+                       const cTestCPUCheckpoints& checkpoints, int site);
   
   void PrintGenome(cAvidaContext& ctx, const Genome& genome, cString filename = "", int update = -1, bool for_groups = false, int last_birth_cell = 0, int last_group_id = -1, int last_forager_type = -1);
 
@@ -0,0 +1,146 @@
+/*
+ *  cTestCPUCheckpoints.cc
+ *  Avida
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cTestCPUCheckpoints.h"
+
+#include "cCPUMemory.h"
+#include "cHardwareBase.h"
+#include "cInstSet.h"
+#include "cOrganism.h"
+#include "cPhenotype.h"
+
+#include <cassert>
+
+
+const int cTestCPUCheckpoints::NOT_READ;
+
+
+void cTestCPUCheckpoints::Clear()
+{
+  for (int i = 0; i < m_checkpoints.GetSize(); i++) {
+    delete m_checkpoints[i].hardware;
+    delete m_checkpoints[i].phenotype;
+  }
+  m_checkpoints.Resize(0);
+  m_first_read.Resize(0);
+  m_first_label.Resize(0);
+  m_inst_set = NULL;
+  m_cycle = -1;
+}
+
+
+bool cTestCPUCheckpoints::Begin(cOrganism& organism, const InstructionSequence& genome)
+{
+  Clear();
+  
+  cHardwareBase& hardware = organism.GetHardware();
+  if (m_interval < 1 || !hardware.SupportsCheckpoints()) return false;
+  
+  m_inst_set = &hardware.GetInstSet();
+  m_genome = genome;
+  m_first_read.Resize(genome.GetSize());
+  m_first_read.SetAll(NOT_READ);
+  m_first_label.Resize(genome.GetSize());
+  m_first_label.SetAll(NOT_READ);
+  
+  hardware.SetCheckpoints(this);
+  return true;
+}
+
+
+bool cTestCPUCheckpoints::Observe(cOrganism& organism, int time_used)
+{
+  cHardwareBase& hardware = organism.GetHardware();
+  
+  // Checkpoints hold the state before the cycle they are numbered with
+  m_cycle++;
+  if (m_cycle > 0 && (m_cycle % m_interval) == 0) save(organism, time_used);
+  
+  if (!hardware.ObserveCycle()) {
+    // The prefix ends here, keep its final state so that mutants at sites it never read skip all of it
+    const int num_checkpoints = m_checkpoints.GetSize();
+    if (m_cycle > 0 && (num_checkpoints == 0 || m_checkpoints[num_checkpoints - 1].cycle != m_cycle)) {
+      save(organism, time_used);
+    }
+    hardware.SetCheckpoints(NULL);
+    return false;
+  }
+  
+  return true;
+}
+
+
+int cTestCPUCheckpoints::FindCheckpoint(int site, const Instruction& inst) const
+{
+  if (site < 0 || site >= m_first_read.GetSize()) return -1;
+  
+  // The mutant diverges at the first full read of the site, or at its first label read if the nop class changed
+  int diverge_cycle = m_first_read[site];
+  if (labelClass(inst) != labelClass(m_genome[site]) && m_first_label[site] < diverge_cycle) {
+    diverge_cycle = m_first_label[site];
+  }
+  
+  // Binary search for the last checkpoint saved at or before that cycle
+  int lo = 0;
+  int hi = m_checkpoints.GetSize();
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_checkpoints[mid].cycle <= diverge_cycle) lo = mid + 1;
+    else hi = mid;
+  }
+  
+  return lo - 1;
+}
+
+
+int cTestCPUCheckpoints::Load(int checkpoint_id, cOrganism& organism, int site) const
+{
+  const sCheckpoint& checkpoint = m_checkpoints[checkpoint_id];
+  cHardwareBase& hardware = organism.GetHardware();
+  
+  hardware.LoadCheckpoint(*checkpoint.hardware);
+  organism.GetPhenotype() = *checkpoint.phenotype;
+  
+  // The checkpoint memory still holds the parent's instruction at the mutated site
+  ConstInstructionSequencePtr seq;
+  seq.DynamicCastFrom(organism.UnitGenome().Representation());
+  assert(seq->GetSize() == m_genome.GetSize());
+  hardware.GetMemory().SetInst(site, (*seq)[site]);
+  
+  return checkpoint.time_used;
+}
+
+
+void cTestCPUCheckpoints::save(cOrganism& organism, int time_used)
+{
+  sCheckpoint checkpoint;
+  checkpoint.cycle = m_cycle;
+  checkpoint.time_used = time_used;
+  checkpoint.hardware = organism.GetHardware().SaveCheckpoint();
+  checkpoint.phenotype = new cPhenotype(organism.GetPhenotype());
+  m_checkpoints.Push(checkpoint);
+}
+
+
+int cTestCPUCheckpoints::labelClass(const Instruction& inst) const
+{
+  return (m_inst_set->IsNop(inst)) ? m_inst_set->GetNopMod(inst) : -1;
+}
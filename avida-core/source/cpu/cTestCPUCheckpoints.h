@@ -0,0 +1,115 @@
+/*
+ *  cTestCPUCheckpoints.h
+ *  Avida
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cTestCPUCheckpoints_h
+#define cTestCPUCheckpoints_h
+
+#include "avida/core/InstructionSequence.h"
+
+#include "apto/core.h"
+
+#include <climits>
+
+class cInstSet;
+class cOrganism;
+class cPhenotype;
+
+using namespace Avida;
+
+
+// cHardwareCheckpoint - Saved state of a hardware, only meaningful to the hardware type that saved it
+class cHardwareCheckpoint
+{
+public:
+  virtual ~cHardwareCheckpoint() { ; }
+};
+
+
+// cTestCPUCheckpoints - Checkpoints of a test CPU gestation, used to resume the gestations of its point mutants
+//
+// While a genome is tested, its hardware reports the memory sites each cycle is about to read (see
+// cHardwareBase::ObserveCycle) and the hardware and phenotype are saved every TEST_CPU_CHECKPOINT_INTERVAL cycles.
+// Recording stops at the first cycle that might depend on anything other than the hardware state, such as I/O, a
+// divide or a random number draw.  Up to the first cycle that reads a mutated site, a point mutant executes exactly as
+// its parent did, so its test can resume from the last checkpoint saved before then.
+//
+// Sites are observed either in full (executed, copied or written) or only as labels, through their nop class.  A
+// mutation that leaves a site's nop class unchanged does not alter label reads, so only full reads limit its resume.
+//
+// Checkpoints are not modified once recorded, so any number of test CPUs may resume from them concurrently.
+
+class cTestCPUCheckpoints
+{
+private:
+  struct sCheckpoint
+  {
+    int cycle;
+    int time_used;
+    cHardwareCheckpoint* hardware;
+    cPhenotype* phenotype;
+  };
+
+  static const int NOT_READ = INT_MAX;
+
+  int m_interval;
+  const cInstSet* m_inst_set;
+  InstructionSequence m_genome;
+
+  Apto::Array<sCheckpoint> m_checkpoints;
+  Apto::Array<int> m_first_read;    // cycle each site of the genome was first read in full, or NOT_READ
+  Apto::Array<int> m_first_label;   // cycle each site of the genome was first read as part of a label, or NOT_READ
+  int m_cycle;
+
+
+  cTestCPUCheckpoints(const cTestCPUCheckpoints&); // @not_implemented
+  cTestCPUCheckpoints& operator=(const cTestCPUCheckpoints&); // @not_implemented
+
+public:
+  explicit cTestCPUCheckpoints(int interval) : m_interval(interval), m_inst_set(NULL), m_cycle(-1) { ; }
+  ~cTestCPUCheckpoints() { Clear(); }
+
+  void Clear();
+
+  int GetInterval() const { return m_interval; }
+  int GetNumCheckpoints() const { return m_checkpoints.GetSize(); }
+
+  // Recording, used by cTestCPU
+  //! Start recording the gestation of organism, which must be freshly created.  Returns false if it is unsupported.
+  bool Begin(cOrganism& organism, const InstructionSequence& genome);
+  //! Observe the next cycle, before it is processed.  Returns false once recording has stopped.
+  bool Observe(cOrganism& organism, int time_used);
+
+  // Observation, used by the hardware
+  inline void ObserveSite(int pos) { if (pos >= 0 && pos < m_first_read.GetSize() && m_first_read[pos] == NOT_READ) m_first_read[pos] = m_cycle; }
+  inline void ObserveLabelSite(int pos) { if (pos >= 0 && pos < m_first_label.GetSize() && m_first_label[pos] == NOT_READ) m_first_label[pos] = m_cycle; }
+
+  // Resuming, used by cTestCPU
+  //! Find the checkpoint to resume the mutant with inst at site from, returns -1 if it must be tested from the start.
+  int FindCheckpoint(int site, const Instruction& inst) const;
+  //! Load a checkpoint into a freshly created point mutant organism and return the time used at that checkpoint.
+  int Load(int checkpoint_id, cOrganism& organism, int site) const;
+
+private:
+  void save(cOrganism& organism, int time_used);
+  int labelClass(const Instruction& inst) const;
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "cTestCPUInterface.h"
 
 #include "cOrganism.h"
+#include "cResourceView.h"
 #include "cTestCPU.h"
 
 
@@ -104,6 +105,14 @@ const Apto::Array< Apto::Array<int> >& cTestCPUInterface::GetCellIdLists()
 	return m_testcpu->GetCellIdLists();
 }
 
+cResourceView cTestCPUInterface::GetResourceView(cAvidaContext& ctx)
+{
+  cResourceView view(m_testcpu->GetResources(ctx));
+  view.Append(cResourceView(m_testcpu->GetDemeResources(GetDemeID(), ctx)));
+  view.SetCellIdLists(m_testcpu->GetCellIdLists(), GetCellID());
+  return view;
+}
+
 void cTestCPUInterface::UpdateResources(cAvidaContext& ctx, const Apto::Array<double>& res_change)
 {
    m_testcpu->ModifyResources(ctx, res_change);
@@ -182,6 +191,13 @@ const Apto::Array<double>& cTestCPUInterface::GetAVResources(cAvidaContext& ctx,
   return m_testcpu->GetAVResources(ctx);
 }
 
+cResourceView cTestCPUInterface::GetAVResourceView(cAvidaContext& ctx, int av_num)
+{
+  cResourceView view(m_testcpu->GetAVResources(ctx));
+  view.SetCellIdLists(m_testcpu->GetCellIdLists(), GetAVCellID(av_num));
+  return view;
+}
+
 double cTestCPUInterface::GetAVResourceVal(cAvidaContext& ctx, int res_id, int av_num)
 {
   return m_testcpu->GetAVResourceVal(ctx, res_id);
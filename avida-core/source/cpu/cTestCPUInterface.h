@@ -111,6 +111,7 @@ public:
   double GetFrozenCellResVal(cAvidaContext& ctx, int cell_id, int res_id);
   double GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id);
   const Apto::Array< Apto::Array<int> >& GetCellIdLists();
+  cResourceView GetResourceView(cAvidaContext& ctx);
   
   int GetCurrPeakX(cAvidaContext& ctx, int res_id) { return 0; } 
   int GetCurrPeakY(cAvidaContext& ctx, int res_id) { return 0; } 
@@ -266,6 +267,7 @@ public:
   Apto::Array<cOrganism*> GetCellAVs(int cell_id, int av_num = 0);
   Apto::Array<cOrganism*> GetFacedPreyAVs(int av_num = 0);
   const Apto::Array<double>& GetAVResources(cAvidaContext& ctx, int av_num = 0);
+  cResourceView GetAVResourceView(cAvidaContext& ctx, int av_num = 0);
   double GetAVResourceVal(cAvidaContext& ctx, int res_id, int av_num = 0);
   const Apto::Array<double>& GetAVFacedResources(cAvidaContext& ctx, int av_num = 0);
   double GetAVFacedResourceVal(cAvidaContext& ctx, int res_id, int av_num = 0);
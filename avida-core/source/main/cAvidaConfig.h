@@ -281,7 +281,12 @@ public:
   CONFIG_ADD_GROUP(GENERAL_GROUP, "General Settings");
   CONFIG_ADD_VAR(VERBOSITY, int, 1, "0 = No output at all\n1 = Normal output\n2 = Verbose output, detailing progress\n3 = High level of details, as available\n4 = Print Debug Information, as applicable");
   CONFIG_ADD_VAR(RANDOM_SEED, int, -1, "Random number seed (<0 for based on time)");
-  CONFIG_ADD_VAR(SPECULATIVE, bool, 1, "Enable speculative execution\n(pre-execute instructions that don't affect other organisms)");
+  CONFIG_ADD_VAR(SPECULATIVE, bool, 1, "Enable speculative execution\n(pre-execute instructions that don't affect other organisms;\nnot used when end of update point mutations are enabled)");
+  CONFIG_ADD_VAR(PARALLEL_UPDATE_THREADS, int, 0, "Number of threads used to speculatively pre-execute organisms at the\nstart of each update (requires SPECULATIVE; 0 = disabled, -1 = all available CPUs)");
+  CONFIG_ADD_VAR(PARALLEL_TILE_SIZE, int, 16, "Width and height, in cells, of the spatial tiles handed out to parallel update threads");
+  CONFIG_ADD_VAR(PARALLEL_SPECULATIVE_WINDOW, int, 32, "Maximum number of instructions each organism may hold pre-executed by a parallel update pass");
+  CONFIG_ADD_VAR(RESOURCE_UPDATE_THREADS, int, 0, "Number of threads used to update spatial resources\n(0 = disabled, -1 = all available CPUs)");
+  CONFIG_ADD_VAR(RESOURCE_BAND_ROWS, int, 32, "Rows of a spatial resource grid updated together by one resource update thread");
   CONFIG_ADD_VAR(POPULATION_CAP, int, 0, "Carrying capacity in number of organisms (use 0 for no cap)");
   CONFIG_ADD_VAR(POP_CAP_ELDEST, int, 0, "Carrying capacity in number of organisms (use 0 for no cap). Will kill oldest organism in population, but still use birth method to place new offspring."); 
   
@@ -360,6 +365,7 @@ public:
   CONFIG_ADD_VAR(META_COPY_MUT, double, 0.0, "Prob. of copy mutation rate changing (per gen)");
   CONFIG_ADD_VAR(META_STD_DEV, double, 0.0, "Standard deviation of meta mutation size.");
   CONFIG_ADD_VAR(MUT_RATE_SOURCE, int, 1, "1 = Mutation rates determined by environment.\n2 = Mutation rates inherited from parent.");
+  CONFIG_ADD_VAR(MUTATION_SAMPLING, int, 0, "How per-copy mutations and replacement instructions are drawn:\n0 = Test every copied instruction (original random number stream)\n1 = Skip ahead to the next mutation with geometric gaps and draw\n    replacements from an alias table (same rates, fewer draws)");
   
   
   // -------- Birth and Death config options --------
@@ -466,6 +472,7 @@ public:
   CONFIG_ADD_GROUP(ARCHETECTURE_GROUP, "Details on how CPU should work");
   CONFIG_ADD_VAR(IO_EXPIRE, bool, 1, "Is the expiration functionality of '-expire' I/O instructions enabled?");
   CONFIG_ADD_VAR(POISON_PENALTY, double, 0.01, "Metabolic rate penalty applied when the 'poison' instruction is executed.");
+  CONFIG_ADD_VAR(HARDWARE_POOL_SIZE, int, 1024, "Maximum number of released CPUs kept for reuse by new organisms, per instruction set\n(0 = always allocate new CPUs)");
 
   
   // -------- Pprocessing of multiple, distributed populations config options --------
@@ -540,7 +547,8 @@ public:
   // -------- Time Slicing config options --------
   CONFIG_ADD_GROUP(TIME_GROUP, "Time Slicing");
   CONFIG_ADD_VAR(AVE_TIME_SLICE, int, 30, "Average number of CPU-cycles per org per update");
-  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members");
+  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members\n6 = BUCKETED_PROBABILISTIC: As PROBABILISTIC, using a constant time sampler (different random sequence)");
+  CONFIG_ADD_VAR(MAX_BURST_LENGTH, int, 1, "Maximum number of consecutive CPU cycles handed to an organism per scheduling decision.\nEach burst consumes its length from the update, so merit proportionality holds on average.\n1 = one instruction per decision (disables burst scheduling and speculative execution when larger)");
   CONFIG_ADD_VAR(BASE_MERIT_METHOD, int, 4, "How should merit be initialized?\n0 = Constant (merit independent of size)\n1 = Merit proportional to copied size\n2 = Merit prop. to executed size\n3 = Merit prop. to full size\n4 = Merit prop. to min of executed or copied size\n5 = Merit prop. to sqrt of the minimum size\n6 = Merit prop. to num times MERIT_BONUS_INST is in genome.");
   CONFIG_ADD_VAR(BASE_CONST_MERIT, int, 100, "Base merit valse for BASE_MERIT_METHOD 0");
   CONFIG_ADD_VAR(MERIT_BONUS_INST, int, 0, "Instruction ID to count for BASE_MERIT_METHOD 6"); 
@@ -560,6 +568,7 @@ public:
   CONFIG_ADD_VAR(NO_CPU_CYCLE_TIME, int, 0, "Don't count each CPU cycle as part of gestation time\n");
   CONFIG_ADD_VAR(MAX_LABEL_EXE_SIZE, int, 1, "Max nops marked as executed when labels are used");
   CONFIG_ADD_VAR(PRECALC_PHENOTYPE, int, 0, "0 = Disabled\n 1 = Assign precalculated merit at birth (unlimited resources only)\n 2 = Assign precalculated gestation time\n 3 = Assign precalculated merit AND gestation time.\n 4 = Assign last instruction counts \n 5 = Assign last instruction counts and merit\n 6 = Assign last instruction counts and gestation time \n 7 = Assign everything currently supported\nFitness will be evaluated for organism based on these settings.");
+  CONFIG_ADD_VAR(PHENOTYPE_CACHE_SIZE, int, 0, "Number of test CPU results cached per genotype for PRECALC_PHENOTYPE\n(0 = disabled).  Cache hits skip the test, so they do not draw random\nnumbers.  Tests with random inputs (e.g. test-on-divide) are never cached.");
   CONFIG_ADD_VAR(GENOTYPE_PHENPLAST_CALC, int, 100, "Number of times to test a genotype's\nplasticity during runtime.");
   
 
@@ -591,6 +600,7 @@ public:
   CONFIG_ADD_GROUP(GENEOLOGY_GROUP, "Geneology");
   CONFIG_ADD_VAR(THRESHOLD, int, 3, "Number of organisms in a genotype needed for it\n  to be considered viable.");
   CONFIG_ADD_VAR(TEST_CPU_TIME_MOD, int, 20, "Time allocated in test CPUs (multiple of length)");
+  CONFIG_ADD_VAR(TEST_CPU_CHECKPOINT_INTERVAL, int, 0, "Cycles between checkpoints of a tested genome's gestation, from which the\n  tests of its point mutants in landscaping and mutational neighborhoods resume.\n  0 = Off, test every mutant from the start");
   
 
   // -------- Organism Network config options --------
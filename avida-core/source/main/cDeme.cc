@@ -29,6 +29,7 @@
 #include "cPopulation.h"
 #include "cPopulationCell.h"
 #include "cResource.h"
+#include "cResourceView.h"
 #include "cStats.h"
 #include "cWorld.h"
 #include "cOrgMessagePredicate.h"
@@ -334,6 +335,7 @@ int cDeme::GetNumOrgsWithOpinion() const
 
 void cDeme::ProcessPreUpdate()
 {
+  deme_resource_count.RebaseTimeSource();
   deme_resource_count.SetSpatialUpdate(m_world->GetStats().GetUpdate());
 }
 
@@ -1281,7 +1283,7 @@ void cDeme::DoDemeOutput(cAvidaContext& ctx, int value)
   cReactionResult& result = *m_reaction_result;
 
   // Not actually set up for deme's using resources during reactions
-  Apto::Array<double> res_in;
+  cResourceView res_in;
   Apto::Array<double> rbins_in;
 
   // The environment, evaluates if a task and if a resulting reaction were completed
@@ -36,6 +36,7 @@
 #include "cDoubleSum.h"
 
 class cResource;
+class cResourceUpdatePool;
 class cWorld;
 class cPopulationCell;
 class cOrganism;
@@ -275,6 +276,8 @@ public:
   void SetupDemeRes(int id, cResource * res, int verbosity, cWorld* world);                 
   void UpdateDemeRes(cAvidaContext& ctx) { deme_resource_count.GetResources(ctx); } 
   void Update(double time_step) { deme_resource_count.Update(time_step); }
+  void SetResourceTimeSource(const double* time_source) { deme_resource_count.SetTimeSource(time_source); }
+  void SetResourceUpdatePool(cResourceUpdatePool* pool) { deme_resource_count.SetUpdatePool(pool); }
   int GetRelativeCellID(int absolute_cell_id) const { return absolute_cell_id % GetSize(); } //!< assumes all demes are the same size
   int GetAbsoluteCellID(int relative_cell_id) const { return relative_cell_id + (_id * GetSize()); } //!< assumes all demes are the same size
 	
@@ -43,6 +43,7 @@
 #include "cReactionRequisite.h"
 #include "cReactionResult.h"
 #include "cResource.h"
+#include "cResourceView.h"
 #include "cStateGrid.h"
 #include "cStringUtil.h"
 #include "cTaskEntry.h"
@@ -58,6 +59,7 @@ m_use_specific_inputs(false), m_specific_inputs(), m_mask(0), m_hammers(false),
   mut_rates.Setup(world);
   if (m_world->GetConfig().DEFAULT_GROUP.Get() != -1) possible_group_ids.insert(m_world->GetConfig().DEFAULT_GROUP.Get());
   pp_fts.Resize(0);
+  BuildReactionIndex();
 }
 
 cEnvironment::~cEnvironment()
@@ -1164,6 +1166,9 @@ bool cEnvironment::LoadLine(cString line, Feedback& feedback)
     return false;
   }
 
+  // Reactions (including placeholders created for requisites) may have been added, so the dispatch index is rebuilt
+  if (type == "REACTION") BuildReactionIndex();
+
   if (load_ok == false) {
     feedback.Error("failed in loading '%s'", (const char*)type);
     return false;
@@ -1276,7 +1281,7 @@ bool cEnvironment::TestInput(cReactionResult&, const tBuffer<int>&, const tBuffe
 bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
                               cTaskContext& taskctx, const Apto::Array<int>& task_count,
                               Apto::Array<int>& reaction_count,
-                              const Apto::Array<double>& resource_count,
+                              const cResourceView& resource_count,
                               const Apto::Array<double>& rbins_count,
                               bool is_parasite, cContextPhenotype* context_phenotype) const
 {
@@ -1289,9 +1294,22 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
   // Do setup for reaction tests...
   m_tasklib.SetupTests(taskctx);
 
-  // Loop through all reactions to see if any have been triggered...
-  const int num_reactions = reaction_lib.GetSize();
-  for (int i = 0; i < num_reactions; i++) {
+  // Only the reactions that can trigger for this logic id and divide state need to be visited, in reaction order.
+  // Parasites that skip reaction processing still mark tasks without meeting requisites, so they visit every reaction.
+  const Apto::Array<int>* candidates = NULL;
+  if (!skipProcessing) {
+    const int logic_id = taskctx.GetLogicId();
+    const int key = (logic_id >= 0 && logic_id < cTaskEntry::NUM_LOGIC_IDS) ? logic_id : cTaskEntry::NUM_LOGIC_IDS;
+    candidates = &m_reaction_index[(taskctx.GetOnDivide()) ? 1 : 0][key];
+  }
+
+  // Context phenotypes only need their count arrays sized to match, nothing is added to them here
+  Apto::Array<int> no_counts;
+
+  // Loop through the candidate reactions to see if any have been triggered...
+  const int num_candidates = (candidates) ? candidates->GetSize() : reaction_lib.GetSize();
+  for (int c = 0; c < num_candidates; c++) {
+    const int i = (candidates) ? (*candidates)[c] : c;
     cReaction* cur_reaction = reaction_lib.GetReaction(i);
     assert(cur_reaction != NULL);
 
@@ -1315,18 +1333,8 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
     }
 
     if (context_phenotype != 0) {
-      Apto::Array<int> blank_tasks;
-      Apto::Array<int> blank_reactions;
-      blank_tasks.ResizeClear(task_count.GetSize());
-      for(int count=0;count<task_count.GetSize();count++) {
-        blank_tasks[count] = 0;
-      }
-      blank_reactions.ResizeClear(this->GetReactionLib().GetSize());
-      for(int count=0;count<reaction_count.GetSize();count++) {
-        blank_reactions[count] = 0;
-      }
-      context_phenotype->AddTaskCounts(blank_tasks.GetSize(), blank_tasks);
-      context_phenotype->AddReactionCounts(blank_reactions.GetSize(), blank_reactions);
+      context_phenotype->AddTaskCounts(task_count.GetSize(), no_counts);
+      context_phenotype->AddReactionCounts(reaction_lib.GetSize(), no_counts);
       int context_task_count = context_phenotype->GetTaskCounts()[task_id];
       if (TestContextRequisites(cur_reaction, context_task_count, context_phenotype->GetReactionCounts(), on_divide) == false) {
         if (!skipProcessing) {  // for those parasites again
@@ -1335,7 +1343,9 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
       }
     }
 
-    const double task_quality = m_tasklib.TestOutput(taskctx);
+    // Logic-only tasks are resolved against their precomputed logic id set without calling the test
+    const double task_quality = (cur_task->IsLogicOnly()) ? ((cur_task->AcceptsLogicId(taskctx.GetLogicId())) ? 1.0 : 0.0)
+                                                         : m_tasklib.TestOutput(taskctx);
     assert(task_quality >= 0.0);
 
     // If this task wasn't performed, move on to the next one.
@@ -1458,6 +1468,56 @@ bool cEnvironment::TestRequisites(cTaskContext& taskctx, const cReaction* cur_re
 }
 
 
+bool cEnvironment::CanMeetRequisites(const cReaction* cur_reaction, const bool on_divide) const
+{
+  // Mirrors the divide checks in TestRequisites: a reaction with no requisites only triggers on IO, otherwise at
+  // least one requisite must be checked for the given divide state
+  const tList<cReactionRequisite>& req_list = cur_reaction->GetRequisites();
+  if (req_list.GetSize() == 0) return !on_divide;
+
+  tLWConstListIterator<cReactionRequisite> req_it(req_list);
+  while (req_it.Next() != NULL) {
+    int div_type = req_it.Get()->GetDivideOnly();
+    if (div_type == 1 && !on_divide) continue;
+    if (div_type == 0 && on_divide) continue;
+    return true;
+  }
+
+  return false;
+}
+
+
+void cEnvironment::BuildReactionIndex()
+{
+  const int num_keys = cTaskEntry::NUM_LOGIC_IDS + 1;
+  const int num_reactions = reaction_lib.GetSize();
+
+  for (int div = 0; div < 2; div++) {
+    Apto::Array<Apto::Array<int> >& index = m_reaction_index[div];
+    index.ResizeClear(num_keys);
+    for (int key = 0; key < num_keys; key++) index[key].Resize(0);
+
+    for (int i = 0; i < num_reactions; i++) {
+      const cReaction* cur_reaction = reaction_lib.GetReaction(i);
+      if (cur_reaction == NULL || !CanMeetRequisites(cur_reaction, (div == 1))) continue;
+
+      // Logic-only tasks can only be performed for the logic ids they accept, unless a phenotypic plasticity bonus
+      // method may force the task to be marked anyway
+      const cTaskEntry* cur_task = cur_reaction->GetTask();
+      bool logic_only = (cur_task != NULL && cur_task->IsLogicOnly());
+      tLWConstListIterator<cReactionProcess> proc_it(cur_reaction->GetProcesses());
+      while (logic_only && proc_it.Next() != NULL) {
+        if (proc_it.Get()->GetPhenPlastBonusMethod() != DEFAULT) logic_only = false;
+      }
+
+      for (int key = 0; key < num_keys; key++) {
+        if (!logic_only || (key < cTaskEntry::NUM_LOGIC_IDS && cur_task->AcceptsLogicId(key))) index[key].Push(i);
+      }
+    }
+  }
+}
+
+
 bool cEnvironment::TestContextRequisites(const cReaction* cur_reaction,
 					 int task_count, const Apto::Array<int>& reaction_count,
 					 const bool on_divide) const
@@ -1563,7 +1623,7 @@ double cEnvironment::GetTaskProbability(cAvidaContext& ctx, cTaskContext& taskct
 
 
 void cEnvironment::DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>& process_list,
-                               const Apto::Array<double>& resource_count, const Apto::Array<double>& rbins_count,
+                               const cResourceView& resource_count, const Apto::Array<double>& rbins_count,
                                const double task_quality, const double task_probability, const int task_count,
                                const int reaction_id, cReactionResult& result, cTaskContext& taskctx) const
 {
@@ -1924,6 +1984,7 @@ bool cEnvironment::SetReactionTask(const cString& name, const cString& task)
     if (m_tasklib.GetTask(i).GetName() == task)
     {
       found_reaction->SetTask( m_tasklib.GetTaskReference(i) );
+      BuildReactionIndex();
       return true;
     }
   }
@@ -46,6 +46,7 @@ class cReaction;
 class cReactionRequisite;
 class cReactionProcess;
 class cReactionResult;
+class cResourceView;
 class cStateGrid;
 class cTaskContext;
 class cWorld;
@@ -82,6 +83,10 @@ private:
   
   bool m_hammers;
   bool m_paths;
+
+  // Reaction dispatch index, rebuilt whenever the reaction set changes (see BuildReactionIndex).  For IO and divide
+  // tests, one list of candidate reaction ids per logic id, plus a final list used for invalid logic ids.
+  Apto::Array<Apto::Array<int> > m_reaction_index[2];
   
   cEnvironment(); // @not_implemented
   cEnvironment(const cEnvironment&); // @not_implemented
@@ -106,7 +111,7 @@ public:
 
   bool TestOutput(cAvidaContext& ctx, cReactionResult& result, cTaskContext& taskctx,
                   const Apto::Array<int>& task_count, Apto::Array<int>& reaction_count,
-                  const Apto::Array<double>& resource_count, const Apto::Array<double>& rbins_count,
+                  const cResourceView& resource_count, const Apto::Array<double>& rbins_count,
                   bool is_parasite=false, cContextPhenotype* context_phenotype = 0) const;
 
   // Accessors
@@ -191,8 +196,10 @@ private:
                       const Apto::Array<int>& reaction_count, const bool on_divide = false, bool is_parasite=false) const;
   bool TestContextRequisites(const cReaction* cur_reaction, int task_count, 
                       const Apto::Array<int>& reaction_count, const bool on_divide = false) const;
+  bool CanMeetRequisites(const cReaction* cur_reaction, const bool on_divide) const;
+  void BuildReactionIndex();
   void DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>& process_list, 
-                   const Apto::Array<double>& resource_count, const Apto::Array<double>& rbin_count,
+                   const cResourceView& resource_count, const Apto::Array<double>& rbin_count,
                    const double task_quality, const double task_probability,
                    const int task_count, const int reaction_id, 
                    cReactionResult& result, cTaskContext& taskctx) const;
@@ -120,6 +120,7 @@ cGradientCount::cGradientCount(cWorld* world, int peakx, int peaky, int height,
   , m_max_usedx(-1)
   , m_max_usedy(-1)
 {
+  enableChangeTracking();
   ResetGradRes(m_world->GetDefaultContext(), worldx, worldy);
 }
 
@@ -132,6 +133,7 @@ void cGradientCount::StateAll()
 
 void cGradientCount::UpdateCount(cAvidaContext& ctx)
 { 
+  startChangeGeneration();
   m_old_peakx = m_peakx;
   m_old_peaky = m_peaky;
   if (m_habitat == 2) generateBarrier(ctx);
@@ -155,7 +157,7 @@ void cGradientCount::updatePeakRes(cAvidaContext& ctx)
     int min_pos_y = max(m_peaky - m_spread - 1, 0);
     for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
       for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
-        if (Element(jj * GetX() + ii).GetAmount() >= 1) {
+        if (GetAmount(jj * GetX() + ii) >= 1) {
           has_edible = true;
           break;
         }
@@ -274,20 +276,29 @@ void cGradientCount::fillinResourceValues()
   int min_pos_y;
   resetUsedBounds();
 
-  // if we are resetting a resource, we need to calculate new values for the whole world so we can wipe away any residue
+  // if we are resetting a resource, we need to wipe away any residue.  Every cell outside the touched box has been zero
+  // since the last reset, so only the touched box and the new peak need to be calculated
   if (m_just_reset) {
-    if (m_min_usedx == -1 || m_min_usedy == -1 || m_max_usedx == -1 || m_max_usedy == -1) {
-      max_pos_x = GetX() - 1;
-      min_pos_x = 0;
-      max_pos_y = GetY() - 1;
-      min_pos_y = 0;
+    sCellBox sweep = getTouchedBox();
+    max_pos_x = min(m_peakx + m_spread, GetX() - 1);
+    min_pos_x = max(m_peakx - m_spread, 0);
+    max_pos_y = min(m_peaky + m_spread, GetY() - 1);
+    min_pos_y = max(m_peaky - m_spread, 0);
+    if (min_pos_x <= max_pos_x && min_pos_y <= max_pos_y) {
+      GrowBox(sweep, min_pos_x, min_pos_y);
+      GrowBox(sweep, max_pos_x, max_pos_y);
     }
-    else {
-      max_pos_x = m_max_usedx;
-      min_pos_x = m_min_usedx;
-      max_pos_y = m_max_usedy;
-      min_pos_y = m_min_usedy;
+    if (IsEmptyBox(sweep)) {
+      // nothing to draw or wipe
+      max_pos_x = -1;
+      min_pos_x = 0;
+    } else {
+      max_pos_x = sweep.max_x;
+      min_pos_x = sweep.min_x;
+      max_pos_y = sweep.max_y;
+      min_pos_y = sweep.min_y;
     }
+    clearTouchedBox();
   } else {
     // otherwise we only need to update values within the possible range of the peak 
     // we check all the way back to move_speed to make sure we're not leaving any old residue behind
@@ -315,8 +326,10 @@ void cGradientCount::fillinResourceValues()
   for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
     for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
       double thisheight = 0.0;
-      double thisdist = sqrt((double) (m_peakx - ii) * (m_peakx - ii) + (m_peaky - jj) * (m_peaky - jj));
-      if (m_spread >= thisdist) {
+      // cells outside the spread are always zero, compare squared distances so those skip the sqrt
+      const int sqr_dist = (m_peakx - ii) * (m_peakx - ii) + (m_peaky - jj) * (m_peaky - jj);
+      if (m_spread >= 0 && sqr_dist <= m_spread * m_spread) {
+        double thisdist = sqrt((double) sqr_dist);
         // determine theoretical individual cells values and add one to distance from center 
         // (so that center point = radius 1, not 0)
         // also used to distinguish plateau cells
@@ -378,7 +391,7 @@ void cGradientCount::fillinResourceValues()
               thisheight = 0;
             }
             else {
-              double past_height = Element(old_cell_y * GetX() + old_cell_x).GetAmount(); 
+              double past_height = GetAmount(old_cell_y * GetX() + old_cell_x); 
               double newheight = past_height; 
               if (m_cone_inflow > 0 || m_cone_outflow > 0) newheight += m_cone_inflow - (past_height * m_cone_outflow);
               if (m_gradient_inflow > 0) newheight += m_gradient_inflow / (thisdist + 1); 
@@ -389,8 +402,10 @@ void cGradientCount::fillinResourceValues()
           }
         }
       }
-      Element(jj * GetX() + ii).SetAmount(thisheight);
+      SetCellAmount(jj * GetX() + ii, thisheight);
       if (thisheight > 0) updateBounds(ii, jj);
+      // unchanged cells are not marked, but after a reset the touched box must hold every nonzero cell
+      if (m_just_reset && thisheight != 0) touchCell(ii, jj);
     }
   }         
   SetCurrPeakX(m_peakx);
@@ -415,7 +430,7 @@ void cGradientCount::getCurrentPlatValues()
       double find_plat_dist = temp_height / (thisdist + 1);
       if ((find_plat_dist >= 1 && m_plateau >= 0) || (m_plateau < 0 && thisdist == 0 && m_plateau_array.GetSize() > 0)) {
         double past_cell_height = m_plateau_array[plateau_cell];
-        double pre_move_height = Element(m_plateau_cell_IDs[plateau_cell]).GetAmount();  
+        double pre_move_height = GetAmount(m_plateau_cell_IDs[plateau_cell]);  
         if (pre_move_height < past_cell_height) {
           m_plateau_array[plateau_cell] = pre_move_height; 
           amount_devoured = amount_devoured + past_cell_height - pre_move_height;
@@ -661,15 +676,11 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
     // clear any old resource
     if (m_wall_cells.GetSize()) {
       for (int i = 0; i < m_wall_cells.GetSize(); i++) {
-        Element(m_wall_cells[i]).SetAmount(0);
+        SetCellAmount(m_wall_cells[i], 0);
       }
     }
     else {
-      for (int ii = 0; ii < GetX(); ii++) {
-        for (int jj = 0; jj < GetY(); jj++) {
-          Element(jj * GetX() + ii).SetAmount(0);
-        }
-      }
+      clearTouchedCells();
     }
     m_wall_cells.Resize(0);
     // generate number barriers equal to count 
@@ -685,7 +696,7 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
         start_randx = ctx.GetRandom().GetUInt(0, GetX());
         start_randy = ctx.GetRandom().GetUInt(0, GetY());  
       }
-      Element(start_randy * GetX() + start_randx).SetAmount(m_plateau);
+      SetCellAmount(start_randy * GetX() + start_randx, m_plateau);
       // if (m_plateau > 0) updateBounds(start_randx, start_randy);
       updateBounds(start_randx, start_randy);
       m_wall_cells.Push(start_randy * GetX() + start_randx);
@@ -779,12 +790,12 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
                randy < (m_halo_anchor_y + m_halo_inner_radius) && 
                randx > (m_halo_anchor_x - m_halo_inner_radius) && 
                randy > (m_halo_anchor_y - m_halo_inner_radius)) || 
-              (m_config == 0 && Element(randy * GetX() + randx).GetAmount())) {
+              (m_config == 0 && GetAmount(randy * GetX() + randx))) {
             num_blocks --;
             count_block = false;
           }
           if (count_block) {
-            Element(randy * GetX() + randx).SetAmount(m_plateau);
+            SetCellAmount(randy * GetX() + randx, m_plateau);
             if (m_plateau > 0) updateBounds(randx, randy);
             m_wall_cells.Push(randy * GetX() + randx);
             if (place_corner) {
@@ -793,7 +804,7 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
                      cornery < (m_halo_anchor_y + m_halo_inner_radius) && 
                      cornerx > (m_halo_anchor_x - m_halo_inner_radius) && 
                      cornery > (m_halo_anchor_y - m_halo_inner_radius))) ){
-                  Element(cornery * GetX() + cornerx).SetAmount(m_plateau);
+                  SetCellAmount(cornery * GetX() + cornerx, m_plateau);
                   if (m_plateau > 0) updateBounds(cornerx, cornery);
                   m_wall_cells.Push(randy * GetX() + randx);
                 }
@@ -829,20 +840,7 @@ void cGradientCount::generateHills(cAvidaContext& ctx)
     // reset counter
     m_topo_counter = 1;
     // since we are potentially plotting more than one hill per resource, we need to wipe the world before we start
-    if (m_min_usedx == -1 || m_min_usedy == -1 || m_max_usedx == -1 || m_max_usedy == -1) {
-      for (int ii = 0; ii < GetX(); ii++) {
-        for (int jj = 0; jj < GetY(); jj++) {
-          Element(jj * GetX() + ii).SetAmount(0);
-        }
-      }
-    }
-    else {
-      for (int ii = m_min_usedx; ii < m_max_usedx + 1; ii++) {
-        for (int jj = m_min_usedy; jj < m_max_usedy + 1; jj++) {
-          Element(jj * GetX() + ii).SetAmount(0);
-        }
-      }
-    }
+    clearTouchedCells();
 
     Apto::Random& rng = ctx.GetRandom();
     // generate number hills equal to count
@@ -879,9 +877,9 @@ void cGradientCount::generateHills(cAvidaContext& ctx)
           double thisheight = 0.0;
           double thisdist = sqrt((double) (m_peakx - ii) * (m_peakx - ii) + (m_peaky - jj) * (m_peaky - jj));
           // only plot values when within set config radius & if no larger amount has already been plotted for another overlapping hill
-          if ((thisdist <= rand_hill_radius) && (Element(jj * GetX() + ii).GetAmount() <  m_plateau / (thisdist + 1))) {
+          if ((thisdist <= rand_hill_radius) && (GetAmount(jj * GetX() + ii) <  m_plateau / (thisdist + 1))) {
           thisheight = m_plateau / (thisdist + 1);
-          Element(jj * GetX() + ii).SetAmount(thisheight);
+          SetCellAmount(jj * GetX() + ii, thisheight);
           if (thisheight > 0) updateBounds(ii, jj);
           }
         }
@@ -933,6 +931,9 @@ void cGradientCount::ResetGradRes(cAvidaContext& ctx, int worldx, int worldy)
     UpdateCount(ctx);
   }
   
+  // the resize cleared the entire grid
+  markAllChanged();
+  
   // set m_initial to false now that we have reset the resource
   m_initial = false;
 }
@@ -970,7 +971,7 @@ void cGradientCount::UpdatePredatoryRes(cAvidaContext& ctx)
   // kill off up to 1 org per update within the predator radius (plateau area), with prob of death for selected prey = m_pred_odds
   if (m_predator) {
     for (int i = 0; i < m_plateau_cell_IDs.GetSize(); i ++) {
-      if (Element(m_plateau_cell_IDs[i]).GetAmount() >= 1) {
+      if (GetAmount(m_plateau_cell_IDs[i]) >= 1) {
         m_world->GetPopulation().ExecutePredatoryResource(ctx, m_plateau_cell_IDs[i], m_pred_odds, m_guarded_juvs_per_adult, m_hammer);
       }
     }
@@ -989,7 +990,7 @@ void cGradientCount::UpdateDamagingRes(cAvidaContext& ctx)
   // we don't call this for walls and hills because they never move
   if (m_damage) {
     for (int i = 0; i < m_plateau_cell_IDs.GetSize(); i ++) {
-      if (Element(m_plateau_cell_IDs[i]).GetAmount() >= m_threshold) {
+      if (GetAmount(m_plateau_cell_IDs[i]) >= m_threshold) {
         // skip if initiating world and resources (cells don't exist yet)
         if (ctx.HasDriver()) m_world->GetPopulation().ExecuteDamagingResource(ctx, m_plateau_cell_IDs[i], m_damage, m_hammer);
       }
@@ -1002,7 +1003,7 @@ void cGradientCount::UpdateDeadlyRes(cAvidaContext& ctx)
   // we don't call this for walls and hills because they never move
   if (m_deadly) {
     for (int i = 0; i < m_plateau_cell_IDs.GetSize(); i ++) {
-      if (Element(m_plateau_cell_IDs[i]).GetAmount() >= m_threshold) {
+      if (GetAmount(m_plateau_cell_IDs[i]) >= m_threshold) {
         // skip if initiating world and resources (cells don't exist yet)
         if (ctx.HasDriver()) m_world->GetPopulation().ExecuteDeadlyResource(ctx, m_plateau_cell_IDs[i], m_death_odds, m_hammer);
       }
@@ -1044,7 +1045,7 @@ void cGradientCount::BuildProbabilisticRes(cAvidaContext& ctx, double lambda, do
 
   // only if theta == 1 do want want a 'hill' with resource for certain in the center
   if (theta == 0) {
-    Element(m_peaky * worldx + m_peakx).SetAmount(m_initial_plat);
+    SetCellAmount(m_peaky * worldx + m_peakx, m_initial_plat);
     if (m_initial_plat > 0) updateBounds(m_peakx, m_peaky);
     if (m_plateau_outflow > 0 || m_plateau_inflow > 0) { 
       if (num_cells == -1) m_prob_res_cells.Push(m_peaky * worldx + m_peakx);
@@ -1079,7 +1080,7 @@ void cGradientCount::BuildProbabilisticRes(cAvidaContext& ctx, double lambda, do
     double this_prob = (1/lambda) * (sqrt(2 / 3.14159)) * exp(-0.5 * pow(((cell_dist - theta) / lambda), 2));
     
     if (ctx.GetRandom().P(this_prob)) {
-      Element(cell_id).SetAmount(m_initial_plat);
+      SetCellAmount(cell_id, m_initial_plat);
       if (m_initial_plat > 0) updateBounds(this_x, this_y);
       if (m_plateau_outflow > 0 || m_plateau_inflow > 0) {
         if (loop_once) m_prob_res_cells.Push(cell_id);
@@ -1090,7 +1091,7 @@ void cGradientCount::BuildProbabilisticRes(cAvidaContext& ctx, double lambda, do
     }
     // just push this cell out of the way for this loop, but keep it around for next time
     else { 
-      Element(cell_id).SetAmount(0); 
+      SetCellAmount(cell_id, 0); 
       cell_id_array.Swap(cell_idx, max_unused_idx--);
     }
 
@@ -1106,9 +1107,9 @@ void cGradientCount::UpdateProbabilisticRes()
 {
   if (m_plateau_outflow > 0 || m_plateau_inflow > 0) {
     for (int i = 0; i < m_prob_res_cells.GetSize(); i++) {
-      double curr_val = Element(m_prob_res_cells[i]).GetAmount();
+      double curr_val = GetAmount(m_prob_res_cells[i]);
       double amount = curr_val + m_plateau_inflow - (curr_val * m_plateau_outflow);
-      Element(m_prob_res_cells[i]).SetAmount(amount); 
+      SetCellAmount(m_prob_res_cells[i], amount); 
       if (amount > 0) updateBounds(m_prob_res_cells[i] % GetX(), m_prob_res_cells[i] / GetX());
     }
   }
@@ -1118,9 +1119,23 @@ void cGradientCount::clearExistingProbRes()
 {
   for (int x = m_min_usedx; x < m_max_usedx + 1; x ++) {
     for (int y = m_min_usedy; y < m_max_usedy + 1; y ++) {
-      Element(y * GetX() + x).SetAmount(0);
+      SetCellAmount(y * GetX() + x, 0);
+    }
+  }
+}
+
+void cGradientCount::clearTouchedCells()
+{
+  // every cell outside the touched box is already zero
+  const sCellBox& touched = getTouchedBox();
+  if (!IsEmptyBox(touched)) {
+    for (int ii = touched.min_x; ii < touched.max_x + 1; ii++) {
+      for (int jj = touched.min_y; jj < touched.max_y + 1; jj++) {
+        SetCellAmount(jj * GetX() + ii, 0);
+      }
     }
   }
+  clearTouchedBox();
 }
 
 void cGradientCount::updateBounds(int x, int y)
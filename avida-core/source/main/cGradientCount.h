@@ -129,6 +129,7 @@ public:
 
   void UpdateCount(cAvidaContext& ctx);
   void StateAll();
+  bool IsGradient() const { return true; }
   
   void SetGradInitialPlat(double plat_val) { m_initial_plat = plat_val; m_initial = true; }
   void SetGradPeakX(int peakx) { m_peakx = peakx; }
@@ -201,6 +202,7 @@ private:
   void updateBounds(int x, int y);
   void resetUsedBounds();
   void clearExistingProbRes();
+  void clearTouchedCells();
   
   inline void setHaloDirection(cAvidaContext& ctx);
 };
@@ -24,6 +24,7 @@
 
 #include "avida/output/File.h"
 
+#include "cAnalyze.h"
 #include "cCPUMemory.h"
 #include "cEnvironment.h"
 #include "cInstSet.h"
@@ -33,10 +34,17 @@
 #include "cStats.h"             // For GetUpdate in outputs...
 #include "cTestCPU.h"
 #include "cWorld.h"
+#include "tAnalyzeJobBatch.h"
+
+
+// Fitness recorded for a mutant that is identical to one tested by the previous unit
+static const double DUPLICATE_MUTANT = -1.0;
 
 
 cLandscape::cLandscape(cWorld* world, const Genome& in_genome)
 : m_world(world), trials(1), m_min_found(0), m_max_trials(0), site_count(NULL)
+, m_unit_mode(UNIT_POINT), m_prune_duplicates(true)
+, m_checkpoints(world->GetConfig().TEST_CPU_CHECKPOINT_INTERVAL.Get())
 {
   Reset(in_genome);
 }
@@ -44,6 +52,7 @@ cLandscape::cLandscape(cWorld* world, const Genome& in_genome)
 cLandscape::~cLandscape()
 {
   if (site_count != NULL) delete [] site_count;
+  clearUnits();
 }
 
 void cLandscape::Reset(const Genome& in_genome)
@@ -100,6 +109,17 @@ double cLandscape::ProcessGenome(cAvidaContext& ctx, cTestCPU* testcpu, Genome&
   
   double test_fitness = m_cpu_test_info.GetColonyFitness();
   
+  addFitness(test_fitness);
+  if (test_fitness > neut_max && test_fitness > peak_fitness) {
+    peak_fitness = test_fitness;
+    peak_genome = in_genome;
+  }
+  
+  return test_fitness;
+}
+
+void cLandscape::addFitness(double test_fitness)
+{
   total_fitness += test_fitness;
   total_sqr_fitness += test_fitness * test_fitness;
   total_count++;
@@ -113,20 +133,14 @@ double cLandscape::ProcessGenome(cAvidaContext& ctx, cTestCPU* testcpu, Genome&
   } else {
     pos_count++;
     pos_size = pos_size + test_fitness  ;
-    if (test_fitness > peak_fitness) {
-      peak_fitness = test_fitness;
-      peak_genome = in_genome;
-    }
   }
-  
-  return test_fitness;
 }
 
 void cLandscape::ProcessBase(cAvidaContext& ctx, cTestCPU* testcpu)
 {
-  // Collect info on base creature.
+  // Collect info on base creature, recording checkpoints for its point mutants when enabled.
   
-  testcpu->TestGenome(ctx, m_cpu_test_info, base_genome);
+  testcpu->TestGenome(ctx, m_cpu_test_info, base_genome, m_checkpoints);
   
   cPhenotype & phenotype = m_cpu_test_info.GetColonyOrganism()->GetPhenotype();
   base_fitness = m_cpu_test_info.GetColonyFitness();
@@ -143,16 +157,19 @@ void cLandscape::ProcessBase(cAvidaContext& ctx, cTestCPU* testcpu)
 
 void cLandscape::Process(cAvidaContext& ctx)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   
   // Get the info about the base creature.
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   
   // Now Process the new creature at the proper distance.
-  Process_Body(ctx, testcpu, base_genome, distance, 0);
+  setupUnits(UNIT_POINT);
+  runUnits(ctx, testcpu.Get());
+  completeProcess();
+}
 
-  delete testcpu;
-  
+void cLandscape::completeProcess()
+{
   // Calculate the complexity...
   
   double max_ent = log((double) m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize());
@@ -172,16 +189,16 @@ void cLandscape::Process(cAvidaContext& ctx)
 }
 
 
-// For distances greater than one, this needs to be called recursively.
+// For distances greater than one, this needs to be called recursively.  Lines start_line through end_line - 1 are
+// mutated at this distance; a unit covers a single line of the outermost mutation.
 
-void cLandscape::Process_Body(cAvidaContext& ctx, cTestCPU* testcpu, Genome& cur_genome,
-                              int cur_distance, int start_line)
+void cLandscape::Process_Body(cAvidaContext& ctx, cTestCPU* testcpu, sUnit& unit, Genome& cur_genome,
+                              int cur_distance, int start_line, int end_line)
 {
   ConstInstructionSequencePtr base_seq_p;
   GeneticRepresentationPtr rep_p = base_genome.Representation();
   base_seq_p.DynamicCastFrom(rep_p);
   const InstructionSequence& base_seq = *base_seq_p;
-  const int max_line = base_seq.GetSize() - cur_distance + 1;
   const int inst_size = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize();
   
   Genome mg(cur_genome);
@@ -191,7 +208,7 @@ void cLandscape::Process_Body(cAvidaContext& ctx, cTestCPU* testcpu, Genome& cur
   InstructionSequence& mod_genome = *mod_seq_p;
   
   // Loop through all the lines of genome, testing trying all combinations.
-  for (int line_num = start_line; line_num < max_line; line_num++) {
+  for (int line_num = start_line; line_num < end_line; line_num++) {
     int cur_inst = base_seq[line_num].GetOp();
     
     // Loop through all instructions...
@@ -200,10 +217,10 @@ void cLandscape::Process_Body(cAvidaContext& ctx, cTestCPU* testcpu, Genome& cur
       
       mod_genome[line_num].SetOp(inst_num);
       if (cur_distance <= 1) {
-        ProcessGenome(ctx, testcpu, mg);
-        if (m_cpu_test_info.GetColonyFitness() >= neut_min) site_count[line_num]++;
+        testUnitGenome(ctx, testcpu, unit, mg, (distance == 1) ? line_num : -1);
+        unit.site.Push(line_num);
       } else {
-        Process_Body(ctx, testcpu, mg, cur_distance - 1, line_num + 1);
+        Process_Body(ctx, testcpu, unit, mg, cur_distance - 1, line_num + 1, base_seq.GetSize() - cur_distance + 2);
       }
     }
     
@@ -219,10 +236,10 @@ void cLandscape::ProcessDump(cAvidaContext& ctx, Avida::Output::File& df)
   df.WriteComment("Detailed dump of the per-site, per-instruction fitness");
   df.WriteComment("values for the entire single-step landscape.");
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   
   // Get the info about the base creature.
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   ConstInstructionSequencePtr base_seq_p;
   GeneticRepresentationPtr rep_p = base_genome.Representation();
   base_seq_p.DynamicCastFrom(rep_p);
@@ -248,7 +265,7 @@ void cLandscape::ProcessDump(cAvidaContext& ctx, Avida::Output::File& df)
         fitness = base_fitness;
       } else {
         mod_genome[line_num].SetOp(inst_num);
-        fitness = ProcessGenome(ctx, testcpu, mg);
+        fitness = ProcessGenome(ctx, testcpu.Get(), mg);
       }
       df.Write(fitness, "Mutation Fitness (instruction = column_number - 2)");
     }
@@ -256,91 +273,46 @@ void cLandscape::ProcessDump(cAvidaContext& ctx, Avida::Output::File& df)
     df.Endl();
     mod_genome[line_num].SetOp(cur_inst);
   }
-  
-  delete testcpu;
 }
 
 
 
 void cLandscape::ProcessDelete(cAvidaContext& ctx)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
 
   // Get the info about the base creature.
-  ProcessBase(ctx, testcpu);
-  ConstInstructionSequencePtr base_seq_p;
-  GeneticRepresentationPtr rep_p = base_genome.Representation();
-  base_seq_p.DynamicCastFrom(rep_p);
-  const InstructionSequence& base_seq = *base_seq_p;
-  const int max_line = base_seq.GetSize();
-
-  Genome mg(base_genome);
-  InstructionSequencePtr mod_seq_p;
-  GeneticRepresentationPtr mod_rep_p = mg.Representation();
-  mod_seq_p.DynamicCastFrom(mod_rep_p);
-  InstructionSequence& mod_seq = *mod_seq_p;
-  cCPUMemory mod_genome = mod_seq;
-  
-  // Loop through all the lines of genome, testing all deletions.
-  for (int line_num = 0; line_num < max_line; line_num++) {
-    int cur_inst = base_seq[line_num].GetOp();
-    mod_genome.Remove(line_num);
-    mod_seq = mod_genome;
-    ProcessGenome(ctx, testcpu, mg);
-    if (m_cpu_test_info.GetColonyFitness() >= neut_min) site_count[line_num]++;
-    mod_genome.Insert(line_num, Instruction(cur_inst));
-  }
+  ProcessBase(ctx, testcpu.Get());
   
-  delete testcpu;
+  // Test all deletions.
+  setupUnits(UNIT_DELETE);
+  runUnits(ctx, testcpu.Get());
 }
 
 void cLandscape::ProcessInsert(cAvidaContext& ctx)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
 
   // Get the info about the base creature.
-  ProcessBase(ctx, testcpu);
-  ConstInstructionSequencePtr base_seq_p;
-  GeneticRepresentationPtr rep_p = base_genome.Representation();
-  base_seq_p.DynamicCastFrom(rep_p);
-  const InstructionSequence& base_seq = *base_seq_p;
-  const int max_line = base_seq.GetSize();
-  const int inst_size = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize();
+  ProcessBase(ctx, testcpu.Get());
   
-  Genome mg(base_genome);
-  InstructionSequencePtr mod_seq_p;
-  GeneticRepresentationPtr mod_rep_p = mg.Representation();
-  mod_seq_p.DynamicCastFrom(mod_rep_p);
-  InstructionSequence& mod_seq = *mod_seq_p;
-  cCPUMemory mod_genome = mod_seq;
-  
-  // Loop through all the lines of genome, testing all insertions.
-  for (int line_num = 0; line_num <= max_line; line_num++) {
-    // Loop through all instructions...
-    for (int inst_num = 0; inst_num < inst_size; inst_num++) {
-      mod_genome.Insert(line_num, Instruction(inst_num));
-      mod_seq = mod_genome;
-      ProcessGenome(ctx, testcpu, mg);
-      if (m_cpu_test_info.GetColonyFitness() >= neut_min) site_count[line_num]++;
-      mod_genome.Remove(line_num);
-    }
-  }
-
-  delete testcpu;
+  // Test all insertions.
+  setupUnits(UNIT_INSERT);
+  runUnits(ctx, testcpu.Get());
 }
 
 // Prediction for a landscape where n sites are _randomized_.
 void cLandscape::PredictWProcess(cAvidaContext& ctx, Avida::Output::File& df, int update)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
 
   distance = 1;
   
   // Get the info about the base creature.
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   if (base_fitness == 0.0) return;
   
-  BuildFitnessChart(ctx, testcpu);
+  BuildFitnessChart(ctx, testcpu.Get());
   const int genome_size = fitness_chart.GetNumRows();
   const int inst_size = fitness_chart.GetNumCols();
   const double min_neut_fitness = 0.99;
@@ -447,23 +419,21 @@ void cLandscape::PredictWProcess(cAvidaContext& ctx, Avida::Output::File& df, in
     total_entropy += (log(static_cast<double>(site_count[i] + 1)) / max_ent);
   }
   complexity = base_seq.GetSize() - total_entropy;
-  
-  delete testcpu;
 }
 
 
 // Prediction for a landscape where n sites are _mutated_.
 void cLandscape::PredictNuProcess(cAvidaContext& ctx, Avida::Output::File& df, int update)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
 
   distance = 1;
   
   // Get the info about the base creature.
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   if (base_fitness == 0.0) return;
   
-  BuildFitnessChart(ctx, testcpu);
+  BuildFitnessChart(ctx, testcpu.Get());
   const int genome_size = fitness_chart.GetNumRows();
   const int inst_size = fitness_chart.GetNumCols();
   const double min_neut_fitness = 0.99;
@@ -594,8 +564,6 @@ void cLandscape::PredictNuProcess(cAvidaContext& ctx, Avida::Output::File& df, i
     total_entropy += (log(static_cast<double>(site_count[i] + 1)) / max_ent);
   }
   complexity = base_seq.GetSize() - total_entropy;
-  
-  delete testcpu;
 }
 
 
@@ -615,10 +583,10 @@ void cLandscape::SampleProcess(cAvidaContext& ctx)
   const InstructionSequence& base_seq = *base_seq_p;
   int genome_size = base_seq.GetSize();
 
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   cInstSet& inst_set = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue());
   
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   
   // Set to default number of trials if trials has not been specified
   if (trials == 0) trials = inst_set.GetSize() - 1;
@@ -634,13 +602,11 @@ void cLandscape::SampleProcess(cAvidaContext& ctx)
       
       // Make the change, and test it!
       mod_seq[line_num] = new_inst;
-      ProcessGenome(ctx, testcpu, mod_genome);
+      ProcessGenome(ctx, testcpu.Get(), mod_genome);
     }
     
     mod_seq[line_num] = cur_inst;
   }
-  
-  delete testcpu;
 }
 
 
@@ -658,9 +624,9 @@ void cLandscape::RandomProcess(cAvidaContext& ctx)
   const InstructionSequence& base_seq = *base_seq_p;
   int genome_size = base_seq.GetSize();
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   cInstSet& inst_set = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue());
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   
   // Set to default number of trials if trials has not been specified
   if (trials == 0) trials = inst_set.GetSize() - 1;
@@ -690,7 +656,7 @@ void cLandscape::RandomProcess(cAvidaContext& ctx)
     
     // And test it!
     
-    ProcessGenome(ctx, testcpu, mod_genome);
+    ProcessGenome(ctx, testcpu.Get(), mod_genome);
     
     
     // And reset the genome.
@@ -701,56 +667,26 @@ void cLandscape::RandomProcess(cAvidaContext& ctx)
   
   trials = cur_trial;
 
-  delete testcpu;
   
   m_num_found = total_found;
 }
 
 void cLandscape::BuildFitnessChart(cAvidaContext& ctx, cTestCPU* testcpu)
 {
-  // First, resize the fitness_chart.
-  ConstInstructionSequencePtr base_seq_p;
-  GeneticRepresentationPtr rep_p = base_genome.Representation();
-  base_seq_p.DynamicCastFrom(rep_p);
-  const InstructionSequence& base_seq = *base_seq_p;
-  const int max_line = base_seq.GetSize();
-  const int inst_size = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize();
-  fitness_chart.ResizeClear(max_line, inst_size);
-  
-  Genome mod_genome(base_genome);
-  InstructionSequencePtr mod_seq_p;
-  mod_seq_p.DynamicCastFrom(mod_genome.Representation());
-  InstructionSequence& mod_seq = *mod_seq_p;
-  
-  // Loop through all the lines of genome, testing trying all combinations.
-  for (int line_num = 0; line_num < max_line; line_num++) {
-    int cur_inst = base_seq[line_num].GetOp();
-    
-    // Loop through all instructions...
-    for (int inst_num = 0; inst_num < inst_size; inst_num++) {
-      if (cur_inst == inst_num) {
-        fitness_chart(line_num, inst_num) = base_fitness;
-        continue;
-      }
-      
-      mod_seq[line_num].SetOp(inst_num);
-      ProcessGenome(ctx, testcpu, mod_genome);
-      fitness_chart(line_num, inst_num) = m_cpu_test_info.GetColonyFitness();
-    }
-    
-    mod_seq[line_num].SetOp(cur_inst);
-  }
+  // Test all one step mutations, one chart row per unit.
+  setupUnits(UNIT_CHART);
+  runUnits(ctx, testcpu);
 }
 
 void cLandscape::TestPairs(cAvidaContext& ctx)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   cInstSet& inst_set = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue());
   
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   if (base_fitness == 0.0) return;
   
-  BuildFitnessChart(ctx, testcpu);
+  BuildFitnessChart(ctx, testcpu.Get());
   
   Genome mod_genome(base_genome);
   ConstInstructionSequencePtr base_seq_p;
@@ -779,55 +715,29 @@ void cLandscape::TestPairs(cAvidaContext& ctx)
       mut_insts[mut_num] = new_inst;
     }
     
-    TestMutPair(ctx, testcpu, mod_genome, mut_lines[0], mut_lines[1], mut_insts[0], mut_insts[1]);
+    TestMutPair(ctx, testcpu.Get(), mod_genome, mut_lines[0], mut_lines[1], mut_insts[0], mut_insts[1]);
   }
-  delete testcpu;
 }
 
 
 void cLandscape::TestAllPairs(cAvidaContext& ctx)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
 
-  ProcessBase(ctx, testcpu);
+  ProcessBase(ctx, testcpu.Get());
   if (base_fitness == 0.0) return;
   
-  BuildFitnessChart(ctx, testcpu);
+  BuildFitnessChart(ctx, testcpu.Get());
   
-  ConstInstructionSequencePtr base_seq_p;
-  GeneticRepresentationPtr rep_p = base_genome.Representation();
-  base_seq_p.DynamicCastFrom(rep_p);
-  const InstructionSequence& base_seq = *base_seq_p;
-  const int max_line = base_seq.GetSize();
-  const int inst_size = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize();
-  Genome mod_genome(base_genome);
-  Instruction inst1, inst2;
-  
-  // Loop through all the lines of genome, testing trying all combinations.
-  for (int line1_num = 0; line1_num < max_line - 1; line1_num++) {
-    for (int line2_num = line1_num + 1; line2_num < max_line; line2_num++) {
-      
-      // Loop through all instructions...
-      for (int inst1_num = 0; inst1_num < inst_size; inst1_num++) {
-        inst1.SetOp(inst1_num);
-        if (inst1 == base_seq[line1_num]) continue;
-        for (int inst2_num = 0; inst2_num < inst_size; inst2_num++) {
-          inst2.SetOp(inst2_num);
-          if (inst2 == base_seq[line2_num]) continue;
-          TestMutPair(ctx, testcpu, mod_genome, line1_num, line2_num, inst1, inst2);
-        } // inst2_num loop
-      } //inst1_num loop;
-      
-    } // line2_num loop
-  } // line1_num loop.
-  
-  delete testcpu;
+  // Test all pairs of mutations, one first line per unit.
+  setupUnits(UNIT_PAIRS);
+  runUnits(ctx, testcpu.Get());
 }
 
 
 void cLandscape::HillClimb(cAvidaContext& ctx, Avida::Output::File& df)
 {
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
   Genome cur_genome(base_genome);
   Genome mg(base_genome);
   InstructionSequencePtr mg_seq_p;
@@ -866,7 +776,7 @@ void cLandscape::HillClimb(cAvidaContext& ctx, Avida::Output::File& df)
       for (int inst_num = 0; inst_num < inst_size; inst_num++) {
         mod_genome.Insert(line_num, Instruction(inst_num));
         mg_seq = mod_genome;
-        ProcessGenome(ctx, testcpu, mg);
+        ProcessGenome(ctx, testcpu.Get(), mg);
         mod_genome.Remove(line_num);
       }
     }
@@ -877,7 +787,7 @@ void cLandscape::HillClimb(cAvidaContext& ctx, Avida::Output::File& df)
       int cur_inst = cur_seq[line_num].GetOp();
       mod_genome.Remove(line_num);
       mg_seq = mod_genome;
-      ProcessGenome(ctx, testcpu, mg);
+      ProcessGenome(ctx, testcpu.Get(), mg);
       mod_genome.Insert(line_num, Instruction(cur_inst));
     }
     
@@ -901,8 +811,6 @@ void cLandscape::HillClimb(cAvidaContext& ctx, Avida::Output::File& df)
     cur_genome = GetPeakGenome();
     gen++;
   }
-
-  delete testcpu;
 }
 
 
@@ -929,6 +837,13 @@ double cLandscape::TestMutPair(cAvidaContext& ctx, cTestCPU* testcpu, Genome& mo
   
   double mut1_fitness = fitness_chart(line1, mut1.GetOp()) / base_fitness;
   double mut2_fitness = fitness_chart(line2, mut2.GetOp()) / base_fitness;
+  addEpistasis(combo_fitness, mut1_fitness, mut2_fitness);
+  
+  return combo_fitness;
+}
+
+void cLandscape::addEpistasis(double combo_fitness, double mut1_fitness, double mut2_fitness)
+{
   double mult_combo = mut1_fitness * mut2_fitness;
     
   total_epi_count++;
@@ -944,8 +859,258 @@ double cLandscape::TestMutPair(cAvidaContext& ctx, cTestCPU* testcpu, Genome& mo
     no_epi_count++;
     no_epi_size = no_epi_size + combo_fitness;
   }
+}
+
+
+void cLandscape::setupUnits(eUnitMode mode)
+{
+  clearUnits();
   
-  return combo_fitness;
+  ConstInstructionSequencePtr base_seq_p;
+  GeneticRepresentationPtr rep_p = base_genome.Representation();
+  base_seq_p.DynamicCastFrom(rep_p);
+  const int genome_size = base_seq_p->GetSize();
+  
+  int num_units = 0;
+  switch (mode) {
+    case UNIT_POINT:  num_units = genome_size - distance + 1; break;
+    case UNIT_DELETE: num_units = genome_size;                break;
+    case UNIT_INSERT: num_units = genome_size + 1;            break;
+    case UNIT_PAIRS:  num_units = genome_size - 1;            break;
+    case UNIT_CHART:
+      num_units = genome_size;
+      fitness_chart.ResizeClear(genome_size, m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize());
+      break;
+  }
+  if (num_units < 0) num_units = 0;
+  
+  // Identical mutants are only tested once when the outcome of a test cannot vary between runs
+  m_prune_duplicates = !m_cpu_test_info.GetUseRandomInputs();
+  
+  m_unit_mode = mode;
+  m_units.Resize(num_units);
+  for (int i = 0; i < num_units; i++) {
+    m_units[i] = new sUnit;
+    m_units[i]->test_info.CopySettings(m_cpu_test_info);
+    m_units[i]->peak_fitness = base_fitness;
+    m_units[i]->peak_genome = base_genome;
+  }
+}
+
+void cLandscape::clearUnits()
+{
+  for (int i = 0; i < m_units.GetSize(); i++) delete m_units[i];
+  m_units.Resize(0);
+}
+
+void cLandscape::runUnits(cAvidaContext& ctx, cTestCPU* testcpu)
+{
+  for (int i = 0; i < m_units.GetSize(); i++) processUnit(ctx, testcpu, i);
+  mergeUnits();
+}
+
+// Genomes differing from the base only at point_site resume from the checkpoints of the base genome's gestation
+double cLandscape::testUnitGenome(cAvidaContext& ctx, cTestCPU* testcpu, sUnit& unit, Genome& genome, int point_site)
+{
+  if (point_site >= 0) testcpu->TestPointMutant(ctx, unit.test_info, genome, m_checkpoints, point_site);
+  else testcpu->TestGenome(ctx, unit.test_info, genome);
+  
+  double test_fitness = unit.test_info.GetColonyFitness();
+  unit.fitness.Push(test_fitness);
+  if (test_fitness > neut_max && test_fitness > unit.peak_fitness) {
+    unit.peak_fitness = test_fitness;
+    unit.peak_genome = genome;
+  }
+  
+  return test_fitness;
+}
+
+void cLandscape::processUnit(cAvidaContext& ctx, cTestCPU* testcpu, int unit_id)
+{
+  sUnit& unit = *m_units[unit_id];
+  
+  ConstInstructionSequencePtr base_seq_p;
+  GeneticRepresentationPtr rep_p = base_genome.Representation();
+  base_seq_p.DynamicCastFrom(rep_p);
+  const InstructionSequence& base_seq = *base_seq_p;
+  const int genome_size = base_seq.GetSize();
+  const int inst_size = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize();
+  
+  Genome mg(base_genome);
+  InstructionSequencePtr mod_seq_p;
+  GeneticRepresentationPtr mod_rep_p = mg.Representation();
+  mod_seq_p.DynamicCastFrom(mod_rep_p);
+  InstructionSequence& mod_seq = *mod_seq_p;
+  
+  switch (m_unit_mode) {
+    case UNIT_POINT:
+      Process_Body(ctx, testcpu, unit, base_genome, distance, unit_id, unit_id + 1);
+      break;
+      
+    case UNIT_DELETE:
+    {
+      // Deleting any one instruction of a run of identical instructions yields the same genome
+      if (m_prune_duplicates && unit_id > 0 && base_seq[unit_id] == base_seq[unit_id - 1]) {
+        unit.fitness.Push(DUPLICATE_MUTANT);
+        break;
+      }
+      cCPUMemory mod_genome = mod_seq;
+      mod_genome.Remove(unit_id);
+      mod_seq = mod_genome;
+      testUnitGenome(ctx, testcpu, unit, mg);
+      break;
+    }
+      
+    case UNIT_INSERT:
+    {
+      cCPUMemory mod_genome = mod_seq;
+      for (int inst_num = 0; inst_num < inst_size; inst_num++) {
+        // Inserting an instruction after an identical one yields the same genome as inserting it before
+        if (m_prune_duplicates && unit_id > 0 && base_seq[unit_id - 1].GetOp() == inst_num) {
+          unit.fitness.Push(DUPLICATE_MUTANT);
+          continue;
+        }
+        mod_genome.Insert(unit_id, Instruction(inst_num));
+        mod_seq = mod_genome;
+        testUnitGenome(ctx, testcpu, unit, mg);
+        mod_genome.Remove(unit_id);
+      }
+      break;
+    }
+      
+    case UNIT_CHART:
+    {
+      // Each unit fills its own row of the chart
+      const int cur_inst = base_seq[unit_id].GetOp();
+      for (int inst_num = 0; inst_num < inst_size; inst_num++) {
+        if (cur_inst == inst_num) {
+          fitness_chart(unit_id, inst_num) = base_fitness;
+          continue;
+        }
+        mod_seq[unit_id].SetOp(inst_num);
+        fitness_chart(unit_id, inst_num) = testUnitGenome(ctx, testcpu, unit, mg, unit_id);
+      }
+      break;
+    }
+      
+    case UNIT_PAIRS:
+    {
+      const int line1_num = unit_id;
+      for (int line2_num = line1_num + 1; line2_num < genome_size; line2_num++) {
+        for (int inst1_num = 0; inst1_num < inst_size; inst1_num++) {
+          if (inst1_num == base_seq[line1_num].GetOp()) continue;
+          mod_seq[line1_num].SetOp(inst1_num);
+          for (int inst2_num = 0; inst2_num < inst_size; inst2_num++) {
+            if (inst2_num == base_seq[line2_num].GetOp()) continue;
+            mod_seq[line2_num].SetOp(inst2_num);
+            testUnitGenome(ctx, testcpu, unit, mg);
+          }
+          mod_seq[line2_num] = base_seq[line2_num];
+        }
+        mod_seq[line1_num] = base_seq[line1_num];
+      }
+      break;
+    }
+  }
+}
+
+void cLandscape::mergeUnits()
+{
+  ConstInstructionSequencePtr base_seq_p;
+  GeneticRepresentationPtr rep_p = base_genome.Representation();
+  base_seq_p.DynamicCastFrom(rep_p);
+  const InstructionSequence& base_seq = *base_seq_p;
+  const int genome_size = base_seq.GetSize();
+  const int inst_size = m_world->GetHardwareManager().GetInstSet(base_genome.Properties().Get("instset").StringValue()).GetSize();
+  
+  // Units are merged in site order, accumulating every mutant in the same order as a single loop over them would
+  for (int unit_id = 0; unit_id < m_units.GetSize(); unit_id++) {
+    sUnit& unit = *m_units[unit_id];
+    Apto::Array<double>& fitness = unit.fitness;
+    
+    // Duplicates share the fitness of the same mutant in the previous unit, which has already been resolved
+    for (int i = 0; i < fitness.GetSize(); i++) {
+      if (fitness[i] == DUPLICATE_MUTANT) fitness[i] = m_units[unit_id - 1]->fitness[i];
+    }
+    
+    switch (m_unit_mode) {
+      case UNIT_POINT:
+        for (int i = 0; i < fitness.GetSize(); i++) {
+          addFitness(fitness[i]);
+          if (fitness[i] >= neut_min) site_count[unit.site[i]]++;
+        }
+        break;
+        
+      case UNIT_DELETE:
+      case UNIT_INSERT:
+        for (int i = 0; i < fitness.GetSize(); i++) {
+          addFitness(fitness[i]);
+          if (fitness[i] >= neut_min) site_count[unit_id]++;
+        }
+        break;
+        
+      case UNIT_CHART:
+        for (int i = 0; i < fitness.GetSize(); i++) addFitness(fitness[i]);
+        break;
+        
+      case UNIT_PAIRS:
+      {
+        const int line1_num = unit_id;
+        int i = 0;
+        for (int line2_num = line1_num + 1; line2_num < genome_size; line2_num++) {
+          for (int inst1_num = 0; inst1_num < inst_size; inst1_num++) {
+            if (inst1_num == base_seq[line1_num].GetOp()) continue;
+            const double mut1_fitness = fitness_chart(line1_num, inst1_num) / base_fitness;
+            for (int inst2_num = 0; inst2_num < inst_size; inst2_num++) {
+              if (inst2_num == base_seq[line2_num].GetOp()) continue;
+              addEpistasis(fitness[i++] / base_fitness, mut1_fitness, fitness_chart(line2_num, inst2_num) / base_fitness);
+            }
+          }
+        }
+        break;
+      }
+    }
+    
+    // The first occurrence of the highest fitness remains the peak, just as when testing serially
+    if (m_unit_mode != UNIT_PAIRS && unit.peak_fitness > peak_fitness) {
+      peak_fitness = unit.peak_fitness;
+      peak_genome = unit.peak_genome;
+    }
+  }
+  
+  clearUnits();
+}
+
+
+void cLandscape::processQueued(cAvidaContext& ctx, eUnitMode mode)
+{
+  {
+    cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
+    ProcessBase(ctx, testcpu.Get());
+  }
+  
+  // Pair tests need the complete fitness chart first
+  if (mode == UNIT_PAIRS) {
+    if (base_fitness == 0.0) return;
+    runQueuedUnits(ctx, UNIT_CHART);
+  }
+  
+  runQueuedUnits(ctx, mode);
+  
+  if (mode == UNIT_POINT) completeProcess();
+}
+
+void cLandscape::runQueuedUnits(cAvidaContext& ctx, eUnitMode mode)
+{
+  setupUnits(mode);
+  ParallelFor(m_world->GetAnalyze().GetJobQueue(), ctx, this, &cLandscape::processQueuedUnit, 0, m_units.GetSize());
+  mergeUnits();
+}
+
+void cLandscape::processQueuedUnit(cAvidaContext& ctx, int unit_id)
+{
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx);
+  processUnit(ctx, testcpu.Get(), unit_id);
 }
 
 
@@ -23,11 +23,13 @@
 #ifndef cLandscape_h
 #define cLandscape_h
 
+#include "apto/core.h"
 #include "avida/core/Genome.h"
 #include "avida/core/InstructionSequence.h"
 #include "avida/output/Types.h"
 
 #include "cCPUTestInfo.h"
+#include "cTestCPUCheckpoints.h"
 #include "tMatrix.h"
 
 class cAvidaContext;
@@ -88,6 +90,26 @@ private:
   tMatrix<double> fitness_chart; // Chart of all one-step mutations.
   
   int m_num_found;
+  
+  // Exhaustive landscapes are partitioned into units of work, one per site (the first mutated site for pair and
+  // multi-step landscapes).  Each unit is tested with its own test CPU and test info, and records the fitness of its
+  // mutants in the order the serial loops visit them.  Merging the units in site order therefore yields the same
+  // statistics no matter how many threads processed them.
+  enum eUnitMode { UNIT_POINT, UNIT_DELETE, UNIT_INSERT, UNIT_CHART, UNIT_PAIRS };
+  struct sUnit
+  {
+    cCPUTestInfo test_info;
+    Apto::Array<double> fitness;   // Fitness of each mutant (or DUPLICATE_MUTANT), in test order
+    Apto::Array<int> site;         // Site credited in site_count for each mutant (UNIT_POINT only)
+    double peak_fitness;
+    Genome peak_genome;
+  };
+  
+  eUnitMode m_unit_mode;
+  Apto::Array<sUnit*> m_units;
+  bool m_prune_duplicates;
+  
+  cTestCPUCheckpoints m_checkpoints;   // Checkpoints of the base genome's gestation, point mutants resume from them
 
 
   cLandscape(); // @not_implemented
@@ -103,6 +125,13 @@ public:
   void Process(cAvidaContext& ctx);
   void ProcessDelete(cAvidaContext& ctx);
   void ProcessInsert(cAvidaContext& ctx);
+  
+  // Job queue variants, which test the units of work in parallel on the analyze job queue (see ParallelFor)
+  void ProcessQueued(cAvidaContext& ctx) { processQueued(ctx, UNIT_POINT); }
+  void ProcessDeleteQueued(cAvidaContext& ctx) { processQueued(ctx, UNIT_DELETE); }
+  void ProcessInsertQueued(cAvidaContext& ctx) { processQueued(ctx, UNIT_INSERT); }
+  void TestAllPairsQueued(cAvidaContext& ctx) { processQueued(ctx, UNIT_PAIRS); }
+  
   void PredictWProcess(cAvidaContext& ctx, Avida::Output::File& df, int update = -1);
   void PredictNuProcess(cAvidaContext& ctx, Avida::Output::File& df, int update = -1);
   void ProcessDump(cAvidaContext& ctx, Avida::Output::File& df);
@@ -170,10 +199,26 @@ private:
   void BuildFitnessChart(cAvidaContext& ctx, cTestCPU* testcpu);
   double ProcessGenome(cAvidaContext& ctx, cTestCPU* testcpu, Genome& in_genome);
   void ProcessBase(cAvidaContext& ctx, cTestCPU* testcpu);
-  void Process_Body(cAvidaContext& ctx, cTestCPU* testcpu, Genome& cur_genome, int cur_distance, int start_line);
+  void Process_Body(cAvidaContext& ctx, cTestCPU* testcpu, sUnit& unit, Genome& cur_genome, int cur_distance,
+                    int start_line, int end_line);
   
   double TestMutPair(cAvidaContext& ctx, cTestCPU* testcpu, Genome& mod_genome, int line1, int line2,
                      const Instruction& mut1, const Instruction& mut2);  
+  
+  void addFitness(double test_fitness);
+  void addEpistasis(double combo_fitness, double mut1_fitness, double mut2_fitness);
+  void completeProcess();
+  
+  void setupUnits(eUnitMode mode);
+  void clearUnits();
+  void runUnits(cAvidaContext& ctx, cTestCPU* testcpu);
+  double testUnitGenome(cAvidaContext& ctx, cTestCPU* testcpu, sUnit& unit, Genome& genome, int point_site = -1);
+  void processUnit(cAvidaContext& ctx, cTestCPU* testcpu, int unit_id);
+  void mergeUnits();
+  
+  void processQueued(cAvidaContext& ctx, eUnitMode mode);
+  void runQueuedUnits(cAvidaContext& ctx, eUnitMode mode);
+  void processQueuedUnit(cAvidaContext& ctx, int unit_id);
 };
 
 #endif
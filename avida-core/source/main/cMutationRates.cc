@@ -25,6 +25,9 @@
 #include "cWorld.h"
 #include "cAvidaConfig.h"
 
+#include <climits>
+#include <cmath>
+
 
 void cMutationRates::Setup(cWorld* world)
 {
@@ -73,6 +76,9 @@ void cMutationRates::Setup(cWorld* world)
   meta.standard_dev = world->GetConfig().META_STD_DEV.Get();
 
   update.death_prob = world->GetConfig().DEATH_PROB.Get();  
+
+  m_skip_sampling = (world->GetConfig().MUTATION_SAMPLING.Get() == 1);
+  resetCopySkips();
 }
 
 void cMutationRates::Clear()
@@ -122,6 +128,8 @@ void cMutationRates::Clear()
   meta.standard_dev = 0.0;
 
   update.death_prob = 0.0;
+
+  resetCopySkips();
 }
 
 void cMutationRates::Copy(const cMutationRates& in_muts)
@@ -132,4 +140,42 @@ void cMutationRates::Copy(const cMutationRates& in_muts)
   inject = in_muts.inject;
   meta = in_muts.meta;
   update = in_muts.update;
+
+  // Pending gaps belong to the source's own sequence of tests and are not inherited
+  m_skip_sampling = in_muts.m_skip_sampling;
+  resetCopySkips();
+}
+
+
+// Called when the current gap is used up (or was drawn for a different rate).  Returns whether this test is a hit,
+// drawing the gap to the next one as needed.  The number of tests up to and including the next hit is geometric,
+// P(gap = k) = (1 - p)^(k - 1) p, so hits occur at exactly the same rate as testing each copy with P(p).
+bool cMutationRates::testCopySkip(cAvidaContext& ctx, double prob, sCopySkip& skip) const
+{
+  if (skip.prob == prob) {
+    // Last test of the current gap
+    skip.prob = 0.0;
+    if (!skip.capped) return true;
+  }
+  
+  if (prob >= 1.0) return true;
+  
+  const double gap = floor(log(1.0 - ctx.GetRandom().GetDouble()) / log(1.0 - prob)) + 1.0;
+  if (gap <= 1.0) return true;   // hit on this very test, the next gap is drawn lazily
+  
+  // This test counts as the first of the gap
+  skip.prob = prob;
+  skip.capped = (gap > INT_MAX);
+  skip.gap = ((skip.capped) ? INT_MAX : (int)gap) - 1;
+  return false;
+}
+
+void cMutationRates::resetCopySkips()
+{
+  sCopySkip* skips[] = { &m_mut_skip, &m_ins_skip, &m_del_skip, &m_uniform_skip, &m_slip_skip };
+  for (int i = 0; i < 5; i++) {
+    skips[i]->prob = 0.0;
+    skips[i]->gap = 0;
+    skips[i]->capped = false;
+  }
 }
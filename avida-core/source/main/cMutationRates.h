@@ -42,6 +42,20 @@ private:
   };
   sCopyMuts copy;
 
+  // Geometric skip state for a single per-copy test (MUTATION_SAMPLING 1).  'gap' counts the tests left up to and
+  // including the next hit, drawn for rate 'prob'; a rate change simply redraws, since the gap is memoryless.
+  struct sCopySkip {
+    double prob;
+    int gap;
+    bool capped;              // gap was clipped to INT_MAX, so the last test is not a hit
+  };
+  bool m_skip_sampling;
+  mutable sCopySkip m_mut_skip;
+  mutable sCopySkip m_ins_skip;
+  mutable sCopySkip m_del_skip;
+  mutable sCopySkip m_uniform_skip;
+  mutable sCopySkip m_slip_skip;
+
   // ...at the divide...
   struct sDivideMuts {
     double ins_prob;                  // Per site
@@ -99,8 +113,8 @@ private:
   sUpdateMuts update;
 
 public:
-  cMutationRates() { Clear(); }
-  cMutationRates(const cMutationRates& in_muts) { Copy(in_muts); }
+  cMutationRates() : m_skip_sampling(false) { Clear(); }
+  cMutationRates(const cMutationRates& in_muts) : m_skip_sampling(false) { Copy(in_muts); }
   cMutationRates& operator=(const cMutationRates& in_muts) { Copy(in_muts); return *this; }
   ~cMutationRates() { ; }
 
@@ -109,14 +123,11 @@ public:
   void Copy(const cMutationRates& in_muts);
 
   // Copy muts should always check if they are 0.0 before consulting the random number generator for performance
-  bool TestCopyMut(cAvidaContext& ctx) const { return (copy.mut_prob == 0.0) ? false : ctx.GetRandom().P(copy.mut_prob); }
-  bool TestCopyIns(cAvidaContext& ctx) const { return (copy.ins_prob == 0.0) ? false : ctx.GetRandom().P(copy.ins_prob); }
-  bool TestCopyDel(cAvidaContext& ctx) const { return (copy.del_prob == 0.0) ? false : ctx.GetRandom().P(copy.del_prob); }
-  bool TestCopySlip(cAvidaContext& ctx) const { return (copy.slip_prob == 0.0) ? false : ctx.GetRandom().P(copy.slip_prob); }
-  bool TestCopyUniform(cAvidaContext& ctx) const
-  {
-    return (copy.uniform_prob == 0.0) ? false : ctx.GetRandom().P(copy.uniform_prob);
-  }
+  bool TestCopyMut(cAvidaContext& ctx) const { return testCopy(ctx, copy.mut_prob, m_mut_skip); }
+  bool TestCopyIns(cAvidaContext& ctx) const { return testCopy(ctx, copy.ins_prob, m_ins_skip); }
+  bool TestCopyDel(cAvidaContext& ctx) const { return testCopy(ctx, copy.del_prob, m_del_skip); }
+  bool TestCopySlip(cAvidaContext& ctx) const { return testCopy(ctx, copy.slip_prob, m_slip_skip); }
+  bool TestCopyUniform(cAvidaContext& ctx) const { return testCopy(ctx, copy.uniform_prob, m_uniform_skip); }
   
   bool TestDivideMut(cAvidaContext& ctx) const { return ctx.GetRandom().P(divide.divide_mut_prob); }
   bool TestDivideIns(cAvidaContext& ctx) const { return ctx.GetRandom().P(divide.divide_ins_prob); }
@@ -239,6 +250,28 @@ public:
   void SetMetaStandardDev(double in_dev)    { meta.standard_dev     = in_dev; }
 
   void SetDeathProb(double in_prob)         { update.death_prob      = in_prob; }
+
+  bool UsesSkipSampling() const { return m_skip_sampling; }
+  void SetSkipSampling(bool skip) { m_skip_sampling = skip; resetCopySkips(); }
+
+private:
+  inline bool testCopy(cAvidaContext& ctx, double prob, sCopySkip& skip) const;
+  bool testCopySkip(cAvidaContext& ctx, double prob, sCopySkip& skip) const;
+  void resetCopySkips();
 };
 
+
+inline bool cMutationRates::testCopy(cAvidaContext& ctx, double prob, sCopySkip& skip) const
+{
+  if (prob == 0.0) return false;
+  if (!m_skip_sampling) return ctx.GetRandom().P(prob);
+  
+  // Fast path: still counting down towards the next hit at the current rate
+  if (skip.prob == prob && skip.gap > 1) {
+    skip.gap--;
+    return false;
+  }
+  return testCopySkip(ctx, prob, skip);
+}
+
 #endif
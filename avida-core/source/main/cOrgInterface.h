@@ -45,6 +45,7 @@ class cOrgMessage;
 class cOrgSinkMessage;
 class cPopulationCell;
 class cResourceCount;
+class cResourceView;
 class cString;
 
 using namespace Avida;
@@ -118,6 +119,7 @@ public:
   virtual double GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id) = 0;
   virtual const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) = 0;
   virtual const Apto::Array< Apto::Array<int> >& GetCellIdLists() = 0; 
+  virtual cResourceView GetResourceView(cAvidaContext& ctx) = 0;
 
   virtual int GetCurrPeakX(cAvidaContext& ctx, int res_id) = 0;
   virtual int GetCurrPeakY(cAvidaContext& ctx, int res_id) = 0;
@@ -249,6 +251,7 @@ public:
   virtual Apto::Array<cOrganism*> GetCellAVs(int av_cell_id, int av_num=0) =0;
   virtual Apto::Array<cOrganism*> GetFacedPreyAVs(int av_num = 0) = 0;
   virtual const Apto::Array<double>& GetAVResources(cAvidaContext& ctx, int av_num = 0) = 0;
+  virtual cResourceView GetAVResourceView(cAvidaContext& ctx, int av_num = 0) = 0;
   virtual double GetAVResourceVal(cAvidaContext& ctx, int res_id, int av_num = 0) = 0;
   virtual const Apto::Array<double>& GetAVFacedResources(cAvidaContext& ctx, int av_num = 0) = 0;
   virtual double GetAVFacedResourceVal(cAvidaContext& ctx, int res_id, int av_num = 0) = 0;
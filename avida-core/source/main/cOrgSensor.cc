@@ -40,6 +40,7 @@ void cOrgSensor::ResetOrgSensor()
   m_return_rel_facing = false;
   m_has_seen_display = false;
   m_soloBounds.Resize(m_world->GetEnvironment().GetResourceLib().GetSize());
+  m_look_cache.valid = false;
 }
 
 const cOrgSensor::sLookOut cOrgSensor::SetLooking(cAvidaContext& ctx, sLookInit& in_defs, int facing, int cell_id, bool use_ft)
@@ -404,6 +405,19 @@ cOrgSensor::sLookOut cOrgSensor::PreWalk(cAvidaContext& ctx, sLookInit& in_defs,
   bool single_bound = ((in_defs.habitat == 0 || in_defs.habitat >= 4) && in_defs.id_sought != -1 && m_res_lib.GetResource(in_defs.id_sought)->GetGradient());
   if (in_defs.habitat != -2 && in_defs.habitat != 3) val_res = BuildResArray(in_defs, single_bound);
   
+  // nothing the last walk could have seen has changed, so it would see the same again
+  cResourceCount* res_count = m_organism->GetOrgInterface().GetResourceCount();
+  const bool cache_look = canCacheLook(in_defs, val_res, res_count);
+  if (cache_look && findCachedLook(ctx, in_defs, facing, cell_id, faced_cell_int, res_count)) {
+    stuff_seen = m_look_cache.result;
+    if (m_look_cache.set_display) SetPotentialDisplayData(stuff_seen);
+    return stuff_seen;
+  }
+  // the walk drops the resources that are out of range, keep the whole list for the cache
+  Apto::Array<int, Apto::Smart> look_res;
+  if (cache_look) look_res = val_res;
+  m_look_cache.set_display = false;
+  
   sBounds worldBounds;
   worldBounds.min_x = 0;
   worldBounds.min_y = 0;
@@ -429,9 +443,101 @@ cOrgSensor::sLookOut cOrgSensor::PreWalk(cAvidaContext& ctx, sLookInit& in_defs,
     if (m_world->GetConfig().WORLD_GEOMETRY.Get() == 2) WalkTorus(ctx, in_defs, facing, cell_id, limits, stuff_seen, center_cell, tot_bounds, worldBounds, val_res, this_cell, ahead_dir, worldx);
     else WalkCells(ctx, in_defs, facing, cell_id, limits, stuff_seen, center_cell, tot_bounds, worldBounds, val_res, this_cell, ahead_dir, worldx);
   }
+  if (cache_look) cacheLook(in_defs, facing, cell_id, faced_cell_int, res_count, look_res, stuff_seen);
   return stuff_seen;
 }
 
+bool cOrgSensor::canCacheLook(const sLookInit& in_defs, const Apto::Array<int, Apto::Smart>& val_res,
+                              cResourceCount* res_count)
+{
+  // organisms move every update, and simulated predators are only detected by chance
+  if (in_defs.habitat == -2 || in_defs.habitat == 3 || in_defs.habitat == 5) return false;
+  if (res_count == NULL || val_res.GetSize() == 0) return false;
+  
+  // only gradient resources report which of their cells changed
+  for (int i = 0; i < val_res.GetSize(); i++) {
+    cResource* res = m_res_lib.GetResource(val_res[i]);
+    if (!res->GetGradient() || res->GetGeometry() == nGeometry::GLOBAL || res->GetGeometry() == nGeometry::PARTIAL) return false;
+    if (!res_count->TracksChanges(val_res[i])) return false;
+  }
+  return true;
+}
+
+bool cOrgSensor::findCachedLook(cAvidaContext& ctx, const sLookInit& in_defs, const int facing, const int cell_id,
+                                const int faced_cell, cResourceCount* res_count)
+{
+  if (!m_look_cache.valid || m_look_cache.res_count != res_count) return false;
+  
+  int search_cell = m_organism->GetOrgInterface().GetCellID();
+  if (m_use_avatar) search_cell = m_organism->GetOrgInterface().GetAVCellID();
+  if (m_look_cache.cell_id != cell_id || m_look_cache.facing != facing || m_look_cache.faced_cell != faced_cell ||
+      m_look_cache.org_cell != m_organism->GetCellID() || m_look_cache.search_cell != search_cell) return false;
+  
+  const sLookInit& defs = m_look_cache.defs;
+  if (defs.habitat != in_defs.habitat || defs.distance != in_defs.distance || defs.search_type != in_defs.search_type ||
+      defs.id_sought != in_defs.id_sought) return false;
+  
+  // the walk only reads cells within the sight distance (wrapping around on a torus) and the bounds of each resource
+  const int worldx = m_world->GetConfig().WORLD_X.Get();
+  const int worldy = m_world->GetConfig().WORLD_Y.Get();
+  cSpatialResCount::sCellBox sight;
+  sight.min_x = 0;
+  sight.min_y = 0;
+  sight.max_x = worldx - 1;
+  sight.max_y = worldy - 1;
+  if (m_world->GetConfig().WORLD_GEOMETRY.Get() != 2) {
+    sight.min_x = max(cell_id % worldx - in_defs.distance, 0);
+    sight.min_y = max(cell_id / worldx - in_defs.distance, 0);
+    sight.max_x = min(cell_id % worldx + in_defs.distance, worldx - 1);
+    sight.max_y = min(cell_id / worldx + in_defs.distance, worldy - 1);
+  }
+  
+  for (int i = 0; i < m_look_cache.res_ids.GetSize(); i++) {
+    const int res_id = m_look_cache.res_ids[i];
+    const sBounds bounds = GetBounds(ctx, res_id);
+    const sBounds& cached_bounds = m_look_cache.res_bounds[i];
+    if (bounds.min_x != cached_bounds.min_x || bounds.min_y != cached_bounds.min_y ||
+        bounds.max_x != cached_bounds.max_x || bounds.max_y != cached_bounds.max_y) return false;
+    
+    cSpatialResCount::sCellBox changed;
+    if (!res_count->GetChangedSince(res_id, m_look_cache.res_stamps[i], changed)) return false;
+    
+    cSpatialResCount::sCellBox seen;
+    seen.min_x = max(bounds.min_x, sight.min_x);
+    seen.min_y = max(bounds.min_y, sight.min_y);
+    seen.max_x = min(bounds.max_x, sight.max_x);
+    seen.max_y = min(bounds.max_y, sight.max_y);
+    if (seen.min_x > seen.max_x || seen.min_y > seen.max_y) continue;
+    if (cSpatialResCount::BoxesOverlap(changed, seen)) return false;
+  }
+  return true;
+}
+
+void cOrgSensor::cacheLook(const sLookInit& in_defs, const int facing, const int cell_id, const int faced_cell,
+                           cResourceCount* res_count, const Apto::Array<int, Apto::Smart>& val_res, const sLookOut& result)
+{
+  m_look_cache.valid = true;
+  m_look_cache.res_count = res_count;
+  m_look_cache.cell_id = cell_id;
+  m_look_cache.org_cell = m_organism->GetCellID();
+  m_look_cache.search_cell = m_organism->GetOrgInterface().GetCellID();
+  if (m_use_avatar) m_look_cache.search_cell = m_organism->GetOrgInterface().GetAVCellID();
+  m_look_cache.faced_cell = faced_cell;
+  m_look_cache.facing = facing;
+  m_look_cache.defs = in_defs;
+  m_look_cache.result = result;
+  
+  // the walk has just taken the bounds of every resource in the list
+  m_look_cache.res_ids.Resize(val_res.GetSize());
+  m_look_cache.res_bounds.Resize(val_res.GetSize());
+  m_look_cache.res_stamps.Resize(val_res.GetSize());
+  for (int i = 0; i < val_res.GetSize(); i++) {
+    m_look_cache.res_ids[i] = val_res[i];
+    m_look_cache.res_bounds[i] = m_soloBounds[val_res[i]];
+    m_look_cache.res_stamps[i] = res_count->GetChangeStamp(val_res[i]);
+  }
+}
+
 void cOrgSensor::WalkCells(cAvidaContext& ctx, sLookInit& in_defs, const int facing, const int cell, sWalkLimits& limits, sLookOut& stuff_seen, Apto::Coord<int>& center_cell, sBounds& tot_bounds, sBounds& worldBounds, const Apto::Array<int, Apto::Smart>& val_res, Apto::Coord<int>& this_cell, const Apto::Coord<int>& ahead_dir, const int& worldx)
 {
   
@@ -1243,6 +1349,7 @@ void cOrgSensor::SetPotentialDisplayData(sLookOut& stuff_seen)
   SetReturnRelativeFacing(false);
   
   m_organism->SetPotentialDisplay(display_data);
+  m_look_cache.set_display = true;
 }
 
 void cOrgSensor::SetLastSeenDisplay(sOrgDisplay* seen_display)
@@ -26,8 +26,11 @@
 
 #include "cOrganism.h"
 #include "cResourceLib.h"
+#include "cSpatialResCount.h"
 #include "cWorld.h"
 
+class cResourceCount;
+
 struct sOrgDisplay 
 {
   int distance;
@@ -159,6 +162,32 @@ class cOrgSensor
   
   void TestConfusion(cAvidaContext& ctx, sLookOut& stuff_Seen, cOrganism* first_org);
   void TestDetection(cAvidaContext& ctx, sLookOut& stuff_Seen, cOrganism* first_org);
+  
+  private:
+  // The last walk over gradient resources.  Its result stands until one of those resources changes a cell the walk
+  // could have read, which the resources report as boxes of changed cells (see cSpatialResCount).
+  struct sLookCache {
+    bool valid;
+    bool set_display;     // the walk passed its result to SetPotentialDisplayData
+    cResourceCount* res_count;
+    int cell_id;
+    int org_cell;
+    int search_cell;
+    int faced_cell;
+    int facing;
+    sLookInit defs;
+    sLookOut result;
+    Apto::Array<int> res_ids;
+    Apto::Array<sBounds> res_bounds;
+    Apto::Array<cSpatialResCount::sChangeStamp> res_stamps;
+  };
+  sLookCache m_look_cache;
+  
+  bool canCacheLook(const sLookInit& in_defs, const Apto::Array<int, Apto::Smart>& val_res, cResourceCount* res_count);
+  bool findCachedLook(cAvidaContext& ctx, const sLookInit& in_defs, const int facing, const int cell_id,
+                      const int faced_cell, cResourceCount* res_count);
+  void cacheLook(const sLookInit& in_defs, const int facing, const int cell_id, const int faced_cell,
+                 cResourceCount* res_count, const Apto::Array<int, Apto::Smart>& val_res, const sLookOut& result);
 };
 
 inline bool cOrgSensor::TestBounds(const Apto::Coord<int>& cell_id, sBounds& bounds)
@@ -34,6 +34,7 @@
 #include "cInstSet.h"
 #include "cOrgSensor.h"
 #include "cPopulationCell.h"
+#include "cResourceView.h"
 #include "cStateGrid.h"
 #include "cStringUtil.h"
 #include "cTaskContext.h"
@@ -154,6 +155,7 @@ cOrganism::cOrganism(cWorld* world, cAvidaContext& ctx, const Genome& genome, in
   , m_lineage_label(-1)
   , m_lineage(NULL)
   , m_org_list_index(-1)
+  , m_inst_set_id(-1)
   , m_org_display(NULL)
   , m_queued_display_data(NULL)
   , m_display(false)
@@ -218,6 +220,7 @@ void cOrganism::initialize(cAvidaContext& ctx)
 {
   m_phenotype.SetInstSetSize(m_hardware->GetInstSet().GetSize());
   const_cast<Genome&>(m_initial_genome).Properties().SetValue(s_ext_prop_name_instset,(const char*)m_hardware->GetInstSet().GetInstSetName());
+  m_inst_set_id = m_world->GetHardwareManager().GetInstSetID((const char*)m_hardware->GetInstSet().GetInstSetName());
   m_phenotype.SetGroupAttackInstSetSize(m_world->GetStats().GetGroupAttackInsts(m_hardware->GetInstSet().GetInstSetName()).GetSize());
   
   if (m_world->GetConfig().DEATH_METHOD.Get() > DEATH_METHOD_OFF) {
@@ -248,7 +251,7 @@ void cOrganism::initialize(cAvidaContext& ctx)
 cOrganism::~cOrganism()
 {  
   assert(m_is_running == false);
-  delete m_hardware;
+  m_world->GetHardwareManager().Release(m_hardware);
   delete m_interface;
   
   if(m_msg) delete m_msg;
@@ -411,10 +414,8 @@ void cOrganism::doOutput(cAvidaContext& ctx,
                          bool is_parasite, 
                          cContextPhenotype* context_phenotype)
 {  
-  const int deme_id = m_interface->GetDemeID();
-  const Apto::Array<double> & global_resource_count = m_interface->GetResources(ctx);
-  const Apto::Array<double> & deme_resource_count = m_interface->GetDemeResources(deme_id, ctx);
-  const Apto::Array< Apto::Array<int> > & cell_id_lists = m_interface->GetCellIdLists();
+  // global and deme resources, with any resources this cell cannot access reading as zero
+  const cResourceView resource_view = m_interface->GetResourceView(ctx);
   
   tList<tBuffer<int> > other_input_list;
   tList<tBuffer<int> > other_output_list;
@@ -446,9 +447,9 @@ void cOrganism::doOutput(cAvidaContext& ctx,
   // Do the testing of tasks performed...
   
   
-  Apto::Array<double> global_res_change(global_resource_count.GetSize());
+  Apto::Array<double> global_res_change(resource_view.GetNumCellResources());
   global_res_change.SetAll(0.0);
-  Apto::Array<double> deme_res_change(deme_resource_count.GetSize());
+  Apto::Array<double> deme_res_change(resource_view.GetNumAppendedResources());
   deme_res_change.SetAll(0.0);
   Apto::Array<cString> insts_triggered;
   
@@ -458,31 +459,10 @@ void cOrganism::doOutput(cAvidaContext& ctx,
   cTaskContext taskctx(this, input_buffer, output_buffer, other_input_list, other_output_list,
                        m_hardware->GetExtendedMemory(), on_divide, received_messages_point);
   
-  //combine global and deme resource counts
-  Apto::Array<double> globalAndDeme_resource_count = global_resource_count + deme_resource_count;
+  //combine global and deme resource changes
   Apto::Array<double> globalAndDeme_res_change = global_res_change + deme_res_change;
   
-  // set any resource amount to 0 if a cell cannot access this resource
-  int cell_id=GetCellID();
-  if (cell_id_lists.GetSize())
-  {
-    for (int i=0; i<cell_id_lists.GetSize(); i++)
-    {
-      // if cell_id_lists have been set then we have to check if this cell is in the list
-      if (cell_id_lists[i].GetSize()) {
-        int j;
-        for (j=0; j<cell_id_lists[i].GetSize(); j++)
-        {
-          if (cell_id==cell_id_lists[i][j])
-            break;
-        }
-        if (j==cell_id_lists[i].GetSize())
-          globalAndDeme_resource_count[i]=0;
-      }
-    }
-  }
-  
-  bool task_completed = m_phenotype.TestOutput(ctx, taskctx, globalAndDeme_resource_count, 
+  bool task_completed = m_phenotype.TestOutput(ctx, taskctx, resource_view, 
                                                m_phenotype.GetCurRBinsAvail(), globalAndDeme_res_change, 
                                                insts_triggered, is_parasite, context_phenotype);
   
@@ -530,8 +510,6 @@ void cOrganism::doAVOutput(cAvidaContext& ctx,
   //Avatar output has to be seperate from doOutput to ensure avatars, not the true orgs, are triggering reactions
   //  const int deme_id = m_interface->GetDemeID();
   //  const tArray<double> & deme_resource_count = m_interface->GetDemeResources(deme_id, ctx); //todo: DemeAVResources
-  const Apto::Array< Apto::Array<int> > & cell_id_lists = m_interface->GetCellIdLists();
-  
   tList<tBuffer<int> > other_input_list;
   tList<tBuffer<int> > other_output_list;
   
@@ -576,32 +554,11 @@ void cOrganism::doAVOutput(cAvidaContext& ctx,
   cTaskContext taskctx(this, input_buffer, output_buffer, other_input_list, other_output_list,
                        m_hardware->GetExtendedMemory(), on_divide, received_messages_point);
   
-  //combine global and deme resource counts
-  const Apto::Array<double>& av_res_count = m_interface->GetAVResources(ctx);
-  Apto::Array<double> avatarAndDeme_res_count = av_res_count; // + deme_resource_count;
+  // avatar resources, with any resources the avatar's cell cannot access reading as zero
+  const cResourceView av_resource_view = m_interface->GetAVResourceView(ctx);
   Apto::Array<double> avatarAndDeme_res_change = avatar_res_change; // + deme_res_change;
   
-  // set any resource amount to 0 if a cell cannot access this resource
-  int cell_id = m_interface->GetAVCellID();
-  if (cell_id_lists.GetSize())
-  {
-	  for (int i = 0; i < cell_id_lists.GetSize(); i++)
-	  {
-		  // if cell_id_lists have been set then we have to check if this cell is in the list
-		  if (cell_id_lists[i].GetSize()) {
-			  int j = 0;
-			  for (j = 0; j < cell_id_lists[i].GetSize(); j++)
-			  {
-				  if (cell_id == cell_id_lists[i][j])
-					  break;
-			  }
-			  if (j == cell_id_lists[i].GetSize())
-				  avatarAndDeme_res_count[i] = 0;
-		  }
-	  }
-  }
-  
-  bool task_completed = m_phenotype.TestOutput(ctx, taskctx, avatarAndDeme_res_count, 
+  bool task_completed = m_phenotype.TestOutput(ctx, taskctx, av_resource_view, 
                                                m_phenotype.GetCurRBinsAvail(), avatarAndDeme_res_change, 
                                                insts_triggered, is_parasite, context_phenotype);
   
@@ -76,6 +76,7 @@ private:
   int cclade_id;				                  // @MRR Coalescence clade information (set in cPopulation)
 
   int m_org_list_index;
+  int m_inst_set_id;                      // index of this organism's instruction set in the hardware manager
   
   sOrgDisplay* m_org_display;
   sOrgDisplay* m_queued_display_data;
@@ -159,6 +160,7 @@ public:
 
   void SetLineageLabel(int in_label) { m_lineage_label = in_label; }
   int GetLineageLabel() const { return m_lineage_label; }  
+  int GetInstSetID() const { return m_inst_set_id; }
   void SetLineage(cLineage* in_lineage) { m_lineage = in_lineage; }
   cLineage* GetLineage() const { return m_lineage; }
 
@@ -0,0 +1,225 @@
+/*
+ *  cParallelUpdate.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cParallelUpdate.h"
+
+#include "apto/platform.h"
+
+#include "cAvidaContext.h"
+#include "cHardwareBase.h"
+#include "cPopulation.h"
+#include "cPopulationCell.h"
+#include "cStats.h"
+#include "cWorld.h"
+
+
+class cParallelUpdate::cWorker : public Apto::Thread
+{
+private:
+  cParallelUpdate* m_pu;
+  int m_id;
+
+  void Run();
+
+public:
+  cWorker(cParallelUpdate* pu, int worker_id) : m_pu(pu), m_id(worker_id) { ; }
+};
+
+
+cParallelUpdate::cParallelUpdate(cWorld* world, int num_threads)
+  : m_world(world), m_pop(world->GetPopulation()), m_window(world->GetConfig().PARALLEL_SPECULATIVE_WINDOW.Get())
+  , m_pass(0), m_pending(0), m_terminate(false)
+{
+  if (num_threads < 0) num_threads = Apto::Platform::AvailableCPUs();
+  if (num_threads < 1) num_threads = 1;
+
+  buildTiles(world->GetConfig().PARALLEL_TILE_SIZE.Get());
+
+  m_ranges.Resize(num_threads);
+  for (int i = 0; i < num_threads; i++) m_ranges[i] = new sRange;
+
+  // The calling thread acts as worker 0, additional threads are only needed beyond that
+  m_workers.Resize(num_threads - 1);
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i] = new cWorker(this, i + 1);
+    m_workers[i]->Start();
+  }
+}
+
+cParallelUpdate::~cParallelUpdate()
+{
+  m_mutex.Lock();
+  m_terminate = true;
+  m_mutex.Unlock();
+  m_cond.Broadcast();
+
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+  for (int i = 0; i < m_ranges.GetSize(); i++) delete m_ranges[i];
+  for (int i = 0; i < m_tiles.GetSize(); i++) delete m_tiles[i];
+}
+
+
+void cParallelUpdate::buildTiles(int tile_size)
+{
+  if (tile_size < 1) tile_size = 1;
+
+  const int tiles_x = (m_pop.GetWorldX() + tile_size - 1) / tile_size;
+  const int tiles_y = (m_pop.GetWorldY() + tile_size - 1) / tile_size;
+
+  Apto::Array<sTile*> grid(tiles_x * tiles_y);
+  grid.SetAll(NULL);
+
+  // Cells are assigned in cell id order, so the processing order within a tile is fixed
+  for (int i = 0; i < m_pop.GetSize(); i++) {
+    int x, y;
+    m_pop.GetCell(i).GetPosition(x, y);
+    int tile_id = (y / tile_size) * tiles_x + (x / tile_size);
+    if (tile_id < 0 || tile_id >= grid.GetSize()) tile_id = 0;
+
+    if (grid[tile_id] == NULL) {
+      grid[tile_id] = new sTile;
+      grid[tile_id]->spec_total = 0;
+      grid[tile_id]->spec_num = 0;
+    }
+    grid[tile_id]->cells.Push(i);
+  }
+
+  for (int i = 0; i < grid.GetSize(); i++) if (grid[i]) m_tiles.Push(grid[i]);
+}
+
+
+void cParallelUpdate::Process(cAvidaContext& ctx)
+{
+  const int num_tiles = m_tiles.GetSize();
+  const int num_workers = m_ranges.GetSize();
+
+  // Seed every tile from the master RNG, in tile order, before any work is distributed
+  for (int i = 0; i < num_tiles; i++) {
+    m_tiles[i]->rng.ResetSeed(ctx.GetRandom().GetInt(ctx.GetRandom().MaxSeed()));
+    m_tiles[i]->spec_total = 0;
+    m_tiles[i]->spec_num = 0;
+  }
+
+  for (int i = 0; i < num_workers; i++) {
+    m_ranges[i]->next = (i * num_tiles) / num_workers;
+    m_ranges[i]->end = ((i + 1) * num_tiles) / num_workers;
+  }
+
+  if (m_workers.GetSize()) {
+    m_mutex.Lock();
+    m_pending = m_workers.GetSize();
+    m_pass++;
+    m_mutex.Unlock();
+    m_cond.Broadcast();
+  }
+
+  runWorker(0);
+
+  m_mutex.Lock();
+  while (m_pending > 0) m_done_cond.Wait(m_mutex);
+  m_mutex.Unlock();
+
+  // Merge the per-tile statistics in tile order
+  cStats& stats = m_world->GetStats();
+  for (int i = 0; i < num_tiles; i++) stats.AddSpeculative(m_tiles[i]->spec_total, m_tiles[i]->spec_num);
+}
+
+
+void cParallelUpdate::runWorker(int worker_id)
+{
+  sTile* tile = NULL;
+  while ((tile = nextTile(worker_id))) processTile(*tile);
+}
+
+
+cParallelUpdate::sTile* cParallelUpdate::nextTile(int worker_id)
+{
+  // Take from the front of this worker's own range first...
+  sRange& own = *m_ranges[worker_id];
+  own.mutex.Lock();
+  if (own.next < own.end) {
+    sTile* tile = m_tiles[own.next++];
+    own.mutex.Unlock();
+    return tile;
+  }
+  own.mutex.Unlock();
+
+  // ...then steal from the back of the other workers' ranges
+  const int num_workers = m_ranges.GetSize();
+  for (int i = 1; i < num_workers; i++) {
+    sRange& victim = *m_ranges[(worker_id + i) % num_workers];
+    Apto::MutexAutoLock lock(victim.mutex);
+    if (victim.next < victim.end) return m_tiles[--victim.end];
+  }
+
+  return NULL;
+}
+
+
+void cParallelUpdate::processTile(sTile& tile)
+{
+  cAvidaContext ctx(&m_world->GetDriver(), tile.rng);
+
+  for (int i = 0; i < tile.cells.GetSize(); i++) {
+    cPopulationCell& cell = m_pop.GetCell(tile.cells[i]);
+    if (!cell.IsOccupied()) continue;
+
+    cHardwareBase* hw = cell.GetHardware();
+    if (!hw->SupportsConcurrentSpeculation()) continue;
+
+    const int start_count = cell.GetSpeculativeState();
+    int spec_count = start_count;
+    while (spec_count < m_window && hw->SingleProcess(ctx, true)) spec_count++;
+
+    if (spec_count > start_count) {
+      cell.SetSpeculativeState(spec_count);
+      tile.spec_total += spec_count - start_count;
+      tile.spec_num++;
+    }
+  }
+}
+
+
+void cParallelUpdate::cWorker::Run()
+{
+  int last_pass = 0;
+
+  while (true) {
+    m_pu->m_mutex.Lock();
+    while (m_pu->m_pass == last_pass && !m_pu->m_terminate) m_pu->m_cond.Wait(m_pu->m_mutex);
+    if (m_pu->m_terminate) {
+      m_pu->m_mutex.Unlock();
+      break;
+    }
+    last_pass = m_pu->m_pass;
+    m_pu->m_mutex.Unlock();
+
+    m_pu->runWorker(m_id);
+
+    m_pu->m_mutex.Lock();
+    int pending = --m_pu->m_pending;
+    m_pu->m_mutex.Unlock();
+    if (!pending) m_pu->m_done_cond.Signal();
+  }
+}
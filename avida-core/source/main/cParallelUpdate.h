@@ -0,0 +1,104 @@
+/*
+ *  cParallelUpdate.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cParallelUpdate_h
+#define cParallelUpdate_h
+
+#include "apto/core.h"
+#include "apto/core/Thread.h"
+#include "apto/rng.h"
+
+class cAvidaContext;
+class cPopulation;
+class cWorld;
+
+
+// cParallelUpdate - Speculatively pre-executes organisms across worker threads at the start of each update
+//
+// The population is partitioned into square spatial tiles.  Each pass, every occupied cell in a tile runs ahead
+// speculatively (see cPopulation::ProcessStepSpeculative) until it reaches an instruction that must stall, or until
+// it holds PARALLEL_SPECULATIVE_WINDOW pre-executed cycles.  Speculative instructions only touch organism local state,
+// so tiles may be processed in any order.  Every instruction that can affect other cells (divide, I/O, resource
+// collection, messaging, movement) stalls and is executed later by the regular, serially scheduled pass, which serves
+// as the deterministic merge phase.
+//
+// Tiles are handed out through per-worker ranges; idle workers steal tiles from the back of other workers' ranges.
+// Each tile draws its own RNG seed from the master context before the pass, so results depend only on the random
+// seed and tile size, never on the thread count or on which worker processed which tile.
+
+class cParallelUpdate
+{
+private:
+  class cWorker;
+
+  struct sTile
+  {
+    Apto::Array<int> cells;
+    Apto::RNG::AvidaRNG rng;
+    int spec_total;
+    int spec_num;
+  };
+
+  struct sRange
+  {
+    Apto::Mutex mutex;
+    int next;
+    int end;
+  };
+
+  cWorld* m_world;
+  cPopulation& m_pop;
+  int m_window;
+
+  Apto::Array<sTile*> m_tiles;
+  Apto::Array<sRange*> m_ranges;
+  Apto::Array<cWorker*> m_workers;
+
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_cond;
+  Apto::ConditionVariable m_done_cond;
+  volatile int m_pass;      // incremented to release the workers for a new pass
+  volatile int m_pending;   // count of workers still processing the current pass
+  volatile bool m_terminate;
+
+
+  cParallelUpdate(); // @not_implemented
+  cParallelUpdate(const cParallelUpdate&); // @not_implemented
+  cParallelUpdate& operator=(const cParallelUpdate&); // @not_implemented
+
+public:
+  cParallelUpdate(cWorld* world, int num_threads);
+  ~cParallelUpdate();
+
+  int GetNumThreads() const { return m_ranges.GetSize(); }
+  int GetNumTiles() const { return m_tiles.GetSize(); }
+
+  //! Pre-execute all scheduled organisms, blocking until every tile has been processed.
+  void Process(cAvidaContext& ctx);
+
+private:
+  void buildTiles(int tile_size);
+  void runWorker(int worker_id);
+  sTile* nextTile(int worker_id);
+  void processTile(sTile& tile);
+};
+
+#endif
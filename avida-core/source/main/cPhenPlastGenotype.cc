@@ -47,7 +47,7 @@ cPhenPlastGenotype::~cPhenPlastGenotype()
 
 void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx)
 {
-  cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPUHandle test_cpu(m_world->GetHardwareManager(), ctx);
 
   if (m_num_trials > 1) test_info.UseRandomInputs(true);
   
@@ -105,8 +105,6 @@ void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaC
     m_viable_probability += (this_phen->IsViable() > 0) ? freq : 0;
     ++uit;
   }
-  
-  if (test_cpu) delete test_cpu;
 }
 
 
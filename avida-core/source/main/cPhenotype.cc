@@ -27,6 +27,7 @@
 #include "cDeme.h"
 #include "cOrganism.h"
 #include "cReactionResult.h"
+#include "cResourceView.h"
 #include "cTaskState.h"
 #include "cWorld.h"
 #include "tList.h"
@@ -36,12 +37,52 @@
 using namespace std;
 
 
+// Copy an optional state block, leaving it unallocated when the source never allocated its own
+template <class T> static void copyBlock(T*& dst, const T* src)
+{
+  if (!src) {
+    delete dst;
+    dst = NULL;
+  } else if (dst) {
+    *dst = *src;
+  } else {
+    dst = new T(*src);
+  }
+}
+
+// Return an optional state block to its unallocated, all default, state
+template <class T> static void clearBlock(T*& block)
+{
+  delete block;
+  block = NULL;
+}
+
+// Group tolerance records, only allocated once an organism makes use of group tolerance
+struct cPhenotype::sToleranceState
+{
+  tList<int> immigrants;        // record of previous updates tolerance has been decreased towards immigrants
+  tList<int> offspring_own;     // record of previous updates tolerance has been decreased towards org's own offspring
+  tList<int> offspring_others;  // record of previous updates tolerance has been decreased towards other offspring in group
+  Apto::Array<pair<int,int> > intolerances; // caches temporary values of the intolerance and the update
+
+  sToleranceState(int num_intolerances) : intolerances(num_intolerances) { intolerances.SetAll(make_pair(-1, -1)); }
+
+  void Reset()
+  {
+    immigrants.Clear();
+    offspring_own.Clear();
+    offspring_others.Clear();
+    intolerances.SetAll(make_pair(-1, -1));
+  }
+};
+
+
 cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 : m_world(world)
 , initialized(false)
-, energy_store(0.0)
 , cur_task_count(m_world->GetEnvironment().GetNumTasks())
-, cur_para_tasks(m_world->GetEnvironment().GetNumTasks())
+, cur_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
+, energy_store(0.0)
 , cur_host_tasks(m_world->GetEnvironment().GetNumTasks())
 , cur_internal_task_count(m_world->GetEnvironment().GetNumTasks())
 , eff_task_count(m_world->GetEnvironment().GetNumTasks())
@@ -50,25 +91,13 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , cur_internal_task_quality(m_world->GetEnvironment().GetNumTasks())
 , cur_rbins_total(m_world->GetEnvironment().GetResourceLib().GetSize())
 , cur_rbins_avail(m_world->GetEnvironment().GetResourceLib().GetSize())
-, cur_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
 , first_reaction_cycles(m_world->GetEnvironment().GetReactionLib().GetSize())
 , first_reaction_execs(m_world->GetEnvironment().GetReactionLib().GetSize())
 , cur_stolen_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
 , cur_reaction_add_reward(m_world->GetEnvironment().GetReactionLib().GetSize())
-, cur_sense_count(m_world->GetStats().GetSenseSize())
-, sensed_resources(m_world->GetEnvironment().GetResourceLib().GetSize())
 , cur_task_time(m_world->GetEnvironment().GetNumTasks())   // Added for tracking time; WRE 03-18-07
-, m_tolerance_immigrants()
-, m_tolerance_offspring_own()
-, m_tolerance_offspring_others()
-, m_intolerances((m_world->GetConfig().TOLERANCE_VARIATIONS.Get() > 0) ? 1 : 3)
-, mating_type(MATING_TYPE_JUVENILE)
-, mate_preference(MATE_PREFERENCE_RANDOM)
-, cur_mating_display_a(0)
-, cur_mating_display_b(0)
 , m_reaction_result(NULL)
 , last_task_count(m_world->GetEnvironment().GetNumTasks())
-, last_para_tasks(m_world->GetEnvironment().GetNumTasks())
 , last_host_tasks(m_world->GetEnvironment().GetNumTasks())
 , last_internal_task_count(m_world->GetEnvironment().GetNumTasks())
 , last_task_quality(m_world->GetEnvironment().GetNumTasks())
@@ -79,9 +108,6 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , last_collect_spec_counts()
 , last_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
 , last_reaction_add_reward(m_world->GetEnvironment().GetReactionLib().GetSize())  
-, last_sense_count(m_world->GetStats().GetSenseSize())
-, last_mating_display_a(0)
-, last_mating_display_b(0)
 , generation(0)
 , birth_cell_id(0)
 , av_birth_cell_id(0)
@@ -92,7 +118,14 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , res_consumed(0)
 , is_germ_cell(m_world->GetConfig().DEMES_ORGS_START_IN_GERM.Get())
 , last_task_time(0)
-
+, m_donation(NULL)
+, m_energy_sharing(NULL)
+, m_tolerance(NULL)
+, m_sensing(NULL)
+, m_parasite(NULL)
+, m_attack(NULL)
+, m_mating(NULL)
+, num_group_attack_inst(0)
 { 
   if (parent_generation >= 0) {
     generation = parent_generation;
@@ -110,10 +143,19 @@ cPhenotype::~cPhenotype()
   // Remove Task States
   for (Apto::Map<void*, cTaskState*>::ValueIterator it = m_task_states.Values(); it.Next();) delete (*it.Get());
   delete m_reaction_result;
+  delete m_donation;
+  delete m_energy_sharing;
+  delete m_tolerance;
+  delete m_sensing;
+  delete m_parasite;
+  delete m_attack;
+  delete m_mating;
 }
 
 
-cPhenotype::cPhenotype(const cPhenotype& in_phen) : m_reaction_result(NULL)
+cPhenotype::cPhenotype(const cPhenotype& in_phen)
+  : m_reaction_result(NULL), m_donation(NULL), m_energy_sharing(NULL), m_tolerance(NULL)
+  , m_sensing(NULL), m_parasite(NULL), m_attack(NULL), m_mating(NULL)
 {
   *this = in_phen;
 }
@@ -149,7 +191,6 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   cur_num_errors           = in_phen.cur_num_errors;                         
   cur_num_donates          = in_phen.cur_num_donates;                       
   cur_task_count           = in_phen.cur_task_count;  
-  cur_para_tasks           = in_phen.cur_para_tasks;
   cur_host_tasks           = in_phen.cur_host_tasks;
   eff_task_count           = in_phen.eff_task_count;
   cur_internal_task_count  = in_phen.cur_internal_task_count;
@@ -164,27 +205,22 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   first_reaction_execs     = first_reaction_execs;            
   cur_reaction_add_reward  = in_phen.cur_reaction_add_reward;     
   cur_inst_count           = in_phen.cur_inst_count;                 
-  cur_from_sensor_count    = in_phen.cur_from_sensor_count;
-  cur_group_attack_count    = in_phen.cur_group_attack_count;
-  cur_top_pred_group_attack_count    = in_phen.cur_top_pred_group_attack_count;
-  cur_killed_targets       = in_phen.cur_killed_targets;
-  cur_attacks              = in_phen.cur_attacks;
-  cur_kills                 = in_phen.cur_kills;
-  cur_sense_count          = in_phen.cur_sense_count;
-  sensed_resources         = in_phen.sensed_resources;            
+  copyBlock(m_sensing, in_phen.m_sensing);
+  copyBlock(m_parasite, in_phen.m_parasite);
+  copyBlock(m_attack, in_phen.m_attack);
+  num_group_attack_inst    = in_phen.num_group_attack_inst;
   cur_task_time            = in_phen.cur_task_time;
-  m_tolerance_immigrants          = in_phen.m_tolerance_immigrants;
-  m_tolerance_offspring_own       = in_phen.m_tolerance_offspring_own;
-  m_tolerance_offspring_others    = in_phen.m_tolerance_offspring_others;
-  m_intolerances                  = in_phen.m_intolerances;
+  if (in_phen.m_tolerance) {
+    tolerance().immigrants        = in_phen.m_tolerance->immigrants;
+    m_tolerance->offspring_own    = in_phen.m_tolerance->offspring_own;
+    m_tolerance->offspring_others = in_phen.m_tolerance->offspring_others;
+    m_tolerance->intolerances     = in_phen.m_tolerance->intolerances;
+  } else if (m_tolerance) {
+    m_tolerance->Reset();
+  }
   cur_child_germline_propensity = in_phen.cur_child_germline_propensity;
   cur_stolen_reaction_count       = in_phen.cur_stolen_reaction_count;  
-  mating_type = in_phen.mating_type; //@CHC
-  mate_preference = in_phen.mate_preference; //@CHC
-  cur_mating_display_a = in_phen.cur_mating_display_a;
-  cur_mating_display_b = in_phen.cur_mating_display_b;
-  last_mating_display_a = in_phen.last_mating_display_a;
-  last_mating_display_b = in_phen.last_mating_display_b;  
+  copyBlock(m_mating, in_phen.m_mating); //@CHC
   
   cur_from_message_count    = in_phen.cur_from_message_count;
 
@@ -202,7 +238,6 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   last_num_donates         = in_phen.last_num_donates;
   last_task_count          = in_phen.last_task_count;
   last_host_tasks          = in_phen.last_host_tasks;
-  last_para_tasks          = in_phen.last_para_tasks;
   last_internal_task_count = in_phen.last_internal_task_count;
   last_task_quality        = in_phen.last_task_quality;
   last_internal_task_quality=in_phen.last_internal_task_quality;
@@ -213,18 +248,8 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   last_reaction_count      = in_phen.last_reaction_count;
   last_reaction_add_reward = in_phen.last_reaction_add_reward; 
   last_inst_count          = in_phen.last_inst_count;	  
-  last_from_sensor_count   = in_phen.last_from_sensor_count;
-  last_group_attack_count   = in_phen.last_group_attack_count;
-  last_top_pred_group_attack_count   = in_phen.last_top_pred_group_attack_count;
-  last_killed_targets      = in_phen.last_killed_targets;
-  last_attacks             = in_phen.last_attacks;
-  last_kills                = in_phen.last_kills;
-  last_sense_count         = in_phen.last_sense_count;
   last_fitness             = in_phen.last_fitness;            
   last_child_germline_propensity = in_phen.last_child_germline_propensity;
-  total_energy_donated     = in_phen.total_energy_donated;
-  total_energy_received    = in_phen.total_energy_received;
-  total_energy_applied     = in_phen.total_energy_applied;
   
   last_from_message_count   = in_phen.last_from_message_count;
 
@@ -253,54 +278,8 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   to_delete               = in_phen.to_delete;        
   is_injected             = in_phen.is_injected;
   is_clone                = in_phen.is_clone;
-  is_donor_cur            = in_phen.is_donor_cur;     
-  is_donor_last           = in_phen.is_donor_last;     
-  is_donor_rand           = in_phen.is_donor_rand;    
-  is_donor_rand_last      = in_phen.is_donor_rand_last;
-  is_donor_null           = in_phen.is_donor_null;    
-  is_donor_null_last      = in_phen.is_donor_null_last;
-  is_donor_kin            = in_phen.is_donor_kin;    
-  is_donor_kin_last       = in_phen.is_donor_kin_last;
-  is_donor_edit           = in_phen.is_donor_edit;   
-  is_donor_edit_last      = in_phen.is_donor_edit_last; 
-  is_donor_gbg            = in_phen.is_donor_gbg;     
-  is_donor_gbg_last       = in_phen.is_donor_gbg_last;
-  is_donor_truegb         = in_phen.is_donor_truegb; 
-  is_donor_truegb_last    = in_phen.is_donor_truegb_last;
-  is_donor_threshgb       = in_phen.is_donor_threshgb;  
-  is_donor_threshgb_last  = in_phen.is_donor_threshgb_last;
-  is_donor_quanta_threshgb        = in_phen.is_donor_quanta_threshgb;  
-  is_donor_quanta_threshgb_last   = in_phen.is_donor_quanta_threshgb_last;
-  is_donor_shadedgb       = in_phen.is_donor_shadedgb;  
-  is_donor_shadedgb_last  = in_phen.is_donor_shadedgb_last;	
-  is_donor_locus          = in_phen.is_donor_locus;
-  is_donor_locus_last     = in_phen.is_donor_locus_last;
-  num_thresh_gb_donations         = in_phen.num_thresh_gb_donations;  
-  num_thresh_gb_donations_last    = in_phen.num_thresh_gb_donations_last;  
-  num_quanta_thresh_gb_donations = in_phen.num_quanta_thresh_gb_donations;
-  num_quanta_thresh_gb_donations_last = in_phen.num_quanta_thresh_gb_donations_last;
-  num_shaded_gb_donations         = in_phen.num_shaded_gb_donations;  
-  num_shaded_gb_donations_last    = in_phen.num_shaded_gb_donations_last; 
-  num_donations_locus     = in_phen.num_donations_locus;
-  num_donations_locus_last = in_phen.num_donations_locus_last;
-  is_receiver             = in_phen.is_receiver;   
-  is_receiver_last        = in_phen.is_receiver_last;      
-  is_receiver_rand        = in_phen.is_receiver_rand;
-  is_receiver_kin         = in_phen.is_receiver_kin; 
-  is_receiver_kin_last    = in_phen.is_receiver_kin_last; 
-  is_receiver_edit        = in_phen.is_receiver_edit; 
-  is_receiver_edit_last   = in_phen.is_receiver_edit_last; 
-  is_receiver_gbg         = in_phen.is_receiver_gbg; 
-  is_receiver_truegb      = in_phen.is_receiver_truegb;
-  is_receiver_truegb_last = in_phen.is_receiver_truegb_last;
-  is_receiver_threshgb    = in_phen.is_receiver_threshgb;
-  is_receiver_threshgb_last    = in_phen.is_receiver_threshgb_last;
-  is_receiver_quanta_threshgb  = in_phen.is_receiver_quanta_threshgb;
-  is_receiver_quanta_threshgb_last = in_phen.is_receiver_quanta_threshgb_last;
-  is_receiver_shadedgb    = in_phen.is_receiver_shadedgb;
-  is_receiver_shadedgb_last    = in_phen.is_receiver_shadedgb_last;	
-  is_receiver_gb_same_locus = in_phen.is_receiver_gb_same_locus;
-  is_receiver_gb_same_locus_last = in_phen.is_receiver_gb_same_locus_last;
+  if (in_phen.m_donation) donation() = *in_phen.m_donation;
+  else if (m_donation) *m_donation = sDonationState();
   is_modifier             = in_phen.is_modifier;      
   is_modified             = in_phen.is_modified;      
   is_fertile              = in_phen.is_fertile;      
@@ -310,16 +289,8 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   parent_sex              = in_phen.parent_sex;      
   parent_cross_num        = in_phen.parent_cross_num; 
   
-  is_energy_requestor     = in_phen.is_energy_requestor;
-  is_energy_donor         = in_phen.is_energy_donor;
-  is_energy_receiver      = in_phen.is_energy_receiver;
-  has_used_donated_energy = in_phen.has_used_donated_energy;
-  has_open_energy_request = in_phen.has_open_energy_request;
-  total_energy_donated    = in_phen.total_energy_donated;
-  total_energy_received   = in_phen.total_energy_received;
-  total_energy_applied    = in_phen.total_energy_applied;
-  kaboom_executed         = in_phen.kaboom_executed;
-  kaboom_executed2         = in_phen.kaboom_executed2;
+  if (in_phen.m_energy_sharing) energySharing() = *in_phen.m_energy_sharing;
+  else if (m_energy_sharing) *m_energy_sharing = sEnergySharingState();
   
   // 6. Child information...
   copy_true               = in_phen.copy_true;       
@@ -383,7 +354,6 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
   cur_host_tasks.SetAll(0);
-  cur_para_tasks.SetAll(0);
   cur_task_quality.SetAll(0);
   cur_task_value.SetAll(0);
   cur_internal_task_quality.SetAll(0);
@@ -406,37 +376,16 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   cur_stolen_reaction_count.SetAll(0);
   cur_reaction_add_reward.SetAll(0);
   cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
   cur_from_message_count.SetAll(0);
-  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
-    cur_group_attack_count[r].SetAll(0);
-    cur_top_pred_group_attack_count[r].SetAll(0);
-  }
-  cur_killed_targets.SetAll(0);
-  cur_attacks = 0;
-  cur_kills = 0;
-  cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);  // Added for time tracking; WRE 03-18-07
-  for (int j = 0; j < sensed_resources.GetSize(); j++) {
-    sensed_resources[j] =  parent_phenotype.sensed_resources[j];
-  }
   cur_trial_fitnesses.Resize(0); 
   cur_trial_bonuses.Resize(0); 
   cur_trial_times_used.Resize(0); 
   trial_time_used = 0;
   trial_cpu_cycles_used = 0;
-  m_tolerance_immigrants.Clear();        
-  m_tolerance_offspring_own.Clear();     
-  m_tolerance_offspring_others.Clear();  
-  m_intolerances.SetAll(make_pair(-1, -1));  
+  if (m_tolerance) m_tolerance->Reset();
   cur_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
-  mating_type = MATING_TYPE_JUVENILE; //@CHC
-  mate_preference = MATE_PREFERENCE_RANDOM; //@CHC
-  
-  cur_mating_display_a = 0;
-  cur_mating_display_b = 0;
-  last_mating_display_a = 0;
-  last_mating_display_b = 0;
+  clearBlock(m_mating); //@CHC
   
   // Copy last values from parent
   last_merit_base           = parent_phenotype.last_merit_base;
@@ -446,7 +395,6 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   last_num_donates          = parent_phenotype.last_num_donates;
   last_task_count           = parent_phenotype.last_task_count;
   last_host_tasks           = parent_phenotype.last_host_tasks;
-  last_para_tasks           = parent_phenotype.last_para_tasks;
   last_internal_task_count  = parent_phenotype.last_internal_task_count;
   last_task_quality         = parent_phenotype.last_task_quality;
   last_task_value           = parent_phenotype.last_task_value;
@@ -457,13 +405,6 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   last_reaction_count       = parent_phenotype.last_reaction_count;
   last_reaction_add_reward  = parent_phenotype.last_reaction_add_reward;
   last_inst_count           = parent_phenotype.last_inst_count;
-  last_from_sensor_count    = parent_phenotype.last_from_sensor_count;
-  last_group_attack_count    = parent_phenotype.last_group_attack_count;
-  last_top_pred_group_attack_count    = parent_phenotype.last_top_pred_group_attack_count;
-  last_killed_targets       = parent_phenotype.last_killed_targets;
-  last_attacks              = parent_phenotype.last_attacks;
-  last_kills                = parent_phenotype.last_kills;
-  last_sense_count          = parent_phenotype.last_sense_count;
   last_fitness              = CalcFitness(last_merit_base, last_bonus, gestation_time, last_cpu_cycles_used);
   last_child_germline_propensity = parent_phenotype.last_child_germline_propensity;   // chance of child being a germline cell; @JEB
   
@@ -489,67 +430,25 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   is_germ_cell             = parent_phenotype.is_germ_cell;
   last_task_time           = 0; 
   
-  num_thresh_gb_donations = 0;
-  num_thresh_gb_donations_last = parent_phenotype.num_thresh_gb_donations_last;
-  num_quanta_thresh_gb_donations = 0;
-  num_quanta_thresh_gb_donations_last = parent_phenotype.num_thresh_gb_donations_last;
-  num_shaded_gb_donations = 0;
-  num_shaded_gb_donations_last = parent_phenotype.num_shaded_gb_donations_last;
-  num_donations_locus = 0;
-  num_donations_locus_last = parent_phenotype.num_donations_locus_last;
+  if (parent_phenotype.m_donation) donation().SetupOffspring(*parent_phenotype.m_donation);
+  else if (m_donation) *m_donation = sDonationState();
   
+  // Current counts start over, the parent's last counts carry over
+  if (parent_phenotype.m_sensing) sensing().SetupOffspring(*parent_phenotype.m_sensing);
+  else clearBlock(m_sensing);
+  if (parent_phenotype.m_parasite) parasite().SetupOffspring(*parent_phenotype.m_parasite);
+  else clearBlock(m_parasite);
+  if (parent_phenotype.m_attack) attack().SetupOffspring(*parent_phenotype.m_attack);
+  else clearBlock(m_attack);
 	
   // Setup flags...
   is_injected   = false;
   is_clone   = false;
-  is_donor_cur  = false;
-  is_donor_last = parent_phenotype.is_donor_last;
-  is_donor_rand = false;
-  is_donor_rand_last = parent_phenotype.is_donor_rand_last;
-  is_donor_null = false;
-  is_donor_null_last = parent_phenotype.is_donor_null_last;
-  is_donor_kin  = false;
-  is_donor_kin_last = parent_phenotype.is_donor_kin_last;
-  is_donor_edit  = false;
-  is_donor_edit_last = parent_phenotype.is_donor_edit_last;
-  is_donor_gbg  = false;
-  is_donor_gbg_last = parent_phenotype.is_donor_gbg_last;
-  is_donor_truegb  = false;
-  is_donor_truegb_last = parent_phenotype.is_donor_truegb_last;
-  is_donor_threshgb  = false;
-  is_donor_threshgb_last = parent_phenotype.is_donor_threshgb_last;
-  is_donor_quanta_threshgb  = false;
-  is_donor_quanta_threshgb_last = parent_phenotype.is_donor_quanta_threshgb_last;
-  is_donor_shadedgb  = false;
-  is_donor_shadedgb_last = parent_phenotype.is_donor_shadedgb_last;	
-  is_donor_locus.SetAll(false);
-  is_donor_locus_last = parent_phenotype.is_donor_locus_last;
-  
-  is_receiver   = false;  
-  is_receiver_last = parent_phenotype.is_receiver_last;
-  is_receiver_rand   = false;
-  is_receiver_kin    = false;
-  is_receiver_kin_last    = parent_phenotype.is_receiver_kin_last;
-  is_receiver_edit   = false;
-  is_receiver_edit_last    = parent_phenotype.is_receiver_edit_last;
-  is_receiver_gbg    = false;
-  is_receiver_truegb = false;
-  is_receiver_truegb_last = parent_phenotype.is_receiver_truegb_last;
-  is_receiver_threshgb = false;
-  is_receiver_threshgb_last = parent_phenotype.is_receiver_threshgb_last;
-  is_receiver_quanta_threshgb = false;
-  is_receiver_quanta_threshgb_last = parent_phenotype.is_receiver_quanta_threshgb_last;
-  is_receiver_shadedgb = false;
-  is_receiver_shadedgb_last = parent_phenotype.is_receiver_shadedgb_last;	
-  is_receiver_gb_same_locus = false;
-  is_receiver_gb_same_locus_last = parent_phenotype.is_receiver_gb_same_locus;
   
   is_modifier   = false;
   is_modified   = false;
   is_fertile    = parent_phenotype.last_child_fertile;
   is_mutated    = false;
-  kaboom_executed = false;
-  kaboom_executed2 = false;
   if (m_world->GetConfig().INHERIT_MULTITHREAD.Get()) {
     is_multi_thread = parent_phenotype.is_multi_thread;
   } else {
@@ -563,14 +462,7 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   to_die = false;
   to_delete = false;
   
-  is_energy_requestor = false;
-  is_energy_donor = false;
-  is_energy_receiver = false;
-  has_used_donated_energy = false;
-  has_open_energy_request = false;
-  total_energy_donated = 0.0;
-  total_energy_received = 0.0; 
-  total_energy_applied = 0.0;
+  if (m_energy_sharing) m_energy_sharing->Reset(true, true);
   
   // Setup child info...
   copy_true          = false;
@@ -619,7 +511,6 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   cur_num_errors  = 0;
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
-  cur_para_tasks.SetAll(0);
   cur_host_tasks.SetAll(0);
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
@@ -639,30 +530,16 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   cur_stolen_reaction_count.SetAll(0);
   cur_reaction_add_reward.SetAll(0);
   cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
   cur_from_message_count.SetAll(0);
-  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
-    cur_group_attack_count[r].SetAll(0);
-    cur_top_pred_group_attack_count[r].SetAll(0);
-  }
-  cur_killed_targets.SetAll(0);
-  cur_attacks = 0;
-  cur_kills = 0;
-  sensed_resources.SetAll(0);
-  cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);
   cur_trial_fitnesses.Resize(0);
   cur_trial_bonuses.Resize(0); 
   cur_trial_times_used.Resize(0); 
   trial_time_used = 0;
   trial_cpu_cycles_used = 0;
-  m_tolerance_immigrants.Clear();        
-  m_tolerance_offspring_own.Clear();     
-  m_tolerance_offspring_others.Clear();  
-  m_intolerances.SetAll(make_pair(-1, -1));  
+  if (m_tolerance) m_tolerance->Reset();
   cur_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
-  mating_type = MATING_TYPE_JUVENILE; // @CHC
-  mate_preference = MATE_PREFERENCE_RANDOM; //@CHC
+  clearBlock(m_mating); // @CHC
   
   // New organism has no parent and so cannot use its last values; initialize as needed
   last_merit_base = genome_length;
@@ -672,7 +549,6 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   last_num_donates = 0;
   last_task_count.SetAll(0);
   last_host_tasks.SetAll(0);
-  last_para_tasks.SetAll(0);
   last_internal_task_count.SetAll(0);
   last_task_quality.SetAll(0);
   last_task_value.SetAll(0);
@@ -683,16 +559,7 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   last_reaction_count.SetAll(0);
   last_reaction_add_reward.SetAll(0);
   last_inst_count.SetAll(0);
-  last_from_sensor_count.SetAll(0);
   last_from_message_count.SetAll(0);
-  for (int r = 0; r < last_group_attack_count.GetSize(); r++) {
-    last_group_attack_count[r].SetAll(0);
-    last_top_pred_group_attack_count[r].SetAll(0);
-  }
-  last_killed_targets.SetAll(0);
-  last_attacks = 0;
-  last_kills = 0;
-  last_sense_count.SetAll(0);
   last_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
   
   // Setup other miscellaneous values...
@@ -709,59 +576,14 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   exec_time_born  = 0;
   birth_update     = m_world->GetStats().GetUpdate();
   
-  num_thresh_gb_donations = 0;
-  num_thresh_gb_donations_last = 0;
-  num_quanta_thresh_gb_donations = 0;
-  num_quanta_thresh_gb_donations_last = 0;
-  num_shaded_gb_donations = 0;
-  num_shaded_gb_donations_last = 0;	
-  num_donations_locus = 0;
-  num_donations_locus_last = 0;
+  if (m_donation) *m_donation = sDonationState();
+  clearBlock(m_sensing);
+  clearBlock(m_parasite);
+  clearBlock(m_attack);
 	
   // Setup flags...
   is_injected   = true;
   is_clone   = false;
-  is_donor_last = false;
-  is_donor_cur  = false;
-  is_donor_rand = false;
-  is_donor_rand_last = false;
-  is_donor_null = false;
-  is_donor_null_last = false;
-  is_donor_kin = false;
-  is_donor_kin_last = false;
-  is_donor_edit = false;
-  is_donor_edit_last = false;
-  is_donor_gbg = false;
-  is_donor_gbg_last = false;
-  is_donor_truegb = false;
-  is_donor_truegb_last = false;
-  is_donor_threshgb = false;
-  is_donor_threshgb_last = false;
-  is_donor_quanta_threshgb = false;
-  is_donor_quanta_threshgb_last = false;
-  is_donor_shadedgb = false;
-  is_donor_shadedgb_last = false;
-  is_donor_locus.SetAll(false);
-  is_donor_locus_last.SetAll(false);
-  
-  is_receiver   = false;
-  is_receiver_last   = false;
-  is_receiver_rand   = false;
-  is_receiver_kin   = false;
-  is_receiver_kin_last   = false;
-  is_receiver_edit   = false;
-  is_receiver_edit_last   = false;
-  is_receiver_gbg   = false;
-  is_receiver_truegb   = false;
-  is_receiver_truegb_last   = false;
-  is_receiver_threshgb   = false;
-  is_receiver_threshgb_last   = false;
-  is_receiver_quanta_threshgb   = false;
-  is_receiver_quanta_threshgb_last   = false;
-  is_receiver_shadedgb   = false;
-  is_receiver_shadedgb_last   = false;	
-  is_receiver_gb_same_locus = false;
-  is_receiver_gb_same_locus_last = false;
   
   is_modifier   = false;
   is_modified   = false;
@@ -774,17 +596,8 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   make_random_resource = false;
   to_die = false;
   to_delete = false;
-  kaboom_executed = false;
-  kaboom_executed2 = false;
   
-  is_energy_requestor = false;
-  is_energy_donor = false;
-  is_energy_receiver = false;
-  has_used_donated_energy = false;
-  has_open_energy_request = false;
-  total_energy_donated = 0.0;
-  total_energy_received = 0.0;
-  total_energy_applied = 0.0;
+  if (m_energy_sharing) m_energy_sharing->Reset(true, true);
   
   // Setup child info...
   copy_true         = false;
@@ -863,7 +676,6 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   last_num_donates          = cur_num_donates;
   last_task_count           = cur_task_count;
   last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
   last_internal_task_count  = cur_internal_task_count;
   last_task_quality         = cur_task_quality;
   last_task_value           = cur_task_value;
@@ -874,19 +686,9 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   last_reaction_count       = cur_reaction_count;
   last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
-  last_from_sensor_count    = cur_from_sensor_count;
   last_from_message_count    = cur_from_message_count;
-  last_group_attack_count   = cur_group_attack_count;
-  last_killed_targets       = cur_killed_targets;
-  last_attacks              = cur_attacks;
-  last_kills                = cur_kills;
-  last_top_pred_group_attack_count    = cur_top_pred_group_attack_count;
-  last_sense_count          = cur_sense_count;
   last_child_germline_propensity = cur_child_germline_propensity;
   
-  last_mating_display_a = cur_mating_display_a; //@CHC
-  last_mating_display_b = cur_mating_display_b;
-  
   // Reset cur values.
   cur_bonus       = m_world->GetConfig().DEFAULT_BONUS.Get();
   cpu_cycles_used = 0;
@@ -896,14 +698,18 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   cur_task_count.SetAll(0);
   cur_host_tasks.SetAll(0);
   
-  cur_mating_display_a = 0; //@CHC
-  cur_mating_display_b = 0;
+  if (m_mating) { //@CHC
+    m_mating->last_mating_display_a = m_mating->cur_mating_display_a;
+    m_mating->last_mating_display_b = m_mating->cur_mating_display_b;
+    m_mating->cur_mating_display_a = 0;
+    m_mating->cur_mating_display_b = 0;
+  }
   
   // @LZ: figure out when and where to reset cur_para_tasks, depending on the divide method, and
   //      resonable assumptions
-  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {     
-    last_para_tasks = cur_para_tasks;
-    cur_para_tasks.SetAll(0);
+  if (m_parasite) {
+    if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) m_parasite->DivideReset();
+    else m_parasite->last_para_tasks = m_parasite->cur_para_tasks;
   }
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
@@ -929,16 +735,9 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   cur_stolen_reaction_count.SetAll(0);
   cur_reaction_add_reward.SetAll(0);
   cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
   cur_from_message_count.SetAll(0);
-  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
-    cur_group_attack_count[r].SetAll(0);
-    cur_top_pred_group_attack_count[r].SetAll(0);
-  }
-  cur_killed_targets.SetAll(0);
-  cur_attacks = 0;
-  cur_kills = 0;
-  cur_sense_count.SetAll(0);
+  if (m_sensing) m_sensing->DivideReset();
+  if (m_attack) m_attack->DivideReset();
   cur_task_time.SetAll(0.0);
   cur_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
   
@@ -958,59 +757,11 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   res_consumed             = 0;
   last_task_time           = 0;
   
-  num_thresh_gb_donations_last = num_thresh_gb_donations;
-  num_thresh_gb_donations = 0;
-  num_quanta_thresh_gb_donations_last = num_quanta_thresh_gb_donations;
-  num_quanta_thresh_gb_donations = 0;
-  num_shaded_gb_donations_last = num_shaded_gb_donations;
-  num_shaded_gb_donations = 0;
-  num_donations_locus_last = num_donations_locus;
-  num_donations_locus = 0;
+  if (m_donation) m_donation->DivideReset();
 	
   // Leave flags alone...
   (void) is_injected;
   is_clone = false; // has legitimately reproduced
-  is_donor_last = is_donor_cur;
-  is_donor_cur = false;
-  is_donor_rand_last = is_donor_rand;
-  is_donor_rand = false;
-  is_donor_null_last = is_donor_null;
-  is_donor_null = false;
-  is_donor_kin_last = is_donor_kin;
-  is_donor_kin = false;
-  is_donor_edit_last = is_donor_edit;
-  is_donor_edit = false;
-  is_donor_gbg_last = is_donor_gbg;
-  is_donor_gbg = false;
-  is_donor_truegb_last = is_donor_truegb;
-  is_donor_truegb = false;
-  is_donor_threshgb_last = is_donor_threshgb;
-  is_donor_threshgb = false;
-  is_donor_quanta_threshgb_last = is_donor_quanta_threshgb;
-  is_donor_quanta_threshgb = false;
-  is_donor_shadedgb_last = is_donor_shadedgb;
-  is_donor_shadedgb = false;	
-  is_donor_locus_last = is_donor_locus;
-  is_donor_locus.SetAll(false);
-  
-  is_receiver_last = is_receiver;
-  is_receiver = false;
-  is_receiver_rand = false;
-  is_receiver_kin_last = is_receiver_kin;
-  is_receiver_kin = false;
-  is_receiver_edit_last = is_receiver_edit;
-  is_receiver_edit = false;
-  is_receiver_gbg = false;
-  is_receiver_truegb_last = is_receiver_truegb;
-  is_receiver_truegb = false;
-  is_receiver_threshgb_last = is_receiver_threshgb;
-  is_receiver_threshgb = false;
-  is_receiver_quanta_threshgb_last = is_receiver_quanta_threshgb;
-  is_receiver_quanta_threshgb = false;
-  is_receiver_shadedgb_last = is_receiver_shadedgb;
-  is_receiver_shadedgb = false;	
-  is_receiver_gb_same_locus_last = is_receiver_gb_same_locus;
-  is_receiver_gb_same_locus = false;
   
   (void) is_modifier;
   (void) is_modified;
@@ -1020,8 +771,6 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   (void) parent_true;
   (void) parent_sex;
   (void) parent_cross_num;
-  (void) kaboom_executed;
-  (void) kaboom_executed2;
   
   // Reset child info...
   (void) copy_true;
@@ -1042,12 +791,7 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
     neutral_metric += m_world->GetRandom().GetRandNormal();
   }
   
-  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {
-    m_tolerance_immigrants.Clear();        
-    m_tolerance_offspring_own.Clear();     
-    m_tolerance_offspring_others.Clear();  
-    m_intolerances.SetAll(make_pair(-1, -1));  
-  }
+  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT && m_tolerance) m_tolerance->Reset();
 
   if (m_world->GetConfig().GENERATION_INC_METHOD.Get() == GENERATION_INC_BOTH) generation++;
   
@@ -1096,7 +840,6 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   last_num_donates          = cur_num_donates;
   last_task_count           = cur_task_count;
   last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
   last_internal_task_count  = cur_internal_task_count;
   last_task_quality         = cur_task_quality;
   last_task_value			= cur_task_value;
@@ -1107,14 +850,7 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   last_reaction_count       = cur_reaction_count;
   last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
-  last_from_sensor_count    = cur_from_sensor_count;
   last_from_message_count    = cur_from_message_count;
-  last_group_attack_count   = cur_group_attack_count;
-  last_killed_targets       = cur_killed_targets;
-  last_attacks              = cur_attacks;
-  last_kills                = cur_kills;
-  last_top_pred_group_attack_count    = cur_top_pred_group_attack_count;
-  last_sense_count          = cur_sense_count;
   last_child_germline_propensity = cur_child_germline_propensity;
   
   // Reset cur values.
@@ -1126,9 +862,9 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   cur_host_tasks.SetAll(0);
   // @LZ: figure out when and where to reset cur_para_tasks, depending on the divide method, and
   //      resonable assumptions
-  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {
-    last_para_tasks = cur_para_tasks;
-    cur_para_tasks.SetAll(0);
+  if (m_parasite) {
+    if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) m_parasite->DivideReset();
+    else m_parasite->last_para_tasks = m_parasite->cur_para_tasks;
   }
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
@@ -1148,27 +884,17 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   cur_stolen_reaction_count.SetAll(0);
   cur_reaction_add_reward.SetAll(0);
   cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
   cur_from_message_count.SetAll(0);
-  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
-    cur_group_attack_count[r].SetAll(0);
-    cur_top_pred_group_attack_count[r].SetAll(0);
-  }
-  cur_killed_targets.SetAll(0);
-  cur_attacks = 0;
-  cur_kills = 0;
-  cur_sense_count.SetAll(0);
+  if (m_sensing) m_sensing->DivideReset();
+  if (m_attack) m_attack->DivideReset();
+  if (m_sensing) m_sensing->sensed_resources.SetAll(-1.0);
   cur_task_time.SetAll(0.0);
-  sensed_resources.SetAll(-1.0);
   cur_trial_fitnesses.Resize(0); 
   cur_trial_bonuses.Resize(0); 
   cur_trial_times_used.Resize(0); 
   trial_time_used = 0;
   trial_cpu_cycles_used = 0;
-  m_tolerance_immigrants.Clear();
-  m_tolerance_offspring_own.Clear();
-  m_tolerance_offspring_others.Clear();
-  m_intolerances.SetAll(make_pair(-1, -1));  
+  if (m_tolerance) m_tolerance->Reset();
   cur_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
   
   // Setup other miscellaneous values...
@@ -1188,59 +914,11 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   last_task_time           = 0;
 
   
-  num_thresh_gb_donations_last = num_thresh_gb_donations;
-  num_thresh_gb_donations = 0;
-  num_quanta_thresh_gb_donations_last = num_quanta_thresh_gb_donations;
-  num_quanta_thresh_gb_donations = 0;
-  num_shaded_gb_donations_last = num_shaded_gb_donations;
-  num_shaded_gb_donations = 0;
-  num_donations_locus_last = num_donations_locus;
-  num_donations_locus = 0;
+  if (m_donation) m_donation->DivideReset();
 	
   // Leave flags alone...
   (void) is_injected;
   is_clone = false; // has legitimately reproduced
-  is_donor_last = is_donor_cur;
-  is_donor_cur = false;
-  is_donor_rand_last = is_donor_rand;
-  is_donor_rand = false;
-  is_donor_null_last = is_donor_null;
-  is_donor_null = false;
-  is_donor_kin_last = is_donor_kin;
-  is_donor_kin = false;
-  is_donor_edit_last = is_donor_edit;
-  is_donor_edit = false;
-  is_donor_gbg_last = is_donor_gbg;
-  is_donor_gbg = false;
-  is_donor_truegb_last = is_donor_truegb;
-  is_donor_truegb = false;
-  is_donor_threshgb_last = is_donor_threshgb;
-  is_donor_threshgb = false;
-  is_donor_quanta_threshgb_last = is_donor_quanta_threshgb;
-  is_donor_quanta_threshgb = false;
-  is_donor_shadedgb_last = is_donor_shadedgb;
-  is_donor_shadedgb = false;
-  is_donor_locus_last = is_donor_locus;
-  is_donor_locus.SetAll(false);
-  
-  is_receiver_last = is_receiver;
-  is_receiver = false;
-  is_receiver_rand = false;
-  is_receiver_kin_last = is_receiver_kin;
-  is_receiver_kin = false;
-  is_receiver_edit_last = is_receiver_edit;
-  is_receiver_edit = false;
-  is_receiver_gbg = false;
-  is_receiver_truegb_last = is_receiver_truegb;
-  is_receiver_truegb = false;
-  is_receiver_threshgb_last = is_receiver_threshgb;
-  is_receiver_threshgb = false;
-  is_receiver_quanta_threshgb_last = is_receiver_quanta_threshgb;
-  is_receiver_quanta_threshgb = false;
-  is_receiver_shadedgb_last = is_receiver_shadedgb;
-  is_receiver_shadedgb = false;	
-  is_receiver_gb_same_locus_last = is_receiver_gb_same_locus;
-  is_receiver_gb_same_locus = false;
   
   (void) is_modifier;
   (void) is_modified;
@@ -1250,8 +928,6 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   (void) parent_true;
   (void) parent_sex;
   (void) parent_cross_num;
-  (void) kaboom_executed;
-  (void) kaboom_executed2;
   
   // Reset child info...
   (void) copy_true;
@@ -1307,7 +983,6 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
   cur_host_tasks.SetAll(0);
-  cur_para_tasks.SetAll(0);
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
   cur_rbins_total.SetAll(0);
@@ -1319,32 +994,16 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   cur_stolen_reaction_count.SetAll(0);
   cur_reaction_add_reward.SetAll(0);
   cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
   cur_from_message_count.SetAll(0);
-  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
-    cur_group_attack_count[r].SetAll(0);
-    cur_top_pred_group_attack_count[r].SetAll(0);
-  }
-  cur_killed_targets.SetAll(0);
-  cur_attacks = 0;
-  cur_kills = 0;
-  cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);
-  for (int j = 0; j < sensed_resources.GetSize(); j++) {
-    sensed_resources[j] = clone_phenotype.sensed_resources[j];
-  }
   cur_trial_fitnesses.Resize(0); 
   cur_trial_bonuses.Resize(0); 
   cur_trial_times_used.Resize(0); 
   trial_time_used = 0;
   trial_cpu_cycles_used = 0;
-  m_tolerance_immigrants.Clear();        
-  m_tolerance_offspring_own.Clear();     
-  m_tolerance_offspring_others.Clear();  
-  m_intolerances.SetAll(make_pair(-1, -1));  
+  if (m_tolerance) m_tolerance->Reset();
   cur_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
-  mating_type = MATING_TYPE_JUVENILE; // @CHC
-  mate_preference = MATE_PREFERENCE_RANDOM; //@CHC
+  clearBlock(m_mating); // @CHC
   
   // Copy last values from parent
   last_merit_base          = clone_phenotype.last_merit_base;
@@ -1354,7 +1013,6 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   last_num_donates         = clone_phenotype.last_num_donates;
   last_task_count          = clone_phenotype.last_task_count;
   last_host_tasks          = clone_phenotype.last_host_tasks;
-  last_para_tasks          = clone_phenotype.last_para_tasks;
   last_internal_task_count = clone_phenotype.last_internal_task_count;
   last_rbins_total         = clone_phenotype.last_rbins_total;
   last_rbins_avail         = clone_phenotype.last_rbins_avail;
@@ -1362,14 +1020,7 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   last_reaction_count      = clone_phenotype.last_reaction_count;
   last_reaction_add_reward = clone_phenotype.last_reaction_add_reward;
   last_inst_count          = clone_phenotype.last_inst_count;
-  last_from_sensor_count   = clone_phenotype.last_from_sensor_count;
   last_from_message_count   = clone_phenotype.last_from_message_count;
-  last_group_attack_count   = clone_phenotype.last_group_attack_count;
-  last_top_pred_group_attack_count   = clone_phenotype.last_top_pred_group_attack_count;
-  last_killed_targets      = clone_phenotype.last_killed_targets;
-  last_attacks             = clone_phenotype.last_attacks;
-  last_kills                = clone_phenotype.last_kills;
-  last_sense_count         = clone_phenotype.last_sense_count;
   last_fitness             = CalcFitness(last_merit_base, last_bonus, gestation_time, last_cpu_cycles_used);
   last_child_germline_propensity = clone_phenotype.last_child_germline_propensity;
   
@@ -1394,59 +1045,20 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   last_task_time           = clone_phenotype.last_task_time;
 
   
-  num_thresh_gb_donations_last = clone_phenotype.num_thresh_gb_donations_last;
-  num_thresh_gb_donations  = clone_phenotype.num_thresh_gb_donations;
-  num_quanta_thresh_gb_donations_last = clone_phenotype.num_quanta_thresh_gb_donations_last;
-  num_quanta_thresh_gb_donations  = clone_phenotype.num_quanta_thresh_gb_donations;
-  num_shaded_gb_donations_last = clone_phenotype.num_shaded_gb_donations_last;
-  num_shaded_gb_donations  = clone_phenotype.num_shaded_gb_donations;
-  num_donations_locus = clone_phenotype.num_donations_locus;
-  num_donations_locus_last = clone_phenotype.num_donations_locus_last;
+  if (clone_phenotype.m_donation) donation().SetupClone(*clone_phenotype.m_donation);
+  else if (m_donation) m_donation->SetupClone(sDonationState());
+  
+  // Current counts start over, the clone's last counts carry over
+  if (clone_phenotype.m_sensing) sensing().SetupOffspring(*clone_phenotype.m_sensing);
+  else clearBlock(m_sensing);
+  if (clone_phenotype.m_parasite) parasite().SetupOffspring(*clone_phenotype.m_parasite);
+  else clearBlock(m_parasite);
+  if (clone_phenotype.m_attack) attack().SetupOffspring(*clone_phenotype.m_attack);
+  else clearBlock(m_attack);
 	
   // Setup flags...
   is_injected   = false;
   is_clone   = true;
-  is_donor_last = clone_phenotype.is_donor_last;
-  is_donor_cur  = clone_phenotype.is_donor_cur;
-  is_receiver = false;
-  is_donor_rand_last = clone_phenotype.is_donor_rand_last;
-  is_donor_rand  = clone_phenotype.is_donor_rand;
-  is_donor_null_last = clone_phenotype.is_donor_null_last;
-  is_donor_null  = clone_phenotype.is_donor_null;
-  is_donor_kin_last = clone_phenotype.is_donor_kin_last;
-  is_donor_kin  = clone_phenotype.is_donor_kin;
-  is_donor_edit_last = clone_phenotype.is_donor_edit_last;
-  is_donor_edit  = clone_phenotype.is_donor_edit;
-  is_donor_gbg_last = clone_phenotype.is_donor_gbg_last;
-  is_donor_gbg  = clone_phenotype.is_donor_gbg;
-  is_donor_truegb_last = clone_phenotype.is_donor_truegb_last;
-  is_donor_truegb  = clone_phenotype.is_donor_truegb;
-  is_donor_threshgb_last = clone_phenotype.is_donor_threshgb_last;
-  is_donor_threshgb  = clone_phenotype.is_donor_threshgb;
-  is_donor_quanta_threshgb_last = clone_phenotype.is_donor_quanta_threshgb_last;
-  is_donor_quanta_threshgb  = clone_phenotype.is_donor_quanta_threshgb;
-  is_donor_shadedgb_last = clone_phenotype.is_donor_shadedgb_last;
-  is_donor_shadedgb  = clone_phenotype.is_donor_shadedgb;
-  is_donor_locus_last = clone_phenotype.is_donor_locus_last;
-  is_donor_locus = clone_phenotype.is_donor_locus;
-  
-  is_receiver = clone_phenotype.is_receiver;
-  is_receiver_last = clone_phenotype.is_receiver_last;
-  is_receiver_rand = clone_phenotype.is_receiver_rand;
-  is_receiver_kin = clone_phenotype.is_receiver_kin;
-  is_receiver_kin_last = clone_phenotype.is_receiver_kin_last;
-  is_receiver_edit = clone_phenotype.is_receiver_edit;
-  is_receiver_edit_last = clone_phenotype.is_receiver_edit_last;
-  is_receiver_gbg = clone_phenotype.is_receiver_gbg;
-  is_receiver_truegb = clone_phenotype.is_receiver_truegb;
-  is_receiver_truegb_last = clone_phenotype.is_receiver_truegb_last;
-  is_receiver_threshgb = clone_phenotype.is_receiver_threshgb;
-  is_receiver_threshgb_last = clone_phenotype.is_receiver_threshgb_last;
-  is_receiver_quanta_threshgb = clone_phenotype.is_receiver_quanta_threshgb;
-  is_receiver_quanta_threshgb_last = clone_phenotype.is_receiver_quanta_threshgb_last;
-  is_receiver_shadedgb = clone_phenotype.is_receiver_shadedgb;
-  is_receiver_shadedgb_last = clone_phenotype.is_receiver_shadedgb_last;
-  is_receiver_gb_same_locus = clone_phenotype.is_receiver_gb_same_locus;
   
   is_modifier   = false;
   is_modified   = false;
@@ -1459,13 +1071,7 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   make_random_resource = false;
   to_die = false;
   to_delete = false;
-  is_energy_requestor = false;
-  is_energy_donor = false;
-  is_energy_receiver = false;
-  has_used_donated_energy = false;
-  has_open_energy_request = false;
-  kaboom_executed = false;
-  kaboom_executed2 = false;
+  if (m_energy_sharing) m_energy_sharing->Reset(true, false);
   
   // Setup child info...
   copy_true          = false;
@@ -1491,7 +1097,7 @@ bool cPhenotype::TestInput(tBuffer<int>&, tBuffer<int>&)
 }
 
 bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
-                            const Apto::Array<double>& res_in, const Apto::Array<double>& rbins_in,
+                            const cResourceView& res_in, const Apto::Array<double>& rbins_in,
                             Apto::Array<double>& res_change, Apto::Array<cString>& insts_triggered,
                             bool is_parasite, cContextPhenotype* context_phenotype)
 {
@@ -1542,7 +1148,7 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
       
       // Update parasite/host task tracking appropriately
       if (is_parasite) {
-        cur_para_tasks[i]++;
+        parasite().cur_para_tasks[i]++;
       }
       else {
         cur_host_tasks[i]++;
@@ -1694,7 +1300,7 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
   //Put in detected resources
   for (int j = 0; j < res_in.GetSize(); j++) {
     if(result.GetDetected(j) != -1.0) {
-      sensed_resources[j] = result.GetDetected(j);
+      sensing().sensed_resources[j] = result.GetDetected(j);
     }
   }
   
@@ -1867,23 +1473,25 @@ int cPhenotype::CalcToleranceImmigrants()
   const int cur_update = m_world->GetStats().GetUpdate();
   const int tolerance_max = m_world->GetConfig().MAX_TOLERANCE.Get();
 
+  sToleranceState& tol = tolerance();
+
   // Check if cached value is up-to-date, return
-  if (m_intolerances[0].first == cur_update) return tolerance_max - m_intolerances[0].second;
+  if (tol.intolerances[0].first == cur_update) return tolerance_max - tol.intolerances[0].second;
   
   const int update_window = m_world->GetConfig().TOLERANCE_WINDOW.Get();
   // Update the tolerance list by getting rid of outdated records
-  while (m_tolerance_immigrants.GetSize() && *m_tolerance_immigrants.GetLast() < cur_update - update_window)
-    delete m_tolerance_immigrants.PopRear();
+  while (tol.immigrants.GetSize() && *tol.immigrants.GetLast() < cur_update - update_window)
+    delete tol.immigrants.PopRear();
   
   // And prune the list down to MAX_TOLERANCE entries.
-  while (m_tolerance_immigrants.GetSize() > tolerance_max)
-    delete m_tolerance_immigrants.PopRear();
+  while (tol.immigrants.GetSize() > tolerance_max)
+    delete tol.immigrants.PopRear();
 
-  const int tolerance = tolerance_max - m_tolerance_immigrants.GetSize();
+  const int tolerance = tolerance_max - tol.immigrants.GetSize();
 
   // Update cached values
-  m_intolerances[0].first = cur_update;
-  m_intolerances[0].second = m_tolerance_immigrants.GetSize();
+  tol.intolerances[0].first = cur_update;
+  tol.intolerances[0].second = tol.immigrants.GetSize();
   return tolerance;
 }
 
@@ -1898,24 +1506,26 @@ int cPhenotype::CalcToleranceOffspringOwn()
   // If offspring tolerances off, skip calculations returning max
   if (m_world->GetConfig().TOLERANCE_VARIATIONS.Get() > 0) return tolerance_max;
 
+  sToleranceState& tol = tolerance();
+
   // Check if cached value is up-to-date, return
-  if (m_intolerances[1].first == cur_update) return tolerance_max - m_intolerances[1].second;
+  if (tol.intolerances[1].first == cur_update) return tolerance_max - tol.intolerances[1].second;
 
   const int update_window = m_world->GetConfig().TOLERANCE_WINDOW.Get();
   
   // Update the tolerance list by getting rid of outdated records
-  while (m_tolerance_offspring_own.GetSize() && *m_tolerance_offspring_own.GetLast() < cur_update - update_window)
-    delete m_tolerance_offspring_own.PopRear();
+  while (tol.offspring_own.GetSize() && *tol.offspring_own.GetLast() < cur_update - update_window)
+    delete tol.offspring_own.PopRear();
   
   // And prune the list down to MAX_TOLERANCE entries.
-  while (m_tolerance_offspring_own.GetSize() > tolerance_max)
-    delete m_tolerance_offspring_own.PopRear();
+  while (tol.offspring_own.GetSize() > tolerance_max)
+    delete tol.offspring_own.PopRear();
   
-  const int tolerance = tolerance_max - m_tolerance_offspring_own.GetSize();
+  const int tolerance = tolerance_max - tol.offspring_own.GetSize();
 
   // Update cached values
-  m_intolerances[1].first = cur_update;
-  m_intolerances[1].second = m_tolerance_offspring_own.GetSize();
+  tol.intolerances[1].first = cur_update;
+  tol.intolerances[1].second = tol.offspring_own.GetSize();
   return tolerance;
 }
 
@@ -1930,29 +1540,32 @@ int cPhenotype::CalcToleranceOffspringOthers()
   // If offspring tolerances off, skip calculations returning max
   if (m_world->GetConfig().TOLERANCE_VARIATIONS.Get() > 0) return tolerance_max;
 
+  sToleranceState& tol = tolerance();
+
   // Check if cached value is up-to-date, return
-  if (m_intolerances[2].first == cur_update) return tolerance_max - m_intolerances[2].second;
+  if (tol.intolerances[2].first == cur_update) return tolerance_max - tol.intolerances[2].second;
 
   const int update_window = m_world->GetConfig().TOLERANCE_WINDOW.Get();  
   
   // Update the tolerance list by getting rid of outdated records
-  while (m_tolerance_offspring_others.GetSize() && *m_tolerance_offspring_others.GetLast() < cur_update - update_window) 
-    delete m_tolerance_offspring_others.PopRear();
+  while (tol.offspring_others.GetSize() && *tol.offspring_others.GetLast() < cur_update - update_window) 
+    delete tol.offspring_others.PopRear();
   
   // And prune the list down to MAX_TOLERANCE entries.
-  while (m_tolerance_offspring_others.GetSize() > tolerance_max)
-    delete m_tolerance_offspring_others.PopRear();
+  while (tol.offspring_others.GetSize() > tolerance_max)
+    delete tol.offspring_others.PopRear();
 
-  const int tolerance = tolerance_max - m_tolerance_offspring_others.GetSize();
+  const int tolerance = tolerance_max - tol.offspring_others.GetSize();
 
   // Update cached values
-  m_intolerances[2].first = cur_update;
-  m_intolerances[2].second = m_tolerance_offspring_others.GetSize();
+  tol.intolerances[2].first = cur_update;
+  tol.intolerances[2].second = tol.offspring_others.GetSize();
   return tolerance;
 }
 
 void cPhenotype::IncAttackedPreyFTData(int target_ft) {
   Apto::Array<int> target_list = m_world->GetEnvironment().GetAttackPreyFTList();
+  Apto::Array<int>& cur_killed_targets = attack().cur_killed_targets;
   if (!cur_killed_targets.GetSize()) {
     cur_killed_targets.Resize(target_list.GetSize());
     cur_killed_targets.SetAll(0);
@@ -2147,7 +1760,6 @@ void cPhenotype::NewTrial()
   last_num_donates          = cur_num_donates;
   last_task_count           = cur_task_count;
   last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
   last_internal_task_count  = cur_internal_task_count;
   last_task_quality         = cur_task_quality;
   last_internal_task_quality= cur_internal_task_quality;
@@ -2158,14 +1770,7 @@ void cPhenotype::NewTrial()
   last_reaction_count       = cur_reaction_count;
   last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
-  last_from_sensor_count    = cur_from_sensor_count;
   last_from_message_count    = cur_from_message_count;
-  last_group_attack_count   = cur_group_attack_count;
-  last_killed_targets       = cur_killed_targets;
-  last_attacks              = cur_attacks;
-  last_kills                = cur_kills;
-  last_top_pred_group_attack_count    = cur_top_pred_group_attack_count;
-  last_sense_count          = cur_sense_count;
   
   // Reset cur values.
   cur_bonus       = m_world->GetConfig().DEFAULT_BONUS.Get();
@@ -2175,7 +1780,7 @@ void cPhenotype::NewTrial()
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
   cur_host_tasks.SetAll(0);
-  cur_para_tasks.SetAll(0);
+  if (m_parasite) m_parasite->DivideReset();
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
   cur_task_quality.SetAll(0);
@@ -2190,23 +1795,13 @@ void cPhenotype::NewTrial()
   cur_stolen_reaction_count.SetAll(0);
   cur_reaction_add_reward.SetAll(0);
   cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
   cur_from_message_count.SetAll(0);
-  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
-    cur_group_attack_count[r].SetAll(0);
-    cur_top_pred_group_attack_count[r].SetAll(0);
-  }
-  cur_killed_targets.SetAll(0);
-  cur_attacks = 0;
-  cur_kills = 0;
-  cur_sense_count.SetAll(0);
+  if (m_sensing) m_sensing->DivideReset();
+  if (m_attack) m_attack->DivideReset();
   //cur_trial_fitnesses.Resize(0); Don't throw out the trial fitnesses! @JEB
   trial_time_used = 0;
   trial_cpu_cycles_used = 0;
-  m_tolerance_immigrants.Clear();        
-  m_tolerance_offspring_own.Clear();     
-  m_tolerance_offspring_others.Clear();  
-  m_intolerances.SetAll(make_pair(-1, -1));  
+  if (m_tolerance) m_tolerance->Reset();
   
   // Setup other miscellaneous values...
   num_divides++;
@@ -2219,63 +1814,13 @@ void cPhenotype::NewTrial()
   life_fitness = fitness; 
   
   
-  num_thresh_gb_donations_last = num_thresh_gb_donations;
-  num_thresh_gb_donations = 0;
-  num_quanta_thresh_gb_donations_last = num_quanta_thresh_gb_donations;
-  num_quanta_thresh_gb_donations = 0;
-  num_shaded_gb_donations_last = num_shaded_gb_donations;
-  num_shaded_gb_donations = 0;
-  num_donations_locus_last = num_donations_locus;
-  num_donations_locus = 0;
+  if (m_donation) m_donation->DivideReset();
 	
   // Leave flags alone...
   (void) is_injected;
   (void) is_clone;
-  is_donor_last = is_donor_cur;
-  is_donor_cur = false;
-  is_donor_rand_last = is_donor_rand;
-  is_donor_rand = false;
-  is_donor_null_last = is_donor_null;
-  is_donor_null = false;
-  is_donor_kin_last = is_donor_kin;
-  is_donor_kin = false;
-  is_donor_edit_last = is_donor_edit;
-  is_donor_edit = false;
-  is_donor_gbg_last = is_donor_gbg;
-  is_donor_gbg = false;
-  is_donor_truegb_last = is_donor_truegb;
-  is_donor_truegb = false;
-  is_donor_threshgb_last = is_donor_threshgb;
-  is_donor_threshgb = false;
-  is_donor_quanta_threshgb_last = is_donor_quanta_threshgb;
-  is_donor_quanta_threshgb = false;
-  is_donor_shadedgb_last = is_donor_shadedgb;
-  is_donor_shadedgb = false;
-  is_donor_locus_last = is_donor_locus;
-  is_donor_locus.SetAll(false);
-  
-  is_receiver_last = is_receiver;
-  is_receiver = false;
-  is_receiver_rand = false;
-  is_receiver_kin_last = is_receiver_kin;
-  is_receiver_kin = false;
-  is_receiver_edit_last = is_receiver_edit;
-  is_receiver_edit = false;
-  is_receiver_gbg = false;
-  is_receiver_truegb_last = is_receiver_truegb;
-  is_receiver_truegb = false;
-  is_receiver_threshgb_last = is_receiver_threshgb;
-  is_receiver_threshgb = false;
-  is_receiver_quanta_threshgb_last = is_receiver_quanta_threshgb;
-  is_receiver_quanta_threshgb = false;
-  is_receiver_shadedgb_last = is_receiver_shadedgb;
-  is_receiver_shadedgb = false;
-  is_receiver_gb_same_locus_last = is_receiver_gb_same_locus;
-  is_receiver_gb_same_locus = false;
   
-  is_energy_requestor = false;
-  is_energy_donor = false;
-  is_energy_receiver = false;
+  if (m_energy_sharing) m_energy_sharing->Reset(false, false);
   (void) is_modifier;
   (void) is_modified;
   (void) is_fertile;
@@ -2284,8 +1829,6 @@ void cPhenotype::NewTrial()
   (void) parent_true;
   (void) parent_sex;
   (void) parent_cross_num;
-  (void) kaboom_executed;
-  (void) kaboom_executed2;
 }
 
 /**
@@ -2335,12 +1878,7 @@ void cPhenotype::TrialDivideReset(const InstructionSequence& _genome)
     neutral_metric += m_world->GetRandom().GetRandNormal();
   }
   
-  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {
-    m_tolerance_immigrants.Clear();        
-    m_tolerance_offspring_own.Clear();     
-    m_tolerance_offspring_others.Clear();  
-    m_intolerances.SetAll(make_pair(-1,-1));  
-  }
+  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT && m_tolerance) m_tolerance->Reset();
 
   if (m_world->GetConfig().GENERATION_INC_METHOD.Get() == GENERATION_INC_BOTH) generation++;
 }
@@ -2424,12 +1962,23 @@ void cPhenotype::SetLastParasiteTaskCount(Apto::Array<int> oldParaPhenotype)
 {
   assert(initialized == true);
   
+  Apto::Array<int>& last_para_tasks = parasite().last_para_tasks;
   for(int i=0;i<oldParaPhenotype.GetSize();i++)
   {
     last_para_tasks[i] = oldParaPhenotype[i];
   }
 }
 
+Apto::Array<int> cPhenotype::GetLastParasiteTaskCount() const
+{
+  assert(initialized == true);
+  if (m_parasite) return m_parasite->last_para_tasks;
+  
+  Apto::Array<int> last_para_tasks(m_world->GetEnvironment().GetNumTasks());
+  last_para_tasks.SetAll(0);
+  return last_para_tasks;
+}
+
 /* Return the cumulative reaction count if we aren't resetting on divide. */
 Apto::Array<int> cPhenotype::GetCumulativeReactionCount()
 { 
@@ -2445,3 +1994,353 @@ Apto::Array<int> cPhenotype::GetCumulativeReactionCount()
     return cur_reaction_count;
   }
 }
+
+
+cPhenotype::sToleranceState& cPhenotype::tolerance()
+{
+  if (!m_tolerance) m_tolerance = new sToleranceState((m_world->GetConfig().TOLERANCE_VARIATIONS.Get() > 0) ? 1 : 3);
+  return *m_tolerance;
+}
+
+cPhenotype::sSensingState& cPhenotype::sensing()
+{
+  if (!m_sensing) {
+    m_sensing = new sSensingState(m_world->GetStats().GetSenseSize(), m_world->GetEnvironment().GetResourceLib().GetSize(),
+                                  cur_inst_count.GetSize());
+  }
+  return *m_sensing;
+}
+
+cPhenotype::sParasiteState& cPhenotype::parasite()
+{
+  if (!m_parasite) m_parasite = new sParasiteState(m_world->GetEnvironment().GetNumTasks());
+  return *m_parasite;
+}
+
+tList<int>& cPhenotype::GetToleranceImmigrants() { assert(initialized == true); return tolerance().immigrants; }
+tList<int>& cPhenotype::GetToleranceOffspringOwn() { assert(initialized == true); return tolerance().offspring_own; }
+tList<int>& cPhenotype::GetToleranceOffspringOthers() { assert(initialized == true); return tolerance().offspring_others; }
+Apto::Array<pair<int,int> >& cPhenotype::GetIntolerances() { assert(initialized == true); return tolerance().intolerances; }
+
+
+cPhenotype::sSensingState::sSensingState(int num_sense, int num_resources, int num_inst)
+  : cur_sense_count(num_sense), last_sense_count(num_sense), sensed_resources(num_resources)
+  , cur_from_sensor_count(num_inst), last_from_sensor_count(num_inst)
+{
+  cur_sense_count.SetAll(0);
+  last_sense_count.SetAll(0);
+  sensed_resources.SetAll(0.0);
+  cur_from_sensor_count.SetAll(0);
+  last_from_sensor_count.SetAll(0);
+}
+
+void cPhenotype::sSensingState::DivideReset()
+{
+  last_sense_count = cur_sense_count;
+  cur_sense_count.SetAll(0);
+  last_from_sensor_count = cur_from_sensor_count;
+  cur_from_sensor_count.SetAll(0);
+}
+
+void cPhenotype::sSensingState::SetupOffspring(const sSensingState& parent)
+{
+  cur_sense_count.SetAll(0);
+  cur_from_sensor_count.SetAll(0);
+  last_sense_count = parent.last_sense_count;
+  last_from_sensor_count = parent.last_from_sensor_count;
+  sensed_resources = parent.sensed_resources;
+}
+
+
+cPhenotype::sParasiteState::sParasiteState(int num_tasks) : cur_para_tasks(num_tasks), last_para_tasks(num_tasks)
+{
+  cur_para_tasks.SetAll(0);
+  last_para_tasks.SetAll(0);
+}
+
+void cPhenotype::sParasiteState::DivideReset()
+{
+  last_para_tasks = cur_para_tasks;
+  cur_para_tasks.SetAll(0);
+}
+
+void cPhenotype::sParasiteState::SetupOffspring(const sParasiteState& parent)
+{
+  cur_para_tasks.SetAll(0);
+  last_para_tasks = parent.last_para_tasks;
+}
+
+
+cPhenotype::sAttackState::sAttackState(int num_group_attack_inst)
+  : cur_attacks(0), cur_kills(0), last_attacks(0), last_kills(0), kaboom_executed(false), kaboom_executed2(false)
+{
+  SetGroupAttackInstSetSize(num_group_attack_inst);
+}
+
+void cPhenotype::sAttackState::SetGroupAttackInstSetSize(int num_group_attack_inst)
+{
+  last_group_attack_count.Resize(num_group_attack_inst);
+  last_top_pred_group_attack_count.Resize(num_group_attack_inst);
+  cur_group_attack_count.Resize(num_group_attack_inst);
+  cur_top_pred_group_attack_count.Resize(num_group_attack_inst);
+  for (int i = 0; i < last_group_attack_count.GetSize(); i++) {
+    last_group_attack_count[i].Resize(NUM_GROUP_ATTACK_PACK_SIZES, 0);
+    last_top_pred_group_attack_count[i].Resize(NUM_GROUP_ATTACK_PACK_SIZES, 0);
+    cur_group_attack_count[i].Resize(NUM_GROUP_ATTACK_PACK_SIZES, 0);
+    cur_top_pred_group_attack_count[i].Resize(NUM_GROUP_ATTACK_PACK_SIZES, 0);
+  }
+}
+
+// Lock in the current attack records as the last ones, explosions stay recorded (see DivideReset)
+void cPhenotype::sAttackState::DivideReset()
+{
+  last_group_attack_count = cur_group_attack_count;
+  last_top_pred_group_attack_count = cur_top_pred_group_attack_count;
+  last_killed_targets = cur_killed_targets;
+  last_attacks = cur_attacks;
+  last_kills = cur_kills;
+  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
+    cur_group_attack_count[r].SetAll(0);
+    cur_top_pred_group_attack_count[r].SetAll(0);
+  }
+  cur_killed_targets.SetAll(0);
+  cur_attacks = 0;
+  cur_kills = 0;
+}
+
+void cPhenotype::sAttackState::SetupOffspring(const sAttackState& parent)
+{
+  for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
+    cur_group_attack_count[r].SetAll(0);
+    cur_top_pred_group_attack_count[r].SetAll(0);
+  }
+  cur_killed_targets.SetAll(0);
+  cur_attacks = 0;
+  cur_kills = 0;
+  last_group_attack_count = parent.last_group_attack_count;
+  last_top_pred_group_attack_count = parent.last_top_pred_group_attack_count;
+  last_killed_targets = parent.last_killed_targets;
+  last_attacks = parent.last_attacks;
+  last_kills = parent.last_kills;
+  kaboom_executed = false;
+  kaboom_executed2 = false;
+}
+
+
+cPhenotype::sMatingState::sMatingState()
+  : mating_type(MATING_TYPE_JUVENILE), mate_preference(MATE_PREFERENCE_RANDOM)
+  , cur_mating_display_a(0), cur_mating_display_b(0), last_mating_display_a(0), last_mating_display_b(0)
+{
+}
+
+
+cPhenotype::sEnergySharingState::sEnergySharingState()
+  : is_energy_requestor(false), is_energy_donor(false), is_energy_receiver(false)
+  , has_used_donated_energy(false), has_open_energy_request(false)
+  , total_energy_donated(0.0), total_energy_received(0.0), total_energy_applied(0.0)
+  , num_energy_requests(0), num_energy_donations(0), num_energy_receptions(0), num_energy_applications(0)
+{
+}
+
+
+void cPhenotype::sEnergySharingState::Reset(bool clear_requests, bool clear_totals)
+{
+  is_energy_requestor = false;
+  is_energy_donor = false;
+  is_energy_receiver = false;
+  if (clear_requests) {
+    has_used_donated_energy = false;
+    has_open_energy_request = false;
+  }
+  if (clear_totals) {
+    total_energy_donated = 0.0;
+    total_energy_received = 0.0;
+    total_energy_applied = 0.0;
+  }
+}
+
+
+cPhenotype::sDonationState::sDonationState()
+  : is_donor_cur(false), is_donor_last(false), is_donor_rand(false), is_donor_rand_last(false)
+  , is_donor_null(false), is_donor_null_last(false), is_donor_kin(false), is_donor_kin_last(false)
+  , is_donor_edit(false), is_donor_edit_last(false), is_donor_gbg(false), is_donor_gbg_last(false)
+  , is_donor_truegb(false), is_donor_truegb_last(false), is_donor_threshgb(false), is_donor_threshgb_last(false)
+  , is_donor_quanta_threshgb(false), is_donor_quanta_threshgb_last(false)
+  , is_donor_shadedgb(false), is_donor_shadedgb_last(false)
+  , num_thresh_gb_donations(0), num_thresh_gb_donations_last(0)
+  , num_quanta_thresh_gb_donations(0), num_quanta_thresh_gb_donations_last(0)
+  , num_shaded_gb_donations(0), num_shaded_gb_donations_last(0)
+  , num_donations_locus(0), num_donations_locus_last(0)
+  , is_receiver(false), is_receiver_last(false), is_receiver_rand(false)
+  , is_receiver_kin(false), is_receiver_kin_last(false), is_receiver_edit(false), is_receiver_edit_last(false)
+  , is_receiver_gbg(false), is_receiver_truegb(false), is_receiver_truegb_last(false)
+  , is_receiver_threshgb(false), is_receiver_threshgb_last(false)
+  , is_receiver_quanta_threshgb(false), is_receiver_quanta_threshgb_last(false)
+  , is_receiver_shadedgb(false), is_receiver_shadedgb_last(false)
+  , is_receiver_gb_same_locus(false), is_receiver_gb_same_locus_last(false)
+{
+}
+
+// Lock in the current donation records as the last ones (see DivideReset)
+void cPhenotype::sDonationState::DivideReset()
+{
+  num_thresh_gb_donations_last = num_thresh_gb_donations;
+  num_thresh_gb_donations = 0;
+  num_quanta_thresh_gb_donations_last = num_quanta_thresh_gb_donations;
+  num_quanta_thresh_gb_donations = 0;
+  num_shaded_gb_donations_last = num_shaded_gb_donations;
+  num_shaded_gb_donations = 0;
+  num_donations_locus_last = num_donations_locus;
+  num_donations_locus = 0;
+
+  is_donor_last = is_donor_cur;
+  is_donor_cur = false;
+  is_donor_rand_last = is_donor_rand;
+  is_donor_rand = false;
+  is_donor_null_last = is_donor_null;
+  is_donor_null = false;
+  is_donor_kin_last = is_donor_kin;
+  is_donor_kin = false;
+  is_donor_edit_last = is_donor_edit;
+  is_donor_edit = false;
+  is_donor_gbg_last = is_donor_gbg;
+  is_donor_gbg = false;
+  is_donor_truegb_last = is_donor_truegb;
+  is_donor_truegb = false;
+  is_donor_threshgb_last = is_donor_threshgb;
+  is_donor_threshgb = false;
+  is_donor_quanta_threshgb_last = is_donor_quanta_threshgb;
+  is_donor_quanta_threshgb = false;
+  is_donor_shadedgb_last = is_donor_shadedgb;
+  is_donor_shadedgb = false;
+  is_donor_locus_last = is_donor_locus;
+  is_donor_locus.SetAll(false);
+
+  is_receiver_last = is_receiver;
+  is_receiver = false;
+  is_receiver_rand = false;
+  is_receiver_kin_last = is_receiver_kin;
+  is_receiver_kin = false;
+  is_receiver_edit_last = is_receiver_edit;
+  is_receiver_edit = false;
+  is_receiver_gbg = false;
+  is_receiver_truegb_last = is_receiver_truegb;
+  is_receiver_truegb = false;
+  is_receiver_threshgb_last = is_receiver_threshgb;
+  is_receiver_threshgb = false;
+  is_receiver_quanta_threshgb_last = is_receiver_quanta_threshgb;
+  is_receiver_quanta_threshgb = false;
+  is_receiver_shadedgb_last = is_receiver_shadedgb;
+  is_receiver_shadedgb = false;
+  is_receiver_gb_same_locus_last = is_receiver_gb_same_locus;
+  is_receiver_gb_same_locus = false;
+}
+
+// Offspring start with clear donation records, inheriting the parent's last ones (see SetupOffspring)
+void cPhenotype::sDonationState::SetupOffspring(const sDonationState& parent)
+{
+  num_thresh_gb_donations = 0;
+  num_thresh_gb_donations_last = parent.num_thresh_gb_donations_last;
+  num_quanta_thresh_gb_donations = 0;
+  num_quanta_thresh_gb_donations_last = parent.num_thresh_gb_donations_last;
+  num_shaded_gb_donations = 0;
+  num_shaded_gb_donations_last = parent.num_shaded_gb_donations_last;
+  num_donations_locus = 0;
+  num_donations_locus_last = parent.num_donations_locus_last;
+
+  is_donor_cur  = false;
+  is_donor_last = parent.is_donor_last;
+  is_donor_rand = false;
+  is_donor_rand_last = parent.is_donor_rand_last;
+  is_donor_null = false;
+  is_donor_null_last = parent.is_donor_null_last;
+  is_donor_kin  = false;
+  is_donor_kin_last = parent.is_donor_kin_last;
+  is_donor_edit  = false;
+  is_donor_edit_last = parent.is_donor_edit_last;
+  is_donor_gbg  = false;
+  is_donor_gbg_last = parent.is_donor_gbg_last;
+  is_donor_truegb  = false;
+  is_donor_truegb_last = parent.is_donor_truegb_last;
+  is_donor_threshgb  = false;
+  is_donor_threshgb_last = parent.is_donor_threshgb_last;
+  is_donor_quanta_threshgb  = false;
+  is_donor_quanta_threshgb_last = parent.is_donor_quanta_threshgb_last;
+  is_donor_shadedgb  = false;
+  is_donor_shadedgb_last = parent.is_donor_shadedgb_last;
+  is_donor_locus.SetAll(false);
+  is_donor_locus_last = parent.is_donor_locus_last;
+
+  is_receiver   = false;
+  is_receiver_last = parent.is_receiver_last;
+  is_receiver_rand   = false;
+  is_receiver_kin    = false;
+  is_receiver_kin_last    = parent.is_receiver_kin_last;
+  is_receiver_edit   = false;
+  is_receiver_edit_last    = parent.is_receiver_edit_last;
+  is_receiver_gbg    = false;
+  is_receiver_truegb = false;
+  is_receiver_truegb_last = parent.is_receiver_truegb_last;
+  is_receiver_threshgb = false;
+  is_receiver_threshgb_last = parent.is_receiver_threshgb_last;
+  is_receiver_quanta_threshgb = false;
+  is_receiver_quanta_threshgb_last = parent.is_receiver_quanta_threshgb_last;
+  is_receiver_shadedgb = false;
+  is_receiver_shadedgb_last = parent.is_receiver_shadedgb_last;
+  is_receiver_gb_same_locus = false;
+  is_receiver_gb_same_locus_last = parent.is_receiver_gb_same_locus;
+}
+
+// Clones carry over all donation records (see SetupClone)
+void cPhenotype::sDonationState::SetupClone(const sDonationState& clone)
+{
+  num_thresh_gb_donations_last = clone.num_thresh_gb_donations_last;
+  num_thresh_gb_donations  = clone.num_thresh_gb_donations;
+  num_quanta_thresh_gb_donations_last = clone.num_quanta_thresh_gb_donations_last;
+  num_quanta_thresh_gb_donations  = clone.num_quanta_thresh_gb_donations;
+  num_shaded_gb_donations_last = clone.num_shaded_gb_donations_last;
+  num_shaded_gb_donations  = clone.num_shaded_gb_donations;
+  num_donations_locus = clone.num_donations_locus;
+  num_donations_locus_last = clone.num_donations_locus_last;
+
+  is_donor_last = clone.is_donor_last;
+  is_donor_cur  = clone.is_donor_cur;
+  is_donor_rand_last = clone.is_donor_rand_last;
+  is_donor_rand  = clone.is_donor_rand;
+  is_donor_null_last = clone.is_donor_null_last;
+  is_donor_null  = clone.is_donor_null;
+  is_donor_kin_last = clone.is_donor_kin_last;
+  is_donor_kin  = clone.is_donor_kin;
+  is_donor_edit_last = clone.is_donor_edit_last;
+  is_donor_edit  = clone.is_donor_edit;
+  is_donor_gbg_last = clone.is_donor_gbg_last;
+  is_donor_gbg  = clone.is_donor_gbg;
+  is_donor_truegb_last = clone.is_donor_truegb_last;
+  is_donor_truegb  = clone.is_donor_truegb;
+  is_donor_threshgb_last = clone.is_donor_threshgb_last;
+  is_donor_threshgb  = clone.is_donor_threshgb;
+  is_donor_quanta_threshgb_last = clone.is_donor_quanta_threshgb_last;
+  is_donor_quanta_threshgb  = clone.is_donor_quanta_threshgb;
+  is_donor_shadedgb_last = clone.is_donor_shadedgb_last;
+  is_donor_shadedgb  = clone.is_donor_shadedgb;
+  is_donor_locus_last = clone.is_donor_locus_last;
+  is_donor_locus = clone.is_donor_locus;
+
+  is_receiver = clone.is_receiver;
+  is_receiver_last = clone.is_receiver_last;
+  is_receiver_rand = clone.is_receiver_rand;
+  is_receiver_kin = clone.is_receiver_kin;
+  is_receiver_kin_last = clone.is_receiver_kin_last;
+  is_receiver_edit = clone.is_receiver_edit;
+  is_receiver_edit_last = clone.is_receiver_edit_last;
+  is_receiver_gbg = clone.is_receiver_gbg;
+  is_receiver_truegb = clone.is_receiver_truegb;
+  is_receiver_truegb_last = clone.is_receiver_truegb_last;
+  is_receiver_threshgb = clone.is_receiver_threshgb;
+  is_receiver_threshgb_last = clone.is_receiver_threshgb_last;
+  is_receiver_quanta_threshgb = clone.is_receiver_quanta_threshgb;
+  is_receiver_quanta_threshgb_last = clone.is_receiver_quanta_threshgb_last;
+  is_receiver_shadedgb = clone.is_receiver_shadedgb;
+  is_receiver_shadedgb_last = clone.is_receiver_shadedgb_last;
+  is_receiver_gb_same_locus = clone.is_receiver_gb_same_locus;
+}
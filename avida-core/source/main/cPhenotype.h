@@ -68,6 +68,7 @@ class cTaskContext;
 class cTaskState;
 class cPhenPlastSummary;
 class cReactionResult;
+class cResourceView;
 
 using namespace Avida;
 
@@ -79,38 +80,41 @@ private:
   cWorld* m_world;
   bool initialized;
 
-  // 1. These are values calculated at the last divide (of self or offspring)
+  // 0. Hot state, read or updated on every executed instruction and every divide.  Kept together at the front of the
+  //    object so that it shares as few cache lines as possible; see section 1 to 4 for the matching values.
   cMerit merit;             // Relative speed of CPU
   double executionRatio;    //  ratio of current execution merit over base execution merit
+  double cur_bonus;         // Current Bonus
+  int gestation_time;       // CPU cycles to produce offspring (or be produced),
+                            // including additional time costs of some instructions.
+  int gestation_start;      // Total instructions executed at last divide.
+  int cpu_cycles_used;      // Total CPU cycles consumed. @JEB
+  int time_used;            // Total CPU cycles consumed, including additional time costs of some instructions.
+  int num_execs;            // Total number of instructions executions attempted...accounts for parallel executions in multi-threaded orgs & corrects for cpu-cost 'pauses'
+  int age;                  // Number of updates organism has survived for.
+  int trial_time_used;      // like time_used, but reset every trial; @JEB
+  int trial_cpu_cycles_used;  // like cpu_cycles_used, but reset every trial; @JEB
+  Apto::Array<int> cur_task_count;      // Total times each task was performed
+  Apto::Array<int> cur_reaction_count;  // Total times each reaction was triggered.
+  Apto::Array<int> cur_inst_count;      // Instruction exection counter
+
+  // 1. These are values calculated at the last divide (of self or offspring)
   double energy_store;      // Amount of energy.  Determines relative speed of CPU when turned on.
   int genome_length;        // Number of instructions in genome.
   int bonus_instruction_count; // Number of times MERIT_BONUS_INT is in genome.
   int copied_size;          // Instructions copied into genome.
   int executed_size;        // Instructions executed from genome.
-  int gestation_time;       // CPU cycles to produce offspring (or be produced),
-                            // including additional time costs of some instructions.
-  int gestation_start;      // Total instructions executed at last divide.
   double fitness;           // Relative effective replication rate...
   double div_type;          // Type of the divide command used
 
   // 2. These are "in progress" variables, updated as the organism operates
-  double cur_bonus;                           // Current Bonus
   double cur_energy_bonus;                    // Current energy bonus
   double energy_tobe_applied;                 // Energy that has not yet been added to energy store.
   double energy_testament;
   double energy_received_buffer;              // Energy received through donation, but not yet applied to energy store
-  double total_energy_donated;                // Tota amount of energy that has been donated
-  double total_energy_received;               // Total amount of energy received through donations
-  double total_energy_applied;                // Total amount of received energy applied to energy store
-  int num_energy_requests;                    // Number of times organism has requested energy
-  int num_energy_donations;                   // Number of times energy has been donated
-  int num_energy_receptions;                  // Number of times organism has received energy donations
-  int num_energy_applications;                // Number of times organism has applied donated energy to its energy store
   int cur_num_errors;                         // Total instructions executed illeagally.
   int cur_num_donates;                        // Number of donations so far
 
-  Apto::Array<int> cur_task_count;                 // Total times each task was performed
-  Apto::Array<int> cur_para_tasks;                 // Total times each task was performed by the parasite @LZ
   Apto::Array<int> cur_host_tasks;                 // Total times each task was done by JUST the host @LZ
   Apto::Array<int> cur_internal_task_count;        // Total times each task was performed using internal resources
   Apto::Array<int> eff_task_count;                 // Total times each task was performed (resetable during the life of the organism)
@@ -120,21 +124,11 @@ private:
   Apto::Array<double> cur_rbins_total;             // Total amount of resources collected over the organism's life
   Apto::Array<double> cur_rbins_avail;             // Amount of internal resources available
   Apto::Array<int> cur_collect_spec_counts;        // How many times each nop-specification was used in a collect-type instruction
-  Apto::Array<int> cur_reaction_count;             // Total times each reaction was triggered.
   Apto::Array<int> first_reaction_cycles;          // CPU cycles of first time reaction was triggered.
   Apto::Array<int> first_reaction_execs;            // Execution count at first time reaction was triggered (will be > cycles in parallel exec multithreaded orgs).
   Apto::Array<int> cur_stolen_reaction_count;      // Total counts of reactions stolen by predators.
   Apto::Array<double> cur_reaction_add_reward;     // Bonus change from triggering each reaction.
-  Apto::Array<int> cur_inst_count;                 // Instruction exection counter
-  Apto::Array<int> cur_from_sensor_count;           // Use of inputs that originated from sensory data were used in execution of this instruction.
-  Apto::Array< Apto::Array<int> > cur_group_attack_count;
-  Apto::Array< Apto::Array<int> > cur_top_pred_group_attack_count;
-  Apto::Array<int> cur_killed_targets;
-  int cur_attacks;
-  int cur_kills;
   
-  Apto::Array<int> cur_sense_count;                // Total times resource combinations have been sensed; @JEB
-  Apto::Array<double> sensed_resources;            // Resources which the organism has sensed; @JEB
   Apto::Array<double> cur_task_time;               // Time at which each task was last performed; WRE 03-18-07
   Apto::Map<void*, cTaskState*> m_task_states;
   Apto::Array<double> cur_trial_fitnesses;         // Fitnesses of various trials.; @JEB
@@ -142,20 +136,8 @@ private:
   Apto::Array<int> cur_trial_times_used;           // Time used in of various trials.; @JEB
   Apto::Array<int> cur_from_message_count;           // Use of inputs that originated from messages were used in execution of this instruction.
 
-  int trial_time_used;                        // like time_used, but reset every trial; @JEB
-  int trial_cpu_cycles_used;                  // like cpu_cycles_used, but reset every trial; @JEB
-  tList<int> m_tolerance_immigrants;           // record of previous updates tolerance has been decreased towards immigrants 
-  tList<int> m_tolerance_offspring_own;        // record of previous updates tolerance has been decreased towards org's own offspring 
-  tList<int> m_tolerance_offspring_others;     // record of previous updates tolerance has been decreased towards other offspring in group 
-  Apto::Array<pair<int,int> > m_intolerances;        // caches temporary values of the intolerance and the update
   double last_child_germline_propensity;   // chance of child being a germline cell; @JEB
 
-  int mating_type;                            // Organism's phenotypic sex @CHC
-  int mate_preference;                        // Organism's mating preference @CHC
-  
-  int cur_mating_display_a;                   // value of organism's current mating display A trait
-  int cur_mating_display_b;                   // value of organism's current mating display B trait
-
   cReactionResult* m_reaction_result;
   
 
@@ -168,7 +150,6 @@ private:
   int last_num_donates;
 
   Apto::Array<int> last_task_count;
-  Apto::Array<int> last_para_tasks;
   Apto::Array<int> last_host_tasks;                // Last task counts from hosts only, before last divide @LZ
   Apto::Array<int> last_internal_task_count;
   Apto::Array<double> last_task_quality;
@@ -180,13 +161,6 @@ private:
   Apto::Array<int> last_reaction_count;
   Apto::Array<double> last_reaction_add_reward;
   Apto::Array<int> last_inst_count;	  // Instruction exection counter
-  Apto::Array<int> last_from_sensor_count;
-  Apto::Array<int> last_sense_count;   // Total times resource combinations have been sensed; @JEB
-  Apto::Array< Apto::Array<int> > last_group_attack_count;
-  Apto::Array< Apto::Array<int> > last_top_pred_group_attack_count;
-  Apto::Array<int> last_killed_targets;
-  int last_attacks;
-  int last_kills;
 
   Apto::Array<int> last_from_message_count;
 
@@ -194,18 +168,11 @@ private:
   int last_cpu_cycles_used;
   double cur_child_germline_propensity;   // chance of child being a germline cell; @JEB
   
-  int last_mating_display_a;                   // value of organism's last mating display A trait
-  int last_mating_display_b;                   // value of organism's last mating display B trait
-  
 
   // 4. Records from this organism's life...
   int num_divides_failed; //Number of failed divide events @LZ
   int num_divides;       // Total successful divides organism has produced.
   int generation;        // Number of birth events to original ancestor.
-  int cpu_cycles_used;   // Total CPU cycles consumed. @JEB
-  int time_used;         // Total CPU cycles consumed, including additional time costs of some instructions.
-  int num_execs;         // Total number of instructions executions attempted...accounts for parallel executions in multi-threaded orgs & corrects for cpu-cost 'pauses'
-  int age;               // Number of updates organism has survived for.
   cString fault_desc;    // A description of the most recent error.
   double neutral_metric; // Undergoes drift (gausian 0,1) per generation
   double life_fitness; 	 // Organism fitness during its lifetime, 
@@ -233,59 +200,6 @@ private:
   bool make_random_resource; // Is the resource the organism just produced to be placed randomly?
   bool is_injected;      // Was this organism injected into the population?
   bool is_clone;      // Was this organism created as a clone in the population?
-  bool is_donor_cur;     // Has this organism attempted to donate merit?
-  bool is_donor_last;    // Did this organism's parent attempt to donate merit? 
-  bool is_donor_rand;    // Has this organism attempted a random donation?
-  bool is_donor_rand_last; // Did this org's parent attempt to donate randomly
-  bool is_donor_null;    // Has this organism attempted a null donation?
-  bool is_donor_null_last;// Did this org's parent attempt a null donation?
-  bool is_donor_kin;     // Has this organism kin_donated?
-  bool is_donor_kin_last;// Did this org's parent kin_donate?
-  bool is_donor_edit;    // Has this organism edit_donated?
-  bool is_donor_edit_last; // Did this org's parent edit_donate?
-  bool is_donor_gbg;     //  Has this organism gbg_donated (green beard gene)?
-  bool is_donor_gbg_last;// Did this org's parent gbg_donate?
-  bool is_donor_truegb;  // Has this organism truegb_donated (true green beard)? 
-  bool is_donor_truegb_last;// Did this org's parent truegb_donate? 
-  bool is_donor_threshgb;  // Has this organism threshgb_donated (true green beard)? 
-  bool is_donor_threshgb_last;// Did this org's parent threshgbg_donate? 
-  bool is_donor_quanta_threshgb;  // Has this organism quanta_threshgb_donated (true green beard)? 
-  bool is_donor_quanta_threshgb_last;// Did this org's parent quanta_threshgbg_donate?
-  bool is_donor_shadedgb; // Has this organism shaded_gb_donated (true shaded green beard)? 
-  bool is_donor_shadedgb_last; // Did this org's parent shaded_gb_donate? 
-  Apto::Array<bool> is_donor_locus; // Did this org target a donation at a specific locus.
-  Apto::Array<bool> is_donor_locus_last; // Did this org's parent target a donation at a specific locus.
-  bool is_energy_requestor; // Has this organism requested energy?
-  bool is_energy_donor; // Has this organism donated energy?
-  bool is_energy_receiver;  // Has this organism received an energy donation?
-  bool has_used_donated_energy; // Has the organism actively used an energy donation?
-  bool has_open_energy_request; // Does the organism have an energy request that hasn't been answered?
-  int num_thresh_gb_donations;  // Num times this organism threshgb_donated (thresh green beard)? 
-  int num_thresh_gb_donations_last; // Num times this org's parent thresh_donated? 
-  int num_quanta_thresh_gb_donations;  // Num times this organism threshgb_donated (thresh green beard)? 
-  int num_quanta_thresh_gb_donations_last; // Num times this org's parent thresh_donated? 
-  int num_shaded_gb_donations; // Num times this org shaded_gb_donated? 
-  int num_shaded_gb_donations_last; // Num times this org's parent shaded_gb_donated?
-  int num_donations_locus; // Num times this org targeted a donation to a position.
-  int num_donations_locus_last; // Num times this org's parent targeted a donation to a position.
-  bool is_receiver;      // Has this organism ever received merit donation?
-  bool is_receiver_last;      // Did this organism's parent receive a merit donation?
-  bool is_receiver_rand; // Has this organism ever received random merit donation?
-  bool is_receiver_kin;  // Has this organism ever received kin merit donation?
-  bool is_receiver_kin_last;  // Did this organism's parent receive a kin merit donation?
-  bool is_receiver_edit; // Has this organism ever received edit donation?
-  bool is_receiver_edit_last; // Did this organism's parent receive an edit donation?
-  bool is_receiver_gbg;  // Has this organism ever received gbg donation?
-  bool is_receiver_truegb;// Has this organism ever received truegb donation?
-  bool is_receiver_truegb_last;// Did this organism's parent receive a truegb donation?
-  bool is_receiver_threshgb;// Has this organism ever received a threshgb donation?
-  bool is_receiver_threshgb_last;// Did this organism's parent receive a threshgb donation?
-  bool is_receiver_quanta_threshgb;// Has this organism ever received a quanta_threshgb donation?
-  bool is_receiver_quanta_threshgb_last;// Did this organism's parent receive a quanta_threshgb donation?
-  bool is_receiver_shadedgb; // Has this organism ever received a shaded_gb donation? 
-  bool is_receiver_shadedgb_last; // Did this organism's parent receive a shaded gb donation?
-  bool is_receiver_gb_same_locus; // Has this org ever received a donation for a specific locus.
-  bool is_receiver_gb_same_locus_last; // Did this org's parent ever received a donation for a specific locus.
   bool is_modifier;      // Has this organism modified another?
   bool is_modified;      // Has this organism been modified by another?
   bool is_fertile;       // Do we allow this organisms to produce offspring?
@@ -295,8 +209,6 @@ private:
   bool parent_sex;       // Did the parent divide with sex?
   int  parent_cross_num; // How many corssovers did the parent do?
   bool born_parent_group;// Was offspring born into the parent's group?
-  bool kaboom_executed; // Has organism executed an explode instruction?
-  bool kaboom_executed2; // Has organism executed an explode instruction? Testing two instructions
 
   // 6. Child information...
   bool copy_true;        // Can this genome produce an exact copy of itself?
@@ -310,12 +222,177 @@ private:
   // 7. Information that is set once (when organism was born)
   double permanent_germline_propensity;
   
+  // Feature state that most experiments never touch lives in extension blocks, allocated on first write.  A missing
+  // block reads as all false/zero, so setup and divide only do work for the features an organism actually used.
+
+  // Merit donation and green beard bookkeeping
+  struct sDonationState
+  {
+    bool is_donor_cur;     // Has this organism attempted to donate merit?
+    bool is_donor_last;    // Did this organism's parent attempt to donate merit? 
+    bool is_donor_rand;    // Has this organism attempted a random donation?
+    bool is_donor_rand_last; // Did this org's parent attempt to donate randomly
+    bool is_donor_null;    // Has this organism attempted a null donation?
+    bool is_donor_null_last;// Did this org's parent attempt a null donation?
+    bool is_donor_kin;     // Has this organism kin_donated?
+    bool is_donor_kin_last;// Did this org's parent kin_donate?
+    bool is_donor_edit;    // Has this organism edit_donated?
+    bool is_donor_edit_last; // Did this org's parent edit_donate?
+    bool is_donor_gbg;     //  Has this organism gbg_donated (green beard gene)?
+    bool is_donor_gbg_last;// Did this org's parent gbg_donate?
+    bool is_donor_truegb;  // Has this organism truegb_donated (true green beard)? 
+    bool is_donor_truegb_last;// Did this org's parent truegb_donate? 
+    bool is_donor_threshgb;  // Has this organism threshgb_donated (true green beard)? 
+    bool is_donor_threshgb_last;// Did this org's parent threshgbg_donate? 
+    bool is_donor_quanta_threshgb;  // Has this organism quanta_threshgb_donated (true green beard)? 
+    bool is_donor_quanta_threshgb_last;// Did this org's parent quanta_threshgbg_donate?
+    bool is_donor_shadedgb; // Has this organism shaded_gb_donated (true shaded green beard)? 
+    bool is_donor_shadedgb_last; // Did this org's parent shaded_gb_donate? 
+    Apto::Array<bool> is_donor_locus; // Did this org target a donation at a specific locus.
+    Apto::Array<bool> is_donor_locus_last; // Did this org's parent target a donation at a specific locus.
+    int num_thresh_gb_donations;  // Num times this organism threshgb_donated (thresh green beard)? 
+    int num_thresh_gb_donations_last; // Num times this org's parent thresh_donated? 
+    int num_quanta_thresh_gb_donations;  // Num times this organism threshgb_donated (thresh green beard)? 
+    int num_quanta_thresh_gb_donations_last; // Num times this org's parent thresh_donated? 
+    int num_shaded_gb_donations; // Num times this org shaded_gb_donated? 
+    int num_shaded_gb_donations_last; // Num times this org's parent shaded_gb_donated?
+    int num_donations_locus; // Num times this org targeted a donation to a position.
+    int num_donations_locus_last; // Num times this org's parent targeted a donation to a position.
+    bool is_receiver;      // Has this organism ever received merit donation?
+    bool is_receiver_last;      // Did this organism's parent receive a merit donation?
+    bool is_receiver_rand; // Has this organism ever received random merit donation?
+    bool is_receiver_kin;  // Has this organism ever received kin merit donation?
+    bool is_receiver_kin_last;  // Did this organism's parent receive a kin merit donation?
+    bool is_receiver_edit; // Has this organism ever received edit donation?
+    bool is_receiver_edit_last; // Did this organism's parent receive an edit donation?
+    bool is_receiver_gbg;  // Has this organism ever received gbg donation?
+    bool is_receiver_truegb;// Has this organism ever received truegb donation?
+    bool is_receiver_truegb_last;// Did this organism's parent receive a truegb donation?
+    bool is_receiver_threshgb;// Has this organism ever received a threshgb donation?
+    bool is_receiver_threshgb_last;// Did this organism's parent receive a threshgb donation?
+    bool is_receiver_quanta_threshgb;// Has this organism ever received a quanta_threshgb donation?
+    bool is_receiver_quanta_threshgb_last;// Did this organism's parent receive a quanta_threshgb donation?
+    bool is_receiver_shadedgb; // Has this organism ever received a shaded_gb donation? 
+    bool is_receiver_shadedgb_last; // Did this organism's parent receive a shaded gb donation?
+    bool is_receiver_gb_same_locus; // Has this org ever received a donation for a specific locus.
+    bool is_receiver_gb_same_locus_last; // Did this org's parent ever received a donation for a specific locus.
+
+    sDonationState();
+    void DivideReset();
+    void SetupOffspring(const sDonationState& parent);
+    void SetupClone(const sDonationState& clone);
+  };
+
+  // Energy sharing bookkeeping
+  struct sEnergySharingState
+  {
+    bool is_energy_requestor;         // Has this organism requested energy?
+    bool is_energy_donor;             // Has this organism donated energy?
+    bool is_energy_receiver;          // Has this organism received an energy donation?
+    bool has_used_donated_energy;     // Has the organism actively used an energy donation?
+    bool has_open_energy_request;     // Does the organism have an energy request that hasn't been answered?
+    double total_energy_donated;      // Tota amount of energy that has been donated
+    double total_energy_received;     // Total amount of energy received through donations
+    double total_energy_applied;      // Total amount of received energy applied to energy store
+    int num_energy_requests;          // Number of times organism has requested energy
+    int num_energy_donations;         // Number of times energy has been donated
+    int num_energy_receptions;        // Number of times organism has received energy donations
+    int num_energy_applications;      // Number of times organism has applied donated energy to its energy store
+
+    sEnergySharingState();
+    void Reset(bool clear_requests, bool clear_totals);
+  };
+
+  // Group tolerance records (see cPhenotype.cc)
+  struct sToleranceState;
+
+  // Sensor use and sensed resource records
+  struct sSensingState
+  {
+    Apto::Array<int> cur_sense_count;         // Total times resource combinations have been sensed; @JEB
+    Apto::Array<int> last_sense_count;
+    Apto::Array<double> sensed_resources;     // Resources which the organism has sensed; @JEB
+    Apto::Array<int> cur_from_sensor_count;   // Use of inputs that originated from sensory data were used in execution of this instruction.
+    Apto::Array<int> last_from_sensor_count;
+
+    sSensingState(int num_sense, int num_resources, int num_inst);
+    void DivideReset();
+    void SetupOffspring(const sSensingState& parent);
+  };
+
+  // Tasks performed by parasites running in this organism @LZ
+  struct sParasiteState
+  {
+    Apto::Array<int> cur_para_tasks;          // Total times each task was performed by the parasite
+    Apto::Array<int> last_para_tasks;
+
+    sParasiteState(int num_tasks);
+    void DivideReset();
+    void SetupOffspring(const sParasiteState& parent);
+  };
+
+  // Predator attack records, and whether the organism has exploded
+  struct sAttackState
+  {
+    Apto::Array< Apto::Array<int> > cur_group_attack_count;
+    Apto::Array< Apto::Array<int> > cur_top_pred_group_attack_count;
+    Apto::Array< Apto::Array<int> > last_group_attack_count;
+    Apto::Array< Apto::Array<int> > last_top_pred_group_attack_count;
+    Apto::Array<int> cur_killed_targets;
+    Apto::Array<int> last_killed_targets;
+    int cur_attacks;
+    int cur_kills;
+    int last_attacks;
+    int last_kills;
+    bool kaboom_executed;   // Has organism executed an explode instruction?
+    bool kaboom_executed2;  // Has organism executed an explode instruction? Testing two instructions
+
+    sAttackState(int num_group_attack_inst);
+    void SetGroupAttackInstSetSize(int num_group_attack_inst);
+    void DivideReset();
+    void SetupOffspring(const sAttackState& parent);
+  };
+
+  // Mating type, preference and display traits @CHC
+  struct sMatingState
+  {
+    int mating_type;            // Organism's phenotypic sex
+    int mate_preference;        // Organism's mating preference
+    int cur_mating_display_a;   // value of organism's current mating display A trait
+    int cur_mating_display_b;   // value of organism's current mating display B trait
+    int last_mating_display_a;  // value of organism's last mating display A trait
+    int last_mating_display_b;  // value of organism's last mating display B trait
+
+    sMatingState();
+  };
+
+  sDonationState* m_donation;
+  sEnergySharingState* m_energy_sharing;
+  sToleranceState* m_tolerance;
+  sSensingState* m_sensing;
+  sParasiteState* m_parasite;
+  sAttackState* m_attack;
+  sMatingState* m_mating;
+  int num_group_attack_inst;  // Sizes the group attack counts when m_attack is allocated
+
 
   inline void SetInstSetSize(int inst_set_size);
   inline void SetGroupAttackInstSetSize(int num_group_attack_inst);
+
+  inline sDonationState& donation();
+  inline sEnergySharingState& energySharing();
+  sToleranceState& tolerance();
+  sSensingState& sensing();
+  sParasiteState& parasite();
+  inline sAttackState& attack();
+  inline sMatingState& mating();
   
 public:
-  cPhenotype() : m_world(NULL), m_reaction_result(NULL) { ; } // Will not construct a valid cPhenotype! Only exists to support incorrect cDeme Apto::Array usage.
+  static const int NUM_GROUP_ATTACK_PACK_SIZES = 20; // Pack sizes tracked for each group attack instruction
+
+  cPhenotype()
+    : m_world(NULL), m_reaction_result(NULL), m_donation(NULL), m_energy_sharing(NULL), m_tolerance(NULL)
+    , m_sensing(NULL), m_parasite(NULL), m_attack(NULL), m_mating(NULL), num_group_attack_inst(0) { ; } // Will not construct a valid cPhenotype! Only exists to support incorrect cDeme Apto::Array usage.
   cPhenotype(cWorld* world, int parent_generation, int num_nops);
 
 
@@ -346,7 +423,7 @@ public:
   // Input and Output Reaction Tests
   bool TestInput(tBuffer<int>& inputs, tBuffer<int>& outputs);
   bool TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
-                  const Apto::Array<double>& res_in, const Apto::Array<double>& rbins_in, Apto::Array<double>& res_change,
+                  const cResourceView& res_in, const Apto::Array<double>& rbins_in, Apto::Array<double>& res_change,
                   Apto::Array<cString>& insts_triggered, bool is_parasite=false, cContextPhenotype* context_phenotype = 0);
 
   // State saving and loading, and printing...
@@ -408,13 +485,13 @@ public:
   inline void SetBirthGroupID(int group_id);
   inline void SetBirthForagerType(int forager_type);
 
-  int GetMatingType() const { return mating_type; } //@CHC
-  int GetMatePreference() const { return mate_preference; } //@CHC
+  int GetMatingType() const { return (m_mating) ? m_mating->mating_type : MATING_TYPE_JUVENILE; } //@CHC
+  int GetMatePreference() const { return (m_mating) ? m_mating->mate_preference : MATE_PREFERENCE_RANDOM; } //@CHC
 
-  int GetCurMatingDisplayA() const { return cur_mating_display_a; } //@CHC
-  int GetCurMatingDisplayB() const { return cur_mating_display_b; } //@CHC
-  int GetLastMatingDisplayA() const { return last_mating_display_a; } //@CHC
-  int GetLastMatingDisplayB() const { return last_mating_display_b; } //@CHC
+  int GetCurMatingDisplayA() const { return (m_mating) ? m_mating->cur_mating_display_a : 0; } //@CHC
+  int GetCurMatingDisplayB() const { return (m_mating) ? m_mating->cur_mating_display_b : 0; } //@CHC
+  int GetLastMatingDisplayA() const { return (m_mating) ? m_mating->last_mating_display_a : 0; } //@CHC
+  int GetLastMatingDisplayB() const { return (m_mating) ? m_mating->last_mating_display_b : 0; } //@CHC
 
   bool GetMakeRandomResource() const {assert(initialized == true); return make_random_resource;}
   bool GetToDie() const { assert(initialized == true); return to_die; }
@@ -424,7 +501,7 @@ public:
   int GetCurCountForTask(int idx) const { assert(initialized == true); return cur_task_count[idx]; }
   const Apto::Array<int>& GetCurTaskCount() const { assert(initialized == true); return cur_task_count; }
   const Apto::Array<int>& GetCurHostTaskCount() const { assert(initialized == true); return cur_host_tasks; }
-  const Apto::Array<int>& GetCurParasiteTaskCount() const { assert(initialized == true); return cur_para_tasks; }
+  int GetCurParasiteTaskCount(int idx) const { assert(initialized == true); return (m_parasite) ? m_parasite->cur_para_tasks[idx] : 0; }
   const Apto::Array<int>& GetCurInternalTaskCount() const { assert(initialized == true); return cur_internal_task_count; }
   void ClearEffTaskCount() { assert(initialized == true); eff_task_count.SetAll(0); }
   const Apto::Array<double> & GetCurTaskQuality() const { assert(initialized == true); return cur_task_quality; }
@@ -444,9 +521,9 @@ public:
   const Apto::Array<int>& GetStolenReactionCount() const { assert(initialized == true); return cur_stolen_reaction_count;}
   const Apto::Array<double>& GetCurReactionAddReward() const { assert(initialized == true); return cur_reaction_add_reward;}
   const Apto::Array<int>& GetCurInstCount() const { assert(initialized == true); return cur_inst_count; }
-  const Apto::Array<int>& GetCurSenseCount() const { assert(initialized == true); return cur_sense_count; }
+  int GetCurSenseCount(int idx) const { assert(initialized == true); return (m_sensing) ? m_sensing->cur_sense_count[idx] : 0; }
 
-  double GetSensedResource(int _in) { assert(initialized == true); return sensed_resources[_in]; }
+  double GetSensedResource(int _in) { assert(initialized == true); return (m_sensing) ? m_sensing->sensed_resources[_in] : 0.0; }
   const Apto::Array<int>& GetCurCollectSpecCounts() const { assert(initialized == true); return cur_collect_spec_counts; }
   int GetCurCollectSpecCount(int spec_id) const { assert(initialized == true); return cur_collect_spec_counts[spec_id]; }
   const Apto::Array<int>& GetTestCPUInstCount() const { assert(initialized == true); return testCPU_inst_count; }
@@ -457,10 +534,10 @@ public:
   const Apto::Array<double>& GetTrialBonuses() { return cur_trial_bonuses; }; //Return list of trial bonuses. @JEB
   const Apto::Array<int>& GetTrialTimesUsed() { return cur_trial_times_used; }; //Return list of trial times used. @JEB
 
-  tList<int>& GetToleranceImmigrants() { assert(initialized == true); return m_tolerance_immigrants; }
-  tList<int>& GetToleranceOffspringOwn() { assert(initialized == true); return m_tolerance_offspring_own; }
-  tList<int>& GetToleranceOffspringOthers() { assert(initialized == true); return m_tolerance_offspring_others; }
-  Apto::Array<pair<int,int> >& GetIntolerances() { assert(initialized == true); return m_intolerances; }
+  tList<int>& GetToleranceImmigrants();
+  tList<int>& GetToleranceOffspringOwn();
+  tList<int>& GetToleranceOffspringOthers();
+  Apto::Array<pair<int,int> >& GetIntolerances();
   int CalcToleranceImmigrants();
   int CalcToleranceOffspringOwn();
   int CalcToleranceOffspringOthers();
@@ -476,7 +553,8 @@ public:
   const Apto::Array<int>& GetLastTaskCount() const { assert(initialized == true); return last_task_count; }
   void SetLastTaskCount(Apto::Array<int> tasks) { assert(initialized == true); last_task_count = tasks; }
   const Apto::Array<int>& GetLastHostTaskCount() const { assert(initialized == true); return last_host_tasks; }
-  const Apto::Array<int>& GetLastParasiteTaskCount() const { assert(initialized == true); return last_para_tasks; }
+  int GetLastParasiteTaskCount(int idx) const { assert(initialized == true); return (m_parasite) ? m_parasite->last_para_tasks[idx] : 0; }
+  Apto::Array<int> GetLastParasiteTaskCount() const;
   void  SetLastParasiteTaskCount(Apto::Array<int>  oldParaPhenotype);
   const Apto::Array<int>& GetLastInternalTaskCount() const { assert(initialized == true); return last_internal_task_count; }
   const Apto::Array<double>& GetLastTaskQuality() const { assert(initialized == true); return last_task_quality; }
@@ -487,10 +565,12 @@ public:
   const Apto::Array<int>& GetLastReactionCount() const { assert(initialized == true); return last_reaction_count; }
   const Apto::Array<double>& GetLastReactionAddReward() const { assert(initialized == true); return last_reaction_add_reward; }
   const Apto::Array<int>& GetLastInstCount() const { assert(initialized == true); return last_inst_count; }
-  const Apto::Array<int>& GetLastFromSensorInstCount() const { assert(initialized == true); return last_from_sensor_count; }
-  const Apto::Array<int>& GetLastSenseCount() const { assert(initialized == true); return last_sense_count; }
-  const Apto::Array< Apto::Array<int> >& GetLastGroupAttackInstCount() const { assert(initialized == true); return last_group_attack_count; }
-  const Apto::Array< Apto::Array<int> >& GetLastTopPredGroupAttackInstCount() const { assert(initialized == true); return last_top_pred_group_attack_count; }
+  int GetLastFromSensorInstCount(int idx) const { assert(initialized == true); return (m_sensing) ? m_sensing->last_from_sensor_count[idx] : 0; }
+  int GetLastSenseCount(int idx) const { assert(initialized == true); return (m_sensing) ? m_sensing->last_sense_count[idx] : 0; }
+  int GetLastGroupAttackInstCount(int inst, int pack_size_idx) const
+    { assert(initialized == true); return (m_attack) ? m_attack->last_group_attack_count[inst][pack_size_idx] : 0; }
+  int GetLastTopPredGroupAttackInstCount(int inst, int pack_size_idx) const
+    { assert(initialized == true); return (m_attack) ? m_attack->last_top_pred_group_attack_count[inst][pack_size_idx] : 0; }
 
   const Apto::Array<int>& GetLastFromMessageInstCount() const { assert(initialized == true); return last_from_message_count; }
 
@@ -511,61 +591,61 @@ public:
   const cString& GetFault() const { assert(initialized == true); return fault_desc; }
   double GetNeutralMetric() const { assert(initialized == true); return neutral_metric; }
   double GetLifeFitness() const { assert(initialized == true); return life_fitness; }
-  int  GetNumThreshGbDonations() const { assert(initialized == true); return num_thresh_gb_donations; }
-  int  GetNumThreshGbDonationsLast() const { assert(initialized == true); return num_thresh_gb_donations_last; }
-  int  GetNumQuantaThreshGbDonations() const { assert(initialized == true); return num_quanta_thresh_gb_donations; }
-  int  GetNumQuantaThreshGbDonationsLast() const { assert(initialized == true); return num_quanta_thresh_gb_donations_last; }
-  int  GetNumShadedGbDonations() const { assert(initialized == true); return num_shaded_gb_donations; }
-  int  GetNumShadedGbDonationsLast() const { assert(initialized == true); return num_shaded_gb_donations_last; }
-  int GetNumDonationsLocus() const { assert(initialized == true); return num_donations_locus; }
-  int GetNumDonationsLocusLast() const { assert(initialized == true); return num_donations_locus_last; }
+  int  GetNumThreshGbDonations() const { assert(initialized == true); return (m_donation) ? m_donation->num_thresh_gb_donations : 0; }
+  int  GetNumThreshGbDonationsLast() const { assert(initialized == true); return (m_donation) ? m_donation->num_thresh_gb_donations_last : 0; }
+  int  GetNumQuantaThreshGbDonations() const { assert(initialized == true); return (m_donation) ? m_donation->num_quanta_thresh_gb_donations : 0; }
+  int  GetNumQuantaThreshGbDonationsLast() const { assert(initialized == true); return (m_donation) ? m_donation->num_quanta_thresh_gb_donations_last : 0; }
+  int  GetNumShadedGbDonations() const { assert(initialized == true); return (m_donation) ? m_donation->num_shaded_gb_donations : 0; }
+  int  GetNumShadedGbDonationsLast() const { assert(initialized == true); return (m_donation) ? m_donation->num_shaded_gb_donations_last : 0; }
+  int GetNumDonationsLocus() const { assert(initialized == true); return (m_donation) ? m_donation->num_donations_locus : 0; }
+  int GetNumDonationsLocusLast() const { assert(initialized == true); return (m_donation) ? m_donation->num_donations_locus_last : 0; }
 
   bool IsInjected() const { assert(initialized == true); return is_injected; }
   bool IsClone() const { assert(initialized == true); return is_clone; }
-  bool IsDonorCur() const { assert(initialized == true); return is_donor_cur; }
-  bool IsDonorLast() const { assert(initialized == true); return is_donor_last; }
-  bool IsDonorRand() const { assert(initialized == true); return is_donor_rand; }
-  bool IsDonorRandLast() const { assert(initialized == true); return is_donor_rand_last; }
-  bool IsDonorKin() const { assert(initialized == true); return is_donor_kin; }
-  bool IsDonorKinLast() const { assert(initialized == true); return is_donor_kin_last; }
-  bool IsDonorEdit() const { assert(initialized == true); return is_donor_edit; }
-  bool IsDonorEditLast() const { assert(initialized == true); return is_donor_edit_last; }
-  bool IsDonorGbg() const { assert(initialized == true); return is_donor_gbg; }
-  bool IsDonorGbgLast() const { assert(initialized == true); return is_donor_gbg_last; }
-  bool IsDonorTrueGb() const { assert(initialized == true); return is_donor_truegb; }
-  bool IsDonorTrueGbLast() const { assert(initialized == true); return is_donor_truegb_last; }
-  bool IsDonorThreshGb() const { assert(initialized == true); return is_donor_threshgb; }
-  bool IsDonorThreshGbLast() const { assert(initialized == true); return is_donor_threshgb_last; }
-  bool IsDonorQuantaThreshGb() const { assert(initialized == true); return is_donor_quanta_threshgb; }
-  bool IsDonorQuantaThreshGbLast() const { assert(initialized == true); return is_donor_quanta_threshgb_last; }
-  bool IsDonorShadedGb() const { assert(initialized == true); return is_donor_shadedgb; }
-  bool IsDonorShadedGbLast() const { assert(initialized == true); return is_donor_shadedgb_last; }	
-  bool IsDonorPosition(int pos) const {assert(initialized == true); return is_donor_locus.GetSize() > pos ? is_donor_locus[pos] : 0; }
-  bool IsDonorPositionLast(int pos) const {assert(initialized == true); return is_donor_locus_last.GetSize() > pos ? is_donor_locus_last[pos] : 0; }
+  bool IsDonorCur() const { assert(initialized == true); return m_donation && m_donation->is_donor_cur; }
+  bool IsDonorLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_last; }
+  bool IsDonorRand() const { assert(initialized == true); return m_donation && m_donation->is_donor_rand; }
+  bool IsDonorRandLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_rand_last; }
+  bool IsDonorKin() const { assert(initialized == true); return m_donation && m_donation->is_donor_kin; }
+  bool IsDonorKinLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_kin_last; }
+  bool IsDonorEdit() const { assert(initialized == true); return m_donation && m_donation->is_donor_edit; }
+  bool IsDonorEditLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_edit_last; }
+  bool IsDonorGbg() const { assert(initialized == true); return m_donation && m_donation->is_donor_gbg; }
+  bool IsDonorGbgLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_gbg_last; }
+  bool IsDonorTrueGb() const { assert(initialized == true); return m_donation && m_donation->is_donor_truegb; }
+  bool IsDonorTrueGbLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_truegb_last; }
+  bool IsDonorThreshGb() const { assert(initialized == true); return m_donation && m_donation->is_donor_threshgb; }
+  bool IsDonorThreshGbLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_threshgb_last; }
+  bool IsDonorQuantaThreshGb() const { assert(initialized == true); return m_donation && m_donation->is_donor_quanta_threshgb; }
+  bool IsDonorQuantaThreshGbLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_quanta_threshgb_last; }
+  bool IsDonorShadedGb() const { assert(initialized == true); return m_donation && m_donation->is_donor_shadedgb; }
+  bool IsDonorShadedGbLast() const { assert(initialized == true); return m_donation && m_donation->is_donor_shadedgb_last; }	
+  bool IsDonorPosition(int pos) const {assert(initialized == true); return m_donation && m_donation->is_donor_locus.GetSize() > pos ? m_donation->is_donor_locus[pos] : 0; }
+  bool IsDonorPositionLast(int pos) const {assert(initialized == true); return m_donation && m_donation->is_donor_locus_last.GetSize() > pos ? m_donation->is_donor_locus_last[pos] : 0; }
   
-  bool IsEnergyRequestor() const { assert(initialized == true); return is_energy_requestor; }
-  bool IsEnergyDonor() const { assert(initialized == true); return is_energy_donor; }
-  bool IsEnergyReceiver() const { assert(initialized == true); return is_energy_receiver; }
-  bool HasUsedEnergyDonation() const { assert(initialized == true); return has_used_donated_energy; }
-  bool HasOpenEnergyRequest() const { assert(initialized == true); return has_open_energy_request; }
-  bool IsReceiver() const { assert(initialized == true); return is_receiver; }
-  bool IsReceiverLast() const { assert(initialized == true); return is_receiver_last; }
-  bool IsReceiverRand() const { assert(initialized == true); return is_receiver_rand; }
-  bool IsReceiverKin() const { assert(initialized == true); return is_receiver_kin; }
-  bool IsReceiverKinLast() const { assert(initialized == true); return is_receiver_kin_last; }
-  bool IsReceiverEdit() const { assert(initialized == true); return is_receiver_edit; }
-  bool IsReceiverEditLast() const { assert(initialized == true); return is_receiver_edit_last; }
-  bool IsReceiverGbg() const { assert(initialized == true); return is_receiver_gbg; }
-  bool IsReceiverTrueGb() const { assert(initialized == true); return is_receiver_truegb; }
-  bool IsReceiverTrueGbLast() const { assert(initialized == true); return is_receiver_truegb_last; }
-  bool IsReceiverThreshGb() const { assert(initialized == true); return is_receiver_threshgb; }
-  bool IsReceiverThreshGbLast() const { assert(initialized == true); return is_receiver_threshgb_last; }
-  bool IsReceiverQuantaThreshGb() const { assert(initialized == true); return is_receiver_quanta_threshgb; }
-  bool IsReceiverQuantaThreshGbLast() const { assert(initialized == true); return is_receiver_quanta_threshgb_last; }
-  bool IsReceiverShadedGb() const { assert(initialized == true); return is_receiver_shadedgb; }
-  bool IsReceiverShadedGbLast() const { assert(initialized == true); return is_receiver_shadedgb_last; }
-  bool IsReceiverGBSameLocus() const { assert(initialized == true); return is_receiver_gb_same_locus; }
-  bool IsReceiverGBSameLocusLast() const { assert(initialized == true); return is_receiver_gb_same_locus_last; }
+  bool IsEnergyRequestor() const { assert(initialized == true); return m_energy_sharing && m_energy_sharing->is_energy_requestor; }
+  bool IsEnergyDonor() const { assert(initialized == true); return m_energy_sharing && m_energy_sharing->is_energy_donor; }
+  bool IsEnergyReceiver() const { assert(initialized == true); return m_energy_sharing && m_energy_sharing->is_energy_receiver; }
+  bool HasUsedEnergyDonation() const { assert(initialized == true); return m_energy_sharing && m_energy_sharing->has_used_donated_energy; }
+  bool HasOpenEnergyRequest() const { assert(initialized == true); return m_energy_sharing && m_energy_sharing->has_open_energy_request; }
+  bool IsReceiver() const { assert(initialized == true); return m_donation && m_donation->is_receiver; }
+  bool IsReceiverLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_last; }
+  bool IsReceiverRand() const { assert(initialized == true); return m_donation && m_donation->is_receiver_rand; }
+  bool IsReceiverKin() const { assert(initialized == true); return m_donation && m_donation->is_receiver_kin; }
+  bool IsReceiverKinLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_kin_last; }
+  bool IsReceiverEdit() const { assert(initialized == true); return m_donation && m_donation->is_receiver_edit; }
+  bool IsReceiverEditLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_edit_last; }
+  bool IsReceiverGbg() const { assert(initialized == true); return m_donation && m_donation->is_receiver_gbg; }
+  bool IsReceiverTrueGb() const { assert(initialized == true); return m_donation && m_donation->is_receiver_truegb; }
+  bool IsReceiverTrueGbLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_truegb_last; }
+  bool IsReceiverThreshGb() const { assert(initialized == true); return m_donation && m_donation->is_receiver_threshgb; }
+  bool IsReceiverThreshGbLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_threshgb_last; }
+  bool IsReceiverQuantaThreshGb() const { assert(initialized == true); return m_donation && m_donation->is_receiver_quanta_threshgb; }
+  bool IsReceiverQuantaThreshGbLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_quanta_threshgb_last; }
+  bool IsReceiverShadedGb() const { assert(initialized == true); return m_donation && m_donation->is_receiver_shadedgb; }
+  bool IsReceiverShadedGbLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_shadedgb_last; }
+  bool IsReceiverGBSameLocus() const { assert(initialized == true); return m_donation && m_donation->is_receiver_gb_same_locus; }
+  bool IsReceiverGBSameLocusLast() const { assert(initialized == true); return m_donation && m_donation->is_receiver_gb_same_locus_last; }
   bool IsModifier() const { assert(initialized == true); return is_modifier; }
   bool IsModified() const { assert(initialized == true); return is_modified; }
   bool IsFertile() const  { assert(initialized == true); return is_fertile; }
@@ -607,28 +687,28 @@ public:
   void SetToDie() { to_die = true; }
   void SetToDelete() { to_delete = true; }
   void SetTestCPUInstCount(const Apto::Array<int>& in_counts) { testCPU_inst_count = in_counts; }
-  void IncreaseEnergyDonated(double amount) { assert(amount >=0); total_energy_donated += amount; }
-  void IncreaseEnergyReceived(double amount) { assert(amount >=0); total_energy_received += amount; }
-  void IncreaseEnergyApplied(double amount) { assert(amount >=0); total_energy_applied += amount; }
-  void IncreaseNumEnergyRequests() { num_energy_requests++; }
-  void IncreaseNumEnergyDonations() { num_energy_donations++; }
-  void IncreaseNumEnergyApplications() { num_energy_applications++; }
-  void IncreaseNumEnergyReceptions() { num_energy_receptions++; }
-  double GetAmountEnergyDonated() { return total_energy_donated; }
-  double GetAmountEnergyReceived() { return total_energy_received; }
-  double GetAmountEnergyApplied() { return total_energy_applied; }
-  int GetNumEnergyDonations() { return num_energy_donations; }
-  int GetNumEnergyReceptions() { return num_energy_receptions; }
-  int GetNumEnergyApplications() { return num_energy_applications; }
+  void IncreaseEnergyDonated(double amount) { assert(amount >=0); energySharing().total_energy_donated += amount; }
+  void IncreaseEnergyReceived(double amount) { assert(amount >=0); energySharing().total_energy_received += amount; }
+  void IncreaseEnergyApplied(double amount) { assert(amount >=0); energySharing().total_energy_applied += amount; }
+  void IncreaseNumEnergyRequests() { energySharing().num_energy_requests++; }
+  void IncreaseNumEnergyDonations() { energySharing().num_energy_donations++; }
+  void IncreaseNumEnergyApplications() { energySharing().num_energy_applications++; }
+  void IncreaseNumEnergyReceptions() { energySharing().num_energy_receptions++; }
+  double GetAmountEnergyDonated() { return (m_energy_sharing) ? m_energy_sharing->total_energy_donated : 0.0; }
+  double GetAmountEnergyReceived() { return (m_energy_sharing) ? m_energy_sharing->total_energy_received : 0.0; }
+  double GetAmountEnergyApplied() { return (m_energy_sharing) ? m_energy_sharing->total_energy_applied : 0.0; }
+  int GetNumEnergyDonations() { return (m_energy_sharing) ? m_energy_sharing->num_energy_donations : 0; }
+  int GetNumEnergyReceptions() { return (m_energy_sharing) ? m_energy_sharing->num_energy_receptions : 0; }
+  int GetNumEnergyApplications() { return (m_energy_sharing) ? m_energy_sharing->num_energy_applications : 0; }
   
   void SetReactionCount(int index, int val) { cur_reaction_count[index] = val; }
   void SetStolenReactionCount(int index, int val) { cur_stolen_reaction_count[index] = val; }
   
-  bool GetKaboomExecuted() {return kaboom_executed;} //@AEJ
-  void SetKaboomExecuted(bool value) {kaboom_executed = value;} //@AEJ
-  bool GetKaboomExecuted2() {return kaboom_executed2;} //@AEJ
-  void SetKaboomExecuted2(bool value) {kaboom_executed2 = value;} //@AEJ
-  void ClearKaboomExecuted() {kaboom_executed = false;} //@AEJ
+  bool GetKaboomExecuted() {return m_attack && m_attack->kaboom_executed;} //@AEJ
+  void SetKaboomExecuted(bool value) {attack().kaboom_executed = value;} //@AEJ
+  bool GetKaboomExecuted2() {return m_attack && m_attack->kaboom_executed2;} //@AEJ
+  void SetKaboomExecuted2(bool value) {attack().kaboom_executed2 = value;} //@AEJ
+  void ClearKaboomExecuted() {if (m_attack) m_attack->kaboom_executed = false;} //@AEJ
 
 
   void SetCurRBinsAvail(const Apto::Array<double>& in_avail) { cur_rbins_avail = in_avail; }
@@ -639,38 +719,39 @@ public:
   void AddToCurRBinTotal(int index, double val) { cur_rbins_total[index] += val; }
   void SetCurCollectSpecCount(int spec_id, int val) { cur_collect_spec_counts[spec_id] = val; }
 
-  void SetMatingType(int _mating_type) { mating_type = _mating_type; } //@CHC
-  void SetMatePreference(int _mate_preference) { mate_preference = _mate_preference; } //@CHC
+  void SetMatingType(int _mating_type) { mating().mating_type = _mating_type; } //@CHC
+  void SetMatePreference(int _mate_preference) { mating().mate_preference = _mate_preference; } //@CHC
 
   void SetIsMultiThread() { is_multi_thread = true; }
-  void SetIsDonorCur() { is_donor_cur = true; } 
-  void SetIsDonorRand() { SetIsDonorCur(); is_donor_rand = true; }
-  void SetIsDonorKin() { SetIsDonorCur(); is_donor_kin = true; }
-  void SetIsDonorNull() { SetIsDonorCur(); is_donor_null = true; }
-  void SetIsDonorEdit() { SetIsDonorCur(); is_donor_edit = true; }
-  void SetIsDonorGbg() { SetIsDonorCur(); is_donor_gbg = true; }
-  void SetIsDonorTrueGb() { SetIsDonorCur(); is_donor_truegb = true; }
-  void SetIsDonorThreshGb() { SetIsDonorCur(); is_donor_threshgb = true; }
-  void SetIsDonorQuantaThreshGb() { SetIsDonorCur(); is_donor_quanta_threshgb = true; }
-  void SetIsDonorShadedGb() { SetIsDonorCur(); is_donor_shadedgb = true; }
-  void SetIsDonorPosition(int pos) { SetIsDonorCur(); if (is_donor_locus.GetSize() <= pos) is_donor_locus.Resize(pos+1, false); is_donor_locus[pos] = true; }
-  void SetIsReceiver() { is_receiver = true; } 
-  void SetIsReceiverRand() { SetIsReceiver(); is_receiver_rand = true; } 
-  void SetIsReceiverKin() { SetIsReceiver(); is_receiver_kin = true; } 
-  void SetIsReceiverEdit() { SetIsReceiver(); is_receiver_edit = true; } 
-  void SetIsReceiverGbg() { SetIsReceiver(); is_receiver_gbg = true; } 
-  void SetIsReceiverTrueGb() { SetIsReceiver(); is_receiver_truegb = true; } 
-  void SetIsReceiverThreshGb() { SetIsReceiver(); is_receiver_threshgb = true; } 
-  void SetIsReceiverQuantaThreshGb() { SetIsReceiver(); is_receiver_quanta_threshgb = true; } 
-  void SetIsReceiverShadedGb() { SetIsReceiver(); is_receiver_shadedgb = true; }
-  void SetIsReceiverGBSameLocus() { SetIsReceiver(); is_receiver_gb_same_locus = true; }
-  void SetIsEnergyRequestor() { is_energy_requestor = true; }
-  void SetIsEnergyDonor() { is_energy_donor = true; }
-  void SetIsEnergyReceiver() { is_energy_receiver = true; }
+  void SetIsDonorCur() { donation().is_donor_cur = true; } 
+  void SetIsDonorRand() { SetIsDonorCur(); m_donation->is_donor_rand = true; }
+  void SetIsDonorKin() { SetIsDonorCur(); m_donation->is_donor_kin = true; }
+  void SetIsDonorNull() { SetIsDonorCur(); m_donation->is_donor_null = true; }
+  void SetIsDonorEdit() { SetIsDonorCur(); m_donation->is_donor_edit = true; }
+  void SetIsDonorGbg() { SetIsDonorCur(); m_donation->is_donor_gbg = true; }
+  void SetIsDonorTrueGb() { SetIsDonorCur(); m_donation->is_donor_truegb = true; }
+  void SetIsDonorThreshGb() { SetIsDonorCur(); m_donation->is_donor_threshgb = true; }
+  void SetIsDonorQuantaThreshGb() { SetIsDonorCur(); m_donation->is_donor_quanta_threshgb = true; }
+  void SetIsDonorShadedGb() { SetIsDonorCur(); m_donation->is_donor_shadedgb = true; }
+  void SetIsDonorPosition(int pos)
+    { SetIsDonorCur(); if (m_donation->is_donor_locus.GetSize() <= pos) m_donation->is_donor_locus.Resize(pos+1, false); m_donation->is_donor_locus[pos] = true; }
+  void SetIsReceiver() { donation().is_receiver = true; } 
+  void SetIsReceiverRand() { SetIsReceiver(); m_donation->is_receiver_rand = true; } 
+  void SetIsReceiverKin() { SetIsReceiver(); m_donation->is_receiver_kin = true; } 
+  void SetIsReceiverEdit() { SetIsReceiver(); m_donation->is_receiver_edit = true; } 
+  void SetIsReceiverGbg() { SetIsReceiver(); m_donation->is_receiver_gbg = true; } 
+  void SetIsReceiverTrueGb() { SetIsReceiver(); m_donation->is_receiver_truegb = true; } 
+  void SetIsReceiverThreshGb() { SetIsReceiver(); m_donation->is_receiver_threshgb = true; } 
+  void SetIsReceiverQuantaThreshGb() { SetIsReceiver(); m_donation->is_receiver_quanta_threshgb = true; } 
+  void SetIsReceiverShadedGb() { SetIsReceiver(); m_donation->is_receiver_shadedgb = true; }
+  void SetIsReceiverGBSameLocus() { SetIsReceiver(); m_donation->is_receiver_gb_same_locus = true; }
+  void SetIsEnergyRequestor() { energySharing().is_energy_requestor = true; }
+  void SetIsEnergyDonor() { energySharing().is_energy_donor = true; }
+  void SetIsEnergyReceiver() { energySharing().is_energy_receiver = true; }
   bool& SetBornParentGroup() { return born_parent_group; } 
-  void SetHasUsedDonatedEnergy() { has_used_donated_energy = true; }
-  void SetHasOpenEnergyRequest() { has_open_energy_request = true; }
-  void ClearHasOpenEnergyRequest() { has_open_energy_request = false; }
+  void SetHasUsedDonatedEnergy() { energySharing().has_used_donated_energy = true; }
+  void SetHasOpenEnergyRequest() { energySharing().has_open_energy_request = true; }
+  void ClearHasOpenEnergyRequest() { if (m_energy_sharing) m_energy_sharing->has_open_energy_request = false; }
   void ClearIsMultiThread() { is_multi_thread = false; }
   
   void SetCurBonus(double _bonus) { cur_bonus = _bonus; }
@@ -678,20 +759,20 @@ public:
 
   void IncCurInstCount(int _inst_num)  { assert(initialized == true); cur_inst_count[_inst_num]++; } 
   void DecCurInstCount(int _inst_num)  { assert(initialized == true); cur_inst_count[_inst_num]--; }
-  void IncCurFromSensorInstCount(int _inst_num)  { assert(initialized == true); cur_from_sensor_count[_inst_num]++; }
-  void IncCurGroupAttackInstCount(int _inst_num, int pack_size_idx)  { assert(initialized == true); cur_group_attack_count[_inst_num][pack_size_idx]++; }
-  void IncCurTopPredGroupAttackInstCount(int _inst_num, int pack_size_idx)  { assert(initialized == true); cur_top_pred_group_attack_count[_inst_num][pack_size_idx]++; }
+  void IncCurFromSensorInstCount(int _inst_num)  { assert(initialized == true); sensing().cur_from_sensor_count[_inst_num]++; }
+  void IncCurGroupAttackInstCount(int _inst_num, int pack_size_idx)  { assert(initialized == true); attack().cur_group_attack_count[_inst_num][pack_size_idx]++; }
+  void IncCurTopPredGroupAttackInstCount(int _inst_num, int pack_size_idx)  { assert(initialized == true); attack().cur_top_pred_group_attack_count[_inst_num][pack_size_idx]++; }
   void IncAttackedPreyFTData(int target_ft);
-  Apto::Array<int> GetKilledPreyFTData() { return cur_killed_targets; }
-  void IncAttacks() { cur_attacks++; }
-  void IncKills() { cur_kills++; }
-  int GetLastAttacks() const { return last_attacks; }
-  int GetLastKills() const { return last_kills; }
+  Apto::Array<int> GetKilledPreyFTData() { return (m_attack) ? m_attack->cur_killed_targets : Apto::Array<int>(); }
+  void IncAttacks() { attack().cur_attacks++; }
+  void IncKills() { attack().cur_kills++; }
+  int GetLastAttacks() const { return (m_attack) ? m_attack->last_attacks : 0; }
+  int GetLastKills() const { return (m_attack) ? m_attack->last_kills : 0; }
   
-  void IncNumThreshGbDonations() { assert(initialized == true); num_thresh_gb_donations++; }
-  void IncNumQuantaThreshGbDonations() { assert(initialized == true); num_quanta_thresh_gb_donations++; }
-  void IncNumShadedGbDonations() { assert(initialized == true); num_shaded_gb_donations++; }	
-  void IncNumGreenBeardSameLocus() { assert(initialized == true); num_donations_locus++; }	
+  void IncNumThreshGbDonations() { assert(initialized == true); donation().num_thresh_gb_donations++; }
+  void IncNumQuantaThreshGbDonations() { assert(initialized == true); donation().num_quanta_thresh_gb_donations++; }
+  void IncNumShadedGbDonations() { assert(initialized == true); donation().num_shaded_gb_donations++; }	
+  void IncNumGreenBeardSameLocus() { assert(initialized == true); donation().num_donations_locus++; }	
   void IncAge()      { assert(initialized == true); age++; }
   void IncCPUCyclesUsed() { assert(initialized == true); cpu_cycles_used++; trial_cpu_cycles_used++; }
   void DecCPUCyclesUsed() { assert(initialized == true); cpu_cycles_used--; trial_cpu_cycles_used--; }
@@ -701,10 +782,10 @@ public:
   void IncDonates()   { assert(initialized == true); cur_num_donates++; }
   void IncSenseCount(const int) { /*assert(initialized == true); cur_sense_count[i]++;*/ }  
   
-  void SetCurMatingDisplayA(int _cur_mating_display_a) { cur_mating_display_a = _cur_mating_display_a; } //@CHC
-  void SetCurMatingDisplayB(int _cur_mating_display_b) { cur_mating_display_b = _cur_mating_display_b; } //@CHC
-  void SetLastMatingDisplayA(int _last_mating_display_a) { last_mating_display_a = _last_mating_display_a; } //@CHC
-  void SetLastMatingDisplayB(int _last_mating_display_b) { last_mating_display_b = _last_mating_display_b; } //@CHC
+  void SetCurMatingDisplayA(int _cur_mating_display_a) { mating().cur_mating_display_a = _cur_mating_display_a; } //@CHC
+  void SetCurMatingDisplayB(int _cur_mating_display_b) { mating().cur_mating_display_b = _cur_mating_display_b; } //@CHC
+  void SetLastMatingDisplayA(int _last_mating_display_a) { mating().last_mating_display_a = _last_mating_display_a; } //@CHC
+  void SetLastMatingDisplayB(int _last_mating_display_b) { mating().last_mating_display_b = _last_mating_display_b; } //@CHC
   
   bool& IsInjected() { assert(initialized == true); return is_injected; }
   bool& IsClone() { assert(initialized == true); return is_clone; }
@@ -737,7 +818,7 @@ public:
 
   // @LZ - Parasite Etc. Helpers
   void DivideFailed();
-  void UpdateParasiteTasks() { last_para_tasks = cur_para_tasks; cur_para_tasks.SetAll(0); return; }
+  void UpdateParasiteTasks() { if (m_parasite) m_parasite->DivideReset(); return; }
   
 
   void RefreshEnergy();
@@ -760,25 +841,43 @@ public:
 inline void cPhenotype::SetInstSetSize(int inst_set_size)
 {
   cur_inst_count.Resize(inst_set_size, 0);
-  cur_from_sensor_count.Resize(inst_set_size, 0);
   cur_from_message_count.Resize(inst_set_size, 0);
   last_inst_count.Resize(inst_set_size, 0);
-  last_from_sensor_count.Resize(inst_set_size, 0);
   last_from_message_count.Resize(inst_set_size, 0);
+  if (m_sensing) {
+    m_sensing->cur_from_sensor_count.Resize(inst_set_size, 0);
+    m_sensing->last_from_sensor_count.Resize(inst_set_size, 0);
+  }
 }
 
-inline void cPhenotype::SetGroupAttackInstSetSize(int num_group_attack_inst)
+inline void cPhenotype::SetGroupAttackInstSetSize(int in_num_group_attack_inst)
 {
-  last_group_attack_count.Resize(num_group_attack_inst);
-  last_top_pred_group_attack_count.Resize(num_group_attack_inst);
-  cur_group_attack_count.Resize(num_group_attack_inst);
-  cur_top_pred_group_attack_count.Resize(num_group_attack_inst);
-  for (int i = 0; i < last_group_attack_count.GetSize(); i++) {
-    last_group_attack_count[i].Resize(20, 0);
-    last_top_pred_group_attack_count[i].Resize(20, 0);
-    cur_group_attack_count[i].Resize(20, 0);
-    cur_top_pred_group_attack_count[i].Resize(20, 0);
-  }
+  num_group_attack_inst = in_num_group_attack_inst;
+  if (m_attack) m_attack->SetGroupAttackInstSetSize(num_group_attack_inst);
+}
+
+inline cPhenotype::sDonationState& cPhenotype::donation()
+{
+  if (!m_donation) m_donation = new sDonationState;
+  return *m_donation;
+}
+
+inline cPhenotype::sEnergySharingState& cPhenotype::energySharing()
+{
+  if (!m_energy_sharing) m_energy_sharing = new sEnergySharingState;
+  return *m_energy_sharing;
+}
+
+inline cPhenotype::sAttackState& cPhenotype::attack()
+{
+  if (!m_attack) m_attack = new sAttackState(num_group_attack_inst);
+  return *m_attack;
+}
+
+inline cPhenotype::sMatingState& cPhenotype::mating()
+{
+  if (!m_mating) m_mating = new sMatingState;
+  return *m_mating;
 }
 
 inline void cPhenotype::SetBirthCellID(int birth_cell) { birth_cell_id = birth_cell; }
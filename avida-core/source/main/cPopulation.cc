@@ -43,6 +43,7 @@
 #include "AvidaTools.h"
 
 #include "cAvidaContext.h"
+#include "cBucketedProbSchedule.h"
 #include "cCPUTestInfo.h"
 #include "cCodeLabel.h"
 #include "cDemePlaceholderUnit.h"
@@ -55,9 +56,11 @@
 #include "cOrganism.h"
 #include "cParasite.h"
 #include "cPhenotype.h"
+#include "cPhenotypeCache.h"
 #include "cPopulationCell.h"
 #include "cResource.h"
 #include "cResourceCount.h"
+#include "cResourceUpdatePool.h"
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cTopology.h"
@@ -275,6 +278,8 @@ cPopulation::cPopulation(cWorld* world)
 , num_prey_organisms(0)
 , num_pred_organisms(0)
 , num_top_pred_organisms(0)
+, m_deme_res_time(0.0)
+, m_res_update_pool(NULL)
 , sync_events(false)
 , m_hgt_resid(-1)
 {
@@ -296,6 +301,11 @@ cPopulation::cPopulation(cWorld* world)
   assert(!(m_world->GetConfig().DEMES_USE_GERMLINE.Get() && (m_world->GetConfig().MIGRATION_RATE.Get()>0.0)));
   
   
+  if (m_world->GetConfig().RESOURCE_UPDATE_THREADS.Get() != 0) {
+    m_res_update_pool = new cResourceUpdatePool(m_world->GetConfig().RESOURCE_UPDATE_THREADS.Get(),
+                                                m_world->GetConfig().RESOURCE_BAND_ROWS.Get());
+  }
+  
   SetupCellGrid();
   
   Data::ArgumentedProviderActivateFunctor activate(m_world, &cWorld::GetPopulationProvider);
@@ -355,6 +365,8 @@ void cPopulation::SetupCellGrid()
   // Broken setting:
   assert(m_world->GetConfig().DEMES_REPLICATE_SIZE.Get() <= deme_size);
   
+  resource_count.SetUpdatePool(m_res_update_pool);
+  
   // Setup the deme structures.
   Apto::Array<int> deme_cells(deme_size);
   for (int deme_id = 0; deme_id < num_demes; deme_id++) {
@@ -364,6 +376,8 @@ void cPopulation::SetupCellGrid()
       cell_array[cell_id].SetDemeID(deme_id);
     }
     deme_array[deme_id].Setup(deme_id, deme_cells, deme_size_x, m_world);
+    deme_array[deme_id].SetResourceTimeSource(&m_deme_res_time);
+    deme_array[deme_id].SetResourceUpdatePool(m_res_update_pool);
   }
   
   // Setup the topology.
@@ -604,6 +618,7 @@ cPopulation::~cPopulation()
 {
   for (int i = 0; i < cell_array.GetSize(); i++) delete cell_array[i].GetOrganism(); 
   delete m_scheduler;
+  delete m_res_update_pool;
 }
 
 
@@ -910,24 +925,23 @@ bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_
         
         int pc_phenotype = m_world->GetConfig().PRECALC_PHENOTYPE.Get();
         if (pc_phenotype) {
-          cCPUTestInfo test_info;
-          cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-          test_info.UseManualInputs(parent_cell.GetInputs()); // Test using what the environment will be
+          cPhenotypeCache::sResult test_result;
           Genome mg(parent_organism->GetGenome().HardwareType(),
                     parent_organism->GetGenome().Properties(),
                     GeneticRepresentationPtr(new InstructionSequence(parent_organism->GetHardware().GetMemory())));
-          test_cpu->TestGenome(ctx, test_info, mg); // Use the true genome
+          // Test the true genome, using what the environment will be
+          cPhenotypeCache::TestGenome(m_world, ctx, parent_organism->SystematicsGroup("genotype"), mg, &parent_cell.GetInputs(),
+                                      test_result);
           if (pc_phenotype & 1) {  // If we must update the merit
-            parent_phenotype.SetMerit(test_info.GetTestPhenotype().GetMerit());
+            parent_phenotype.SetMerit(test_result.merit);
           }
           if (pc_phenotype & 2) {  // If we must update the gestation time
-            parent_phenotype.SetGestationTime(test_info.GetTestPhenotype().GetGestationTime());
+            parent_phenotype.SetGestationTime(test_result.gestation_time);
           }
           if (pc_phenotype & 4) {  // If we must update the last instruction counts
-            parent_phenotype.SetTestCPUInstCount(test_info.GetTestPhenotype().GetLastInstCount());
+            parent_phenotype.SetTestCPUInstCount(test_result.inst_counts);
           }
           parent_phenotype.SetFitness(parent_phenotype.GetMerit().CalcFitness(parent_phenotype.GetGestationTime())); // Update fitness
-          delete test_cpu;
         }
       }
       AdjustSchedule(parent_cell, parent_phenotype.GetMerit());
@@ -1309,20 +1323,18 @@ bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, c
   // Precalculate the phenotype if requested
   int pc_phenotype = m_world->GetConfig().PRECALC_PHENOTYPE.Get();
   if (pc_phenotype){
-    cCPUTestInfo test_info;
-    cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-    test_info.UseManualInputs(target_cell.GetInputs()); // Test using what the environment will be
+    cPhenotypeCache::sResult test_result;
     Genome mg(in_organism->GetGenome().HardwareType(),
               in_organism->GetGenome().Properties(),
               GeneticRepresentationPtr(new InstructionSequence(in_organism->GetHardware().GetMemory())));
-    test_cpu->TestGenome(ctx, test_info, mg);  // Use the true genome
+    // Test the true genome, using what the environment will be
+    cPhenotypeCache::TestGenome(m_world, ctx, in_organism->SystematicsGroup("genotype"), mg, &target_cell.GetInputs(), test_result);
     
     if (pc_phenotype & 1)
-      in_organism->GetPhenotype().SetMerit(test_info.GetTestPhenotype().GetMerit());
+      in_organism->GetPhenotype().SetMerit(test_result.merit);
     if (pc_phenotype & 2)
-      in_organism->GetPhenotype().SetGestationTime(test_info.GetTestPhenotype().GetGestationTime());
+      in_organism->GetPhenotype().SetGestationTime(test_result.gestation_time);
     in_organism->GetPhenotype().SetFitness(in_organism->GetPhenotype().GetMerit().CalcFitness(in_organism->GetPhenotype().GetGestationTime()));
-    delete test_cpu;
   }
   // Update the archive...
   
@@ -1505,9 +1517,8 @@ void cPopulation::PrintMiniTraceGenome(cOrganism* in_organism, cString& filename
   Apto::RNG::AvidaRNG rng(0);
   cAvidaContext ctx2(&m_world->GetDriver(), rng);
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx2);
+  cTestCPUHandle testcpu(m_world->GetHardwareManager(), ctx2);
   testcpu->PrintGenome(ctx2, Genome(in_organism->SystematicsGroup("genotype")->Properties().Get("genome")), filename, m_world->GetStats().GetUpdate());
-  delete testcpu;
 }
 
 void cPopulation::SetMiniTraceQueue(Apto::Array<int, Apto::Smart> new_queue, const bool print_genomes, const bool print_reacs, const bool use_micro)
@@ -5682,10 +5693,8 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
   m_world->GetStats().IncExecuted();
   resource_count.Update(step_size);
   
-  // These must be done even if there is only one deme.
-  for(int i = 0; i < GetNumDemes(); i++) {
-    GetDeme(i).Update(step_size);
-  }
+  // This must be done even if there is only one deme.  Each deme pulls in elapsed time lazily on access.
+  m_deme_res_time += step_size;
   
   cDeme & deme = GetDeme(GetCell(cell_id).GetDemeID());
   deme.IncTimeUsed(merit);
@@ -5696,6 +5705,46 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
 }
 
 
+// Execute a run of up to burst_length cycles for the organism in cell_id, with the same per-cycle
+// bookkeeping as ProcessStep.  Returns the number of cycles consumed from the update.
+int cPopulation::ProcessBurst(cAvidaContext& ctx, double step_size, int cell_id, int burst_length)
+{
+  assert(step_size > 0.0);
+  assert(burst_length > 0);
+  assert(cell_id < cell_array.GetSize());
+  
+  // If cell_id is negative, no cell could be found -- stop here.
+  if (cell_id < 0) return 1;
+  
+  cPopulationCell& cell = GetCell(cell_id);
+  assert(cell.IsOccupied()); // Unoccupied cell getting processor time!
+  cOrganism* cur_org = cell.GetOrganism();
+  
+  const int executed = cell.GetHardware()->ProcessBurst(ctx, burst_length);
+  
+  double merit = cur_org->GetPhenotype().GetMerit().GetDouble();
+  if (cur_org->GetPhenotype().GetToDelete() == true) {
+    cur_org->GetHardware().DeleteMiniTrace(print_mini_trace_reacs);
+    delete cur_org;
+  }
+  
+  cStats& stats = m_world->GetStats();
+  cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
+  for (int i = 0; i < executed; i++) {
+    stats.IncExecuted();
+    deme.IncTimeUsed(merit);
+  }
+  resource_count.Update(step_size * executed);
+  m_deme_res_time += step_size * executed;
+  
+  if (GetNumDemes() >= 1) {
+    CheckImplicitDemeRepro(deme, ctx); 
+  }
+  
+  return executed;
+}
+
+
 void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, int cell_id)
 {
   assert(step_size > 0.0);
@@ -5713,6 +5762,9 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   if (cell.GetSpeculativeState()) {
     // We have already executed this instruction, just decrement the counter
     cell.DecSpeculative();
+    
+    // Once caught up with the speculative window, perform any deferred interactions
+    if (!cell.GetSpeculativeState()) hw->ResolveSpeculative(ctx);
   } else {
     // Execute the actual instruction
     if (hw->SingleProcess(ctx)) {
@@ -5729,7 +5781,7 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   
   // Deme specific
   if (GetNumDemes() > 1) {
-    for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
+    m_deme_res_time += step_size;
     
     cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
     deme.IncTimeUsed(cur_org->GetPhenotype().GetMerit().GetDouble());
@@ -5839,18 +5891,32 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
   int num_modified = 0;
   
   // Maximums...
-  cMerit max_merit(0);
+  double max_merit = 0;
   double max_fitness = 0;
   int max_gestation_time = 0;
   int max_genome_length = 0;
   
   // Minimums...
-  cMerit min_merit(FLT_MAX);
+  double min_merit = FLT_MAX;
   double min_fitness = FLT_MAX;
   int min_gestation_time = INT_MAX;
   int min_genome_length = INT_MAX;
   
-  for (int i = 0; i < live_org_list.GetSize(); i++) {  
+  // Resolve the from-message accumulators of every instruction set once per pass; organisms carry their set's index.
+  cHardwareManager& hw_mgr = m_world->GetHardwareManager();
+  Apto::Array<Apto::Array<Apto::Stat::Accumulator<int> >*> from_message_exec_counts(hw_mgr.GetNumInstSets());
+  // The first lookup of a name creates its map entry, which may reorganize the map.  Create every entry here, and discard
+  // the results, before the second loop takes their addresses.
+  for (int is = 0; is < from_message_exec_counts.GetSize(); is++) stats.InstFromMessageExeCountsForInstSet(hw_mgr.GetInstSet(is).GetInstSetName());
+  for (int is = 0; is < from_message_exec_counts.GetSize(); is++) {
+    from_message_exec_counts[is] = &stats.InstFromMessageExeCountsForInstSet(hw_mgr.GetInstSet(is).GetInstSetName());
+  }
+  
+  const int num_orgs = live_org_list.GetSize();
+  sOrgStatTable& table = m_org_stat_table;
+  table.Resize(num_orgs);
+  
+  for (int i = 0; i < num_orgs; i++) {  
     cOrganism* organism = live_org_list[i];
     
     for (int osp_idx = 0; osp_idx < m_org_stat_providers.GetSize(); osp_idx++) {
@@ -5858,39 +5924,25 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
     }
     
     const cPhenotype& phenotype = organism->GetPhenotype();
-    const cMerit cur_merit = phenotype.GetMerit();
-    const double cur_fitness = phenotype.GetFitness();
-    const int cur_gestation_time = phenotype.GetGestationTime();
-    const int cur_genome_length = phenotype.GetGenomeLength();
-    
-    Apto::Array<Apto::Stat::Accumulator<int> >& from_message_exec_counts = stats.InstFromMessageExeCountsForInstSet((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
-    for (int j = 0; j < phenotype.GetLastFromMessageInstCount().GetSize(); j++) {
-      from_message_exec_counts[j].Add(organism->GetPhenotype().GetLastFromMessageInstCount()[j]);
-    }
-
-    stats.SumFitness().Add(cur_fitness);
-    stats.SumMerit().Add(cur_merit.GetDouble());
-    stats.SumGestation().Add(phenotype.GetGestationTime());
-    stats.SumCreatureAge().Add(phenotype.GetAge());
-    stats.SumGeneration().Add(phenotype.GetGeneration());
-    stats.SumNeutralMetric().Add(phenotype.GetNeutralMetric());
-    stats.SumLineageLabel().Add(organism->GetLineageLabel());
-    stats.SumCopyMutRate().Push(organism->MutationRates().GetCopyMutProb());
-    stats.SumLogCopyMutRate().Push(log(organism->MutationRates().GetCopyMutProb()));
-    stats.SumDivMutRate().Push(organism->MutationRates().GetDivMutProb() / organism->GetPhenotype().GetDivType());
-    stats.SumLogDivMutRate().Push(log(organism->MutationRates().GetDivMutProb() / organism->GetPhenotype().GetDivType()));
-    stats.SumCopySize().Add(phenotype.GetCopiedSize());
-    stats.SumExeSize().Add(phenotype.GetExecutedSize());
-    
-    if (cur_merit > max_merit) max_merit = cur_merit;
-    if (cur_fitness > max_fitness) max_fitness = cur_fitness;
-    if (cur_gestation_time > max_gestation_time) max_gestation_time = cur_gestation_time;
-    if (cur_genome_length > max_genome_length) max_genome_length = cur_genome_length;
-    
-    if (cur_merit < min_merit) min_merit = cur_merit;
-    if (cur_fitness < min_fitness) min_fitness = cur_fitness;
-    if (cur_gestation_time < min_gestation_time) min_gestation_time = cur_gestation_time;
-    if (cur_genome_length < min_genome_length) min_genome_length = cur_genome_length;
+    
+    Apto::Array<Apto::Stat::Accumulator<int> >& org_from_message_exec_counts = *from_message_exec_counts[organism->GetInstSetID()];
+    const Apto::Array<int>& last_from_message_count = phenotype.GetLastFromMessageInstCount();
+    for (int j = 0; j < last_from_message_count.GetSize(); j++) {
+      org_from_message_exec_counts[j].Add(last_from_message_count[j]);
+    }
+
+    table.merit[i] = phenotype.GetMerit().GetDouble();
+    table.fitness[i] = phenotype.GetFitness();
+    table.neutral_metric[i] = phenotype.GetNeutralMetric();
+    table.copy_mut_prob[i] = organism->MutationRates().GetCopyMutProb();
+    table.div_mut_prob[i] = organism->MutationRates().GetDivMutProb() / phenotype.GetDivType();
+    table.gestation_time[i] = phenotype.GetGestationTime();
+    table.age[i] = phenotype.GetAge();
+    table.generation[i] = phenotype.GetGeneration();
+    table.lineage_label[i] = organism->GetLineageLabel();
+    table.genome_length[i] = phenotype.GetGenomeLength();
+    table.copied_size[i] = phenotype.GetCopiedSize();
+    table.executed_size[i] = phenotype.GetExecutedSize();
     
     // Test what tasks this creatures has completed.
     for (int j = 0; j < m_world->GetEnvironment().GetNumTasks(); j++) {
@@ -5913,11 +5965,11 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
         stats.AddLastHostTask(j);
       }
       
-      if (phenotype.GetCurParasiteTaskCount()[j] > 0) {
+      if (phenotype.GetCurParasiteTaskCount(j) > 0) {
         stats.AddCurParasiteTask(j);
       }
       
-      if (phenotype.GetLastParasiteTaskCount()[j] > 0) {
+      if (phenotype.GetLastParasiteTaskCount(j) > 0) {
         stats.AddLastParasiteTask(j);
       }
       
@@ -5957,9 +6009,9 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
     
     // Test what resource combinations this creature has sensed
     for (int j = 0; j < stats.GetSenseSize(); j++) {
-      if (phenotype.GetLastSenseCount()[j] > 0) {
+      if (phenotype.GetLastSenseCount(j) > 0) {
         stats.AddLastSense(j);
-        stats.IncLastSenseExeCount(j, phenotype.GetLastSenseCount()[j]);
+        stats.IncLastSenseExeCount(j, phenotype.GetLastSenseCount(j));
       }
     }
     
@@ -5973,13 +6025,51 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
     if (phenotype.IsModified()) num_modified++;
     
     cHardwareBase& hardware = organism->GetHardware();
-    stats.SumMemSize().Add(hardware.GetMemory().GetSize());
-    num_threads += hardware.GetNumThreads();
+    table.mem_size[i] = hardware.GetMemory().GetSize();
+    table.num_threads[i] = hardware.GetNumThreads();
     
     // Increment the age of this organism.
     organism->GetPhenotype().IncAge();
   }
   
+  // Reduce the gathered columns.  Each sum is still taken in live organism order.
+  for (int i = 0; i < num_orgs; i++) stats.SumFitness().Add(table.fitness[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumMerit().Add(table.merit[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumGestation().Add(table.gestation_time[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumCreatureAge().Add(table.age[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumGeneration().Add(table.generation[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumNeutralMetric().Add(table.neutral_metric[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumLineageLabel().Add(table.lineage_label[i]);
+  for (int i = 0; i < num_orgs; i++) {
+    stats.SumCopyMutRate().Push(table.copy_mut_prob[i]);
+    stats.SumLogCopyMutRate().Push(log(table.copy_mut_prob[i]));
+  }
+  for (int i = 0; i < num_orgs; i++) {
+    stats.SumDivMutRate().Push(table.div_mut_prob[i]);
+    stats.SumLogDivMutRate().Push(log(table.div_mut_prob[i]));
+  }
+  for (int i = 0; i < num_orgs; i++) stats.SumCopySize().Add(table.copied_size[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumExeSize().Add(table.executed_size[i]);
+  for (int i = 0; i < num_orgs; i++) stats.SumMemSize().Add(table.mem_size[i]);
+  for (int i = 0; i < num_orgs; i++) num_threads += table.num_threads[i];
+  
+  for (int i = 0; i < num_orgs; i++) {
+    if (table.merit[i] > max_merit) max_merit = table.merit[i];
+    if (table.merit[i] < min_merit) min_merit = table.merit[i];
+  }
+  for (int i = 0; i < num_orgs; i++) {
+    if (table.fitness[i] > max_fitness) max_fitness = table.fitness[i];
+    if (table.fitness[i] < min_fitness) min_fitness = table.fitness[i];
+  }
+  for (int i = 0; i < num_orgs; i++) {
+    if (table.gestation_time[i] > max_gestation_time) max_gestation_time = table.gestation_time[i];
+    if (table.gestation_time[i] < min_gestation_time) min_gestation_time = table.gestation_time[i];
+  }
+  for (int i = 0; i < num_orgs; i++) {
+    if (table.genome_length[i] > max_genome_length) max_genome_length = table.genome_length[i];
+    if (table.genome_length[i] < min_genome_length) min_genome_length = table.genome_length[i];
+  }
+  
   stats.SetBreedTrueCreatures(num_breed_true);
   stats.SetNumNoBirthCreatures(num_no_birth);
   stats.SetNumParasites(num_parasites);
@@ -5988,12 +6078,12 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
   stats.SetNumThreads(num_threads);
   stats.SetNumModified(num_modified);
   
-  stats.SetMaxMerit(max_merit.GetDouble());
+  stats.SetMaxMerit(max_merit);
   stats.SetMaxFitness(max_fitness);
   stats.SetMaxGestationTime(max_gestation_time);
   stats.SetMaxGenomeLength(max_genome_length);
   
-  stats.SetMinMerit(min_merit.GetDouble());
+  stats.SetMinMerit(min_merit);
   stats.SetMinFitness(min_fitness);
   stats.SetMinGestationTime(min_gestation_time);
   stats.SetMinGenomeLength(min_genome_length);
@@ -6001,6 +6091,24 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
   resource_count.UpdateGlobalResources(ctx);   
 }
 
+void cPopulation::sOrgStatTable::Resize(int num_orgs)
+{
+  merit.Resize(num_orgs);
+  fitness.Resize(num_orgs);
+  neutral_metric.Resize(num_orgs);
+  copy_mut_prob.Resize(num_orgs);
+  div_mut_prob.Resize(num_orgs);
+  gestation_time.Resize(num_orgs);
+  age.Resize(num_orgs);
+  generation.Resize(num_orgs);
+  lineage_label.Resize(num_orgs);
+  genome_length.Resize(num_orgs);
+  copied_size.Resize(num_orgs);
+  executed_size.Resize(num_orgs);
+  mem_size.Resize(num_orgs);
+  num_threads.Resize(num_orgs);
+}
+
 void cPopulation::UpdateFTOrgStats(cAvidaContext&) 
 {
   // Get per-org stats seperately for pred and prey
@@ -6051,8 +6159,8 @@ void cPopulation::UpdateFTOrgStats(cAvidaContext&)
         prey_inst_exe_counts[j].Add(organism->GetPhenotype().GetLastInstCount()[j]);
       }
       Apto::Array<Apto::Stat::Accumulator<int> >& prey_from_sensor_exec_counts = stats.InstPreyFromSensorExeCountsForInstSet((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
-      for (int j = 0; j < phenotype.GetLastFromSensorInstCount().GetSize(); j++) {
-        prey_from_sensor_exec_counts[j].Add(organism->GetPhenotype().GetLastFromSensorInstCount()[j]);
+      for (int j = 0; j < phenotype.GetLastInstCount().GetSize(); j++) {
+        prey_from_sensor_exec_counts[j].Add(organism->GetPhenotype().GetLastFromSensorInstCount(j));
       }
     }
     else if (organism->IsPredFT()) {
@@ -6070,15 +6178,15 @@ void cPopulation::UpdateFTOrgStats(cAvidaContext&)
       }
 
       Apto::Array<Apto::Stat::Accumulator<int> >& pred_from_sensor_exec_counts = stats.InstPredFromSensorExeCountsForInstSet((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
-      for (int j = 0; j < phenotype.GetLastFromSensorInstCount().GetSize(); j++) {
-        pred_from_sensor_exec_counts[j].Add(organism->GetPhenotype().GetLastFromSensorInstCount()[j]);
+      for (int j = 0; j < phenotype.GetLastInstCount().GetSize(); j++) {
+        pred_from_sensor_exec_counts[j].Add(organism->GetPhenotype().GetLastFromSensorInstCount(j));
       }
 
       Apto::Array<cString> att_inst = m_world->GetStats().GetGroupAttackInsts((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
       for (int k = 0; k < att_inst.GetSize(); k++) {
         Apto::Array<Apto::Stat::Accumulator<int> >& group_attack_inst_exe_counts = stats.ExecCountsForGroupAttackInst((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue(), att_inst[k]);
-        for (int j = 0; j < phenotype.GetLastGroupAttackInstCount()[k].GetSize(); j++) {
-          group_attack_inst_exe_counts[j].Add(organism->GetPhenotype().GetLastGroupAttackInstCount()[k][j]);
+        for (int j = 0; j < cPhenotype::NUM_GROUP_ATTACK_PACK_SIZES; j++) {
+          group_attack_inst_exe_counts[j].Add(organism->GetPhenotype().GetLastGroupAttackInstCount(k, j));
         }
       }
     }
@@ -6096,14 +6204,14 @@ void cPopulation::UpdateFTOrgStats(cAvidaContext&)
         tpred_inst_exe_counts[j].Add(organism->GetPhenotype().GetLastInstCount()[j]);
       }
       Apto::Array<Apto::Stat::Accumulator<int> >& tpred_from_sensor_exec_counts = stats.InstTopPredFromSensorExeCountsForInstSet((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
-      for (int j = 0; j < phenotype.GetLastFromSensorInstCount().GetSize(); j++) {
-        tpred_from_sensor_exec_counts[j].Add(organism->GetPhenotype().GetLastFromSensorInstCount()[j]);
+      for (int j = 0; j < phenotype.GetLastInstCount().GetSize(); j++) {
+        tpred_from_sensor_exec_counts[j].Add(organism->GetPhenotype().GetLastFromSensorInstCount(j));
       }
       Apto::Array<cString> att_inst = m_world->GetStats().GetGroupAttackInsts((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
       for (int k = 0; k < att_inst.GetSize(); k++) {
         Apto::Array<Apto::Stat::Accumulator<int> >& group_attack_inst_exe_counts = stats.ExecCountsForGroupAttackInst((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue(), att_inst[k]);
-        for (int j = 0; j < phenotype.GetLastTopPredGroupAttackInstCount()[k].GetSize(); j++) {
-          group_attack_inst_exe_counts[j].Add(organism->GetPhenotype().GetLastTopPredGroupAttackInstCount()[k][j]);
+        for (int j = 0; j < cPhenotype::NUM_GROUP_ATTACK_PACK_SIZES; j++) {
+          group_attack_inst_exe_counts[j].Add(organism->GetPhenotype().GetLastTopPredGroupAttackInstCount(k, j));
         }
       }
     }
@@ -6190,6 +6298,9 @@ void cPopulation::ProcessPreUpdate()
 {
   resource_count.SetSpatialUpdate(m_world->GetStats().GetUpdate());
   for (int i = 0; i < deme_array.GetSize(); i++) deme_array[i].ProcessPreUpdate();   
+  
+  // All demes have been rebased onto the shared clock, restart it for the new update
+  m_deme_res_time = 0.0;
 }
 
 void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
@@ -7304,6 +7415,12 @@ void cPopulation::BuildTimeSlicer()
       m_scheduler = new Apto::Scheduler::ProbabilisticIntegrated(cell_array.GetSize(), rng);
     }
       break;
+    case SLICE_BUCKETED_PROB_MERIT:
+    {
+      Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_world->GetRandom().GetInt(0x7FFFFFFF)));
+      m_scheduler = new cBucketedProbSchedule(cell_array.GetSize(), rng);
+    }
+      break;
     default:
       cout << "error: requested time slicer not found." << endl;
       m_world->GetDriver().Abort(Avida::INVALID_CONFIG);
@@ -7759,6 +7876,7 @@ void cPopulation::PrintParasitePhenotypeData(const cString& filename)
   double average_shannon_diversity = 0.0;
   int num_orgs = 0; //could get from elsewhere, but more self-contained this way
   double average_num_tasks = 0.0;
+  const int num_tasks = m_world->GetEnvironment().GetNumTasks();
   
   //implementing a very poor man's hash...
   Apto::Array<int> phenotypes;
@@ -7774,11 +7892,11 @@ void cPopulation::PrintParasitePhenotypeData(const cString& filename)
     int total_tasks = 0;
     int id = 0;
     cString key;
-    for (int j = 0; j < phenotype.GetLastParasiteTaskCount().GetSize(); j++) {
-      if (phenotype.GetLastParasiteTaskCount()[j] > 0) id += (1 << j);
-      if (phenotype.GetLastParasiteTaskCount()[j] > 0) average_num_tasks += 1.0;
-      key += cStringUtil::Stringf("%i-", phenotype.GetLastParasiteTaskCount()[j]);
-      total_tasks += phenotype.GetLastParasiteTaskCount()[j];
+    for (int j = 0; j < num_tasks; j++) {
+      if (phenotype.GetLastParasiteTaskCount(j) > 0) id += (1 << j);
+      if (phenotype.GetLastParasiteTaskCount(j) > 0) average_num_tasks += 1.0;
+      key += cStringUtil::Stringf("%i-", phenotype.GetLastParasiteTaskCount(j));
+      total_tasks += phenotype.GetLastParasiteTaskCount(j);
     }
     ids.insert(id);
     complete.insert(key);
@@ -7801,9 +7919,9 @@ void cPopulation::PrintParasitePhenotypeData(const cString& filename)
     // go through again to calculate Shannon Diversity of task counts
     // now that we know the total number of tasks done
     double shannon_diversity = 0;
-    for (int j = 0; j < phenotype.GetLastParasiteTaskCount().GetSize(); j++) {
-      if (phenotype.GetLastParasiteTaskCount()[j] == 0) continue;
-      double fraction = static_cast<double>(phenotype.GetLastParasiteTaskCount()[j]) / static_cast<double>(total_tasks);
+    for (int j = 0; j < num_tasks; j++) {
+      if (phenotype.GetLastParasiteTaskCount(j) == 0) continue;
+      double fraction = static_cast<double>(phenotype.GetLastParasiteTaskCount(j)) / static_cast<double>(total_tasks);
       shannon_diversity -= fraction * log(fraction) / log(2.0);
     }
     
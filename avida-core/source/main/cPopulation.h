@@ -44,6 +44,7 @@ class cEnvironment;
 class cLineage;
 class cOrganism;
 class cPopulationCell;
+class cResourceUpdatePool;
 
 using namespace Avida;
 
@@ -82,6 +83,28 @@ private:
   
   Apto::Array<cPopulationOrgStatProviderPtr> m_org_stat_providers;
   
+  // Per-organism scalar stats, gathered in live organism order by UpdateOrganismStats and then reduced column by column
+  struct sOrgStatTable
+  {
+    Apto::Array<double> merit;
+    Apto::Array<double> fitness;
+    Apto::Array<double> neutral_metric;
+    Apto::Array<double> copy_mut_prob;
+    Apto::Array<double> div_mut_prob;
+    Apto::Array<int> gestation_time;
+    Apto::Array<int> age;
+    Apto::Array<int> generation;
+    Apto::Array<int> lineage_label;
+    Apto::Array<int> genome_length;
+    Apto::Array<int> copied_size;
+    Apto::Array<int> executed_size;
+    Apto::Array<int> mem_size;
+    Apto::Array<int> num_threads;
+    
+    void Resize(int num_orgs);
+  };
+  sOrgStatTable m_org_stat_table;
+  
   
   Apto::Array<pair<int,int>, Apto::Smart>* sleep_log;
   
@@ -112,6 +135,8 @@ private:
   int num_top_pred_organisms;
   
   Apto::Array<cDeme> deme_array;            // Deme structure of the population.
+  double m_deme_res_time;                   // Time elapsed this update, shared by all deme resource counts
+  cResourceUpdatePool* m_res_update_pool;   // Threads shared by the population and deme resource counts (NULL = serial)
  
   // Outside interactions...
   bool sync_events;   // Do we need to sync up the event list with population?
@@ -259,6 +284,7 @@ public:
   int ScheduleOrganism();          // Determine next organism to be processed.
   void ProcessStep(cAvidaContext& ctx, double step_size, int cell_id);
   void ProcessStepSpeculative(cAvidaContext& ctx, double step_size, int cell_id);
+  int ProcessBurst(cAvidaContext& ctx, double step_size, int cell_id, int burst_length);
 
   // Calculate the statistics from the most recent update.
   void ProcessPostUpdate(cAvidaContext& ctx);
@@ -24,6 +24,7 @@
 
 #include "avida/core/Feedback.h"
 #include "cDoubleSum.h"
+#include "cHardwareBase.h"
 #include "nHardware.h"
 #include "cOrganism.h"
 #include "cWorld.h"
@@ -301,6 +302,10 @@ cOrganism * cPopulationCell::RemoveOrganism(cAvidaContext& ctx)
 		 && m_world->GetConfig().FRAC_ENERGY_DECAY_AT_DEME_BIRTH.Get() != 1.0) { // hack
     m_world->GetPopulation().GetDeme(m_deme_id).GiveBackCellEnergy(m_cell_id, m_organism->GetPhenotype().GetStoredEnergy() * m_world->GetConfig().FRAC_ENERGY_TRANSFER.Get(), ctx);
   }
+  // Any remaining speculative window was executed for nothing
+  if (m_spec_state) m_world->GetStats().AddSpeculativeWaste(m_spec_state, m_hardware->GetType());
+  m_spec_state = 0;
+  
   m_organism = NULL;
   m_hardware = NULL;
   return out_organism;
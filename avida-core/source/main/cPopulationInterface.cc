@@ -32,6 +32,7 @@
 #include "cOrganism.h"
 #include "cOrgMessage.h"
 #include "cPopulation.h"
+#include "cResourceView.h"
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cInstSet.h"
@@ -398,6 +399,17 @@ const Apto::Array< Apto::Array<int> >& cPopulationInterface::GetCellIdLists()
 	return m_world->GetPopulation().GetCellIdLists();
 }
 
+cResourceView cPopulationInterface::GetResourceView(cAvidaContext& ctx)
+{
+  // Cell resources followed by this deme's resources, read on demand rather than copied
+  cPopulation& pop = m_world->GetPopulation();
+  cDeme& deme = pop.GetDeme(m_deme_id);
+  cResourceView view = pop.GetResourceCount().GetCellResourceView(m_cell_id, ctx);
+  view.Append(deme.GetDemeResourceCount().GetCellResourceView(deme.GetRelativeCellID(m_cell_id), ctx));
+  view.SetCellIdLists(pop.GetCellIdLists(), m_cell_id);
+  return view;
+}
+
 int cPopulationInterface::GetCurrPeakX(cAvidaContext& ctx, int res_id) 
 { 
   return m_world->GetPopulation().GetCurrPeakX(ctx, res_id); 
@@ -2380,6 +2392,15 @@ const Apto::Array<double>& cPopulationInterface::GetAVResources(cAvidaContext& c
   return m_world->GetPopulation().GetCellResources(m_avatars[av_num].av_cell_id, ctx);
 }
 
+cResourceView cPopulationInterface::GetAVResourceView(cAvidaContext& ctx, int av_num)
+{
+  assert(av_num < GetNumAV());
+  cPopulation& pop = m_world->GetPopulation();
+  cResourceView view = pop.GetResourceCount().GetCellResourceView(m_avatars[av_num].av_cell_id, ctx);
+  view.SetCellIdLists(pop.GetCellIdLists(), m_avatars[av_num].av_cell_id);
+  return view;
+}
+
 double cPopulationInterface::GetAVResourceVal(cAvidaContext& ctx, int res_id, int av_num)
 {
   assert(av_num < GetNumAV());
@@ -121,6 +121,7 @@ public:
   double GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id);
   const Apto::Array<double>& GetDemeResources(int deme_id, cAvidaContext& ctx); 
   const Apto::Array< Apto::Array<int> >& GetCellIdLists();
+  cResourceView GetResourceView(cAvidaContext& ctx);
   int GetCurrPeakX(cAvidaContext& ctx, int res_id); 
   int GetCurrPeakY(cAvidaContext& ctx, int res_id);
   int GetFrozenPeakX(cAvidaContext& ctx, int res_id); 
@@ -319,6 +320,7 @@ public:
   Apto::Array<cOrganism*> GetCellAVs(int cell_id, int av_num = 0);
   Apto::Array<cOrganism*> GetFacedPreyAVs(int av_num = 0);
   const Apto::Array<double>& GetAVResources(cAvidaContext& ctx, int av_num = 0);
+  cResourceView GetAVResourceView(cAvidaContext& ctx, int av_num = 0);
   double GetAVResourceVal(cAvidaContext& ctx, int res_id, int av_num = 0);
   const Apto::Array<double>& GetAVFacedResources(cAvidaContext& ctx, int av_num = 0);
   double GetAVFacedResourceVal(cAvidaContext& ctx, int res_id, int av_num = 0);
@@ -23,6 +23,8 @@
 #include "cResourceCount.h"
 #include "cResource.h"
 #include "cGradientCount.h"
+#include "cResourceUpdatePool.h"
+#include "cResourceView.h"
 #include "cWorld.h"
 #include "cStats.h"
 
@@ -35,73 +37,17 @@ using namespace std;
 const double cResourceCount::UPDATE_STEP(1.0 / 10000.0);
 const double cResourceCount::EPSILON (1.0e-15);
 const int cResourceCount::PRECALC_DISTANCE(100);
+const int cResourceCount::PARALLEL_MIN_CELLS(4096);
 
 
-void FlowMatter(cSpatialCountElem &elem1, cSpatialCountElem &elem2, 
-                double inxdiffuse, 
-                double inydiffuse, double inxgravity, double inygravity,
-                int xdist, int ydist, double dist) {
-
-  /* Routine to calculate the amount of flow from one Element to another.
-     Amount of flow is a function of:
-
-       1) Amount of material in each cell (will try to equalize)
-       2) Distance between each cell
-       3) x and y "gravity"
-
-     This method only effect the delta amount of each element.  The State
-     method will need to be called at the end of each time step to complete
-     the movement of material.
-  */
-
-  double  diff, flowamt, xgravity, xdiffuse, ygravity,  ydiffuse;
-
-  if (((elem1.amount == 0.0) && (elem2.amount == 0.0)) && (dist < 0.0)) return;
-  diff = (elem1.amount - elem2.amount);
-  if (xdist != 0) {
-
-    /* if there is material to be effected by x gravity */
-
-    if (((xdist>0) && (inxgravity>0.0)) || ((xdist<0) && (inxgravity<0.0))) {
-      xgravity = elem1.amount * fabs(inxgravity)/3.0;
-    } else {
-      xgravity = -elem2.amount * fabs(inxgravity)/3.0;
-    }
-    
-    /* Diffusion uses the diffusion constant x half the difference (as the 
-       elements attempt to equalize) / the number of possible neighbors (8) */
-
-    xdiffuse = inxdiffuse * diff / 16.0;
-  } else {
-    xdiffuse = 0.0;
-    xgravity = 0.0;
-  }  
-  if (ydist != 0) {
-
-    /* if there is material to be effected by y gravity */
-
-    if (((ydist>0) && (inygravity>0.0)) || ((ydist<0) && (inygravity<0.0))) {
-      ygravity = elem1.amount * fabs(inygravity)/3.0;
-    } else {
-      ygravity = -elem2.amount * fabs(inygravity)/3.0;
-    }
-    ydiffuse = inydiffuse * diff / 16.0;
-  } else {
-    ydiffuse = 0.0;
-    ygravity = 0.0;
-  }  
-
-  flowamt = ((xdiffuse + ydiffuse + xgravity + ygravity)/
-             (fabs(xdist*1.0) + fabs(ydist*1.0)))/dist;
-  elem1.delta -= flowamt;
-  elem2.delta += flowamt;
-}
-
 cResourceCount::cResourceCount(int num_resources)
   : update_time(0.0)
   , spatial_update_time(0.0)
   , m_last_updated(0)
   , m_spatial_update(0)
+  , m_time_source(NULL)
+  , m_time_synced(0.0)
+  , m_update_pool(NULL)
 {
   if(num_resources > 0) {
     SetSize(num_resources);
@@ -110,7 +56,11 @@ cResourceCount::cResourceCount(int num_resources)
   return;
 }
 
-cResourceCount::cResourceCount(const cResourceCount &rc) {
+cResourceCount::cResourceCount(const cResourceCount &rc)
+  : m_time_source(rc.m_time_source)
+  , m_time_synced(rc.m_time_synced)
+  , m_update_pool(rc.m_update_pool)
+{
   *this = rc;
 
   return;
@@ -330,7 +280,6 @@ void cResourceCount::Setup(cWorld* world, const int& res_index, const cString& n
   inflow_rate[res_index] = inflow;
   geometry[res_index] = in_geometry;
   spatial_resource_count[res_index]->SetGeometry(in_geometry);
-  spatial_resource_count[res_index]->SetPointers();
   spatial_resource_count[res_index]->SetCellList(in_cell_list_ptr);
 
   double step_decay = pow(decay, UPDATE_STEP);
@@ -565,6 +514,13 @@ const Apto::Array<double> & cResourceCount::GetCellResources(int cell_id, cAvida
 
 }
 
+cResourceView cResourceCount::GetCellResourceView(int cell_id, cAvidaContext& ctx) const
+// Bring the counts up to date, as GetCellResources does, but leave the amounts in place to be read on demand.
+{
+  DoUpdates(ctx);
+  return cResourceView(*this, cell_id);
+}
+
 const Apto::Array<double> & cResourceCount::GetFrozenResources(cAvidaContext&, int cell_id) const
 // Get amount of the resource for a given cell in the grid.  If it is a
 // global resource pass out the entire content of that resource.
@@ -655,7 +611,7 @@ void cResourceCount::ModifyCell(cAvidaContext& ctx, const Apto::Array<double> &
         resource_count[i] += res_change[i];
       assert(resource_count[i] >= 0.0);
     } else {
-      double temp = spatial_resource_count[i]->Element(cell_id).GetAmount();
+      double temp = spatial_resource_count[i]->GetAmount(cell_id);
       spatial_resource_count[i]->Rate(cell_id, res_change[i]);
       /* Ideally the state of the cell's resource should not be set till
          the end of the update so that all processes (inflow, outflow, 
@@ -664,10 +620,10 @@ void cResourceCount::ModifyCell(cAvidaContext& ctx, const Apto::Array<double> &
          the organism demand to work immediately on the state of the resource */ 
     
       spatial_resource_count[i]->State(cell_id);
-      if(spatial_resource_count[i]->Element(cell_id).GetAmount() != temp){
+      if(spatial_resource_count[i]->GetAmount(cell_id) != temp){
         spatial_resource_count[i]->SetModified(true);
       }
-      assert(spatial_resource_count[i]->Element(cell_id).GetAmount() >= 0.0);
+      assert(spatial_resource_count[i]->GetAmount(cell_id) >= 0.0);
     }
   }
 }
@@ -750,9 +706,46 @@ int cResourceCount::GetMaxUsedY(int res_id)
   return spatial_resource_count[res_id]->GetMaxUsedY();
 }
 
+int cResourceCount::GetMinDirtyX(int res_id)
+{
+  return spatial_resource_count[res_id]->GetMinDirtyX();
+}
+
+int cResourceCount::GetMinDirtyY(int res_id)
+{
+  return spatial_resource_count[res_id]->GetMinDirtyY();
+}
+
+int cResourceCount::GetMaxDirtyX(int res_id)
+{
+  return spatial_resource_count[res_id]->GetMaxDirtyX();
+}
+
+int cResourceCount::GetMaxDirtyY(int res_id)
+{
+  return spatial_resource_count[res_id]->GetMaxDirtyY();
+}
+
+bool cResourceCount::TracksChanges(int res_id) const
+{
+  return spatial_resource_count[res_id]->TracksChanges();
+}
+
+cSpatialResCount::sChangeStamp cResourceCount::GetChangeStamp(int res_id) const
+{
+  return spatial_resource_count[res_id]->GetChangeStamp();
+}
+
+bool cResourceCount::GetChangedSince(int res_id, const cSpatialResCount::sChangeStamp& stamp,
+                                     cSpatialResCount::sCellBox& changed) const
+{
+  return spatial_resource_count[res_id]->GetChangedSince(stamp, changed);
+}
+
 ///// Private Methods /////////
 void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
 { 
+  syncTimeSource();
   assert(update_time >= -EPSILON);
 
   // Determine how many update steps have progressed
@@ -784,21 +777,150 @@ void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
   // If one (or more) complete update has occured update the spatial resources
   while (m_spatial_update > m_last_updated) {
     m_last_updated++;
+    if (m_update_pool) {
+      updateSpatialParallel(ctx);
+      continue;
+    }
     for (int i = 0; i < resource_count.GetSize(); i++) {
      if (geometry[i] != nGeometry::GLOBAL && geometry[i] != nGeometry::PARTIAL) {
-        spatial_resource_count[i]->UpdateCount(ctx);
-        spatial_resource_count[i]->Source(inflow_rate[i]);
-        spatial_resource_count[i]->Sink(decay_rate[i]);
-        if (spatial_resource_count[i]->GetCellListSize() > 0) {
-          spatial_resource_count[i]->CellInflow();
-          spatial_resource_count[i]->CellOutflow();
+        updateSpatialResource(ctx, i);
+      }
+    }
+  }
+}
+
+void cResourceCount::updateSpatialResource(cAvidaContext& ctx, int res_id) const
+{
+  cSpatialResCount* res = spatial_resource_count[res_id];
+  res->UpdateCount(ctx);
+  res->Source(inflow_rate[res_id]);
+  res->Sink(decay_rate[res_id]);
+  if (res->GetCellListSize() > 0) {
+    res->CellInflow();
+    res->CellOutflow();
+  }
+  res->FlowAll();
+  res->StateAll();
+  // BDB: resource_count[i] = spatial_resource_count[i]->SumAll();
+}
+
+
+namespace {
+  // Source, Sink and the cell list flows of each resource, plus the per-link flow of each row band.  The flow of a link
+  // only reads amounts, which none of the first group touch, so both may run at once.
+  class cSpatialInflowTask : public cResourceUpdatePool::cTask
+  {
+  private:
+    const Apto::Array<cSpatialResCount*>& m_res;
+    const Apto::Array<double>& m_inflow;
+    const Apto::Array<double>& m_decay;
+    const Apto::Array<int>& m_batch;
+    const Apto::Array<int>& m_band_res;
+    const Apto::Array<int>& m_band_start;
+    const Apto::Array<int>& m_band_end;
+    
+  public:
+    cSpatialInflowTask(const Apto::Array<cSpatialResCount*>& res, const Apto::Array<double>& inflow,
+                       const Apto::Array<double>& decay, const Apto::Array<int>& batch, const Apto::Array<int>& band_res,
+                       const Apto::Array<int>& band_start, const Apto::Array<int>& band_end)
+      : m_res(res), m_inflow(inflow), m_decay(decay), m_batch(batch)
+      , m_band_res(band_res), m_band_start(band_start), m_band_end(band_end) { ; }
+    
+    void Process(int item)
+    {
+      if (item < m_batch.GetSize()) {
+        const int res_id = m_batch[item];
+        cSpatialResCount* res = m_res[res_id];
+        res->Source(m_inflow[res_id]);
+        res->Sink(m_decay[res_id]);
+        if (res->GetCellListSize() > 0) {
+          res->CellInflow();
+          res->CellOutflow();
         }
-        spatial_resource_count[i]->FlowAll();
-        spatial_resource_count[i]->StateAll();
-        // BDB: resource_count[i] = spatial_resource_count[i]->SumAll();
+      } else {
+        item -= m_batch.GetSize();
+        cSpatialResCount* res = m_res[m_band_res[item]];
+        if (res->HasFlow()) res->FlowLinks(m_band_start[item], m_band_end[item]);
       }
     }
+  };
+  
+  // Gathers the link flows into each cell and folds the pending changes into the amounts, one row band at a time
+  class cSpatialStateTask : public cResourceUpdatePool::cTask
+  {
+  private:
+    const Apto::Array<cSpatialResCount*>& m_res;
+    const Apto::Array<int>& m_band_res;
+    const Apto::Array<int>& m_band_start;
+    const Apto::Array<int>& m_band_end;
+    
+  public:
+    cSpatialStateTask(const Apto::Array<cSpatialResCount*>& res, const Apto::Array<int>& band_res,
+                      const Apto::Array<int>& band_start, const Apto::Array<int>& band_end)
+      : m_res(res), m_band_res(band_res), m_band_start(band_start), m_band_end(band_end) { ; }
+    
+    void Process(int item)
+    {
+      cSpatialResCount* res = m_res[m_band_res[item]];
+      if (res->HasFlow()) res->FlowGather(m_band_start[item], m_band_end[item]);
+      res->StateRows(m_band_start[item], m_band_end[item]);
+    }
+  };
+}
+
+// Spatial resources only touch their own grid, so they may be updated concurrently and in row bands while leaving the
+// numerics of each cell unchanged.  Gradient resources move, draw random numbers and act on the population, so they
+// are updated on the calling thread, in resource order, with everything before them finished first.
+void cResourceCount::updateSpatialParallel(cAvidaContext& ctx) const
+{
+  Apto::Array<int> batch;
+  int batch_cells = 0;
+  
+  for (int i = 0; i < resource_count.GetSize(); i++) {
+    if (geometry[i] == nGeometry::GLOBAL || geometry[i] == nGeometry::PARTIAL) continue;
+    
+    if (spatial_resource_count[i]->IsGradient()) {
+      updateSpatialBatch(ctx, batch, batch_cells);
+      batch.Resize(0);
+      batch_cells = 0;
+      updateSpatialResource(ctx, i);
+    } else {
+      batch.Push(i);
+      batch_cells += spatial_resource_count[i]->GetSize();
+    }
   }
+  updateSpatialBatch(ctx, batch, batch_cells);
+}
+
+void cResourceCount::updateSpatialBatch(cAvidaContext& ctx, const Apto::Array<int>& batch, int batch_cells) const
+{
+  if (batch.GetSize() == 0) return;
+  
+  if (batch_cells < PARALLEL_MIN_CELLS) {
+    for (int i = 0; i < batch.GetSize(); i++) updateSpatialResource(ctx, batch[i]);
+    return;
+  }
+  
+  // Split each grid into bands of rows
+  const int band_rows = m_update_pool->GetBandRows();
+  Apto::Array<int> band_res;
+  Apto::Array<int> band_start;
+  Apto::Array<int> band_end;
+  for (int i = 0; i < batch.GetSize(); i++) {
+    const int rows = spatial_resource_count[batch[i]]->GetY();
+    for (int y = 0; y < rows; y += band_rows) {
+      band_res.Push(batch[i]);
+      band_start.Push(y);
+      band_end.Push((y + band_rows < rows) ? (y + band_rows) : rows);
+    }
+  }
+  
+  // UpdateCount is a no-op for everything but gradient resources, which never make it into a batch
+  cSpatialInflowTask inflow_task(spatial_resource_count, inflow_rate, decay_rate, batch, band_res, band_start, band_end);
+  m_update_pool->Run(inflow_task, batch.GetSize() + band_res.GetSize());
+  
+  cSpatialStateTask state_task(spatial_resource_count, band_res, band_start, band_end);
+  m_update_pool->Run(state_task, band_res.GetSize());
 }
 
 void cResourceCount::ReinitializeResources(cAvidaContext& ctx, double additional_resource)
@@ -31,6 +31,8 @@
 #include "tMatrix.h"
 #include "nGeometry.h"
 
+class cResourceUpdatePool;
+class cResourceView;
 class cWorld;
 
 
@@ -57,12 +59,24 @@ private:
   mutable int m_last_updated;
   mutable int m_spatial_update;
 
+  // Optional shared clock, advanced by the owner and pulled in lazily (replaces per-step calls to Update)
+  const double* m_time_source;
+  mutable double m_time_synced;
+
+  // Optional worker threads for the spatial resource updates (not owned)
+  cResourceUpdatePool* m_update_pool;
+
   void DoUpdates(cAvidaContext& ctx, bool global_only = false) const;         // Update resource count based on update time
+  inline void syncTimeSource() const;
+  void updateSpatialResource(cAvidaContext& ctx, int res_id) const;
+  void updateSpatialParallel(cAvidaContext& ctx) const;
+  void updateSpatialBatch(cAvidaContext& ctx, const Apto::Array<int>& batch, int batch_cells) const;
 
   // A few constants to describe update process...
   static const double UPDATE_STEP;   // Fraction of an update per step
   static const double EPSILON;       // Tolorance for round off errors
   static const int PRECALC_DISTANCE; // Number of steps to precalculate
+  static const int PARALLEL_MIN_CELLS; // Smallest batch of spatial cells worth handing to the update pool
   
 public:
   cResourceCount(int num_resources = 0);
@@ -127,6 +141,9 @@ public:
   void SetDecay(const cString& name, const double _decay);
   
   void Update(double in_time);
+  void SetTimeSource(const double* time_source) { m_time_source = time_source; m_time_synced = (time_source) ? *time_source : 0.0; }
+  void RebaseTimeSource() { syncTimeSource(); m_time_synced = 0.0; } // call just before the shared clock is reset to zero
+  void SetUpdatePool(cResourceUpdatePool* pool) { m_update_pool = pool; }
 
   int GetSize(void) const { return resource_count.GetSize(); }
   const Apto::Array<double>& ReadResources(void) const { return resource_count; }
@@ -135,6 +152,8 @@ public:
   const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) const;
   double GetFrozenCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const;
   double GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const;
+  cResourceView GetCellResourceView(int cell_id, cAvidaContext& ctx) const;
+  inline double GetCellAmount(int cell_id, int res_id) const;
   const Apto::Array<int>& GetResourcesGeometry() const;
   int GetResourceGeometry(int res_id) const { return geometry[res_id]; }
   const Apto::Array<Apto::Array<double> >& GetSpatialRes(cAvidaContext& ctx);
@@ -162,6 +181,13 @@ public:
   int GetMinUsedY(int res_id);
   int GetMaxUsedX(int res_id);
   int GetMaxUsedY(int res_id);
+  int GetMinDirtyX(int res_id);
+  int GetMinDirtyY(int res_id);
+  int GetMaxDirtyX(int res_id);
+  int GetMaxDirtyY(int res_id);
+  bool TracksChanges(int res_id) const;
+  cSpatialResCount::sChangeStamp GetChangeStamp(int res_id) const;
+  bool GetChangedSince(int res_id, const cSpatialResCount::sChangeStamp& stamp, cSpatialResCount::sCellBox& changed) const;
   
   void SetSpatialUpdate(int update) { m_spatial_update = update; }
   void UpdateGlobalResources(cAvidaContext& ctx) { DoUpdates(ctx, true); }
@@ -169,4 +195,23 @@ public:
   void UpdateResources(cAvidaContext& ctx) { DoUpdates(ctx, false); }
 };
 
+
+inline void cResourceCount::syncTimeSource() const
+{
+  if (!m_time_source) return;
+  
+  const double elapsed = *m_time_source - m_time_synced;
+  update_time += elapsed;
+  spatial_update_time += elapsed;
+  m_time_synced = *m_time_source;
+}
+
+
+inline double cResourceCount::GetCellAmount(int cell_id, int res_id) const
+// Amount of a single resource in a cell, without bringing the counts up to date first.
+{
+  if (geometry[res_id] == nGeometry::GLOBAL || geometry[res_id] == nGeometry::PARTIAL) return resource_count[res_id];
+  return spatial_resource_count[res_id]->GetAmount(cell_id);
+}
+
 #endif
@@ -0,0 +1,134 @@
+/*
+ *  cResourceUpdatePool.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cResourceUpdatePool.h"
+
+#include "apto/platform.h"
+
+
+class cResourceUpdatePool::cWorker : public Apto::Thread
+{
+private:
+  cResourceUpdatePool* m_pool;
+
+  void Run();
+
+public:
+  cWorker(cResourceUpdatePool* pool) : m_pool(pool) { ; }
+};
+
+
+cResourceUpdatePool::cResourceUpdatePool(int num_threads, int band_rows)
+  : m_band_rows((band_rows > 0) ? band_rows : 1), m_task(NULL), m_next_item(0), m_num_items(0)
+  , m_pass(0), m_pending(0), m_terminate(false)
+{
+  if (num_threads < 0) num_threads = Apto::Platform::AvailableCPUs();
+  if (num_threads < 1) num_threads = 1;
+
+  // The calling thread takes part in every task, additional threads are only needed beyond that
+  m_workers.Resize(num_threads - 1);
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i] = new cWorker(this);
+    m_workers[i]->Start();
+  }
+}
+
+cResourceUpdatePool::~cResourceUpdatePool()
+{
+  m_mutex.Lock();
+  m_terminate = true;
+  m_mutex.Unlock();
+  m_cond.Broadcast();
+
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+}
+
+
+void cResourceUpdatePool::Run(cTask& task, int num_items)
+{
+  if (num_items <= 0) return;
+
+  // Nothing to share, skip the hand off
+  if (num_items == 1 || !m_workers.GetSize()) {
+    for (int i = 0; i < num_items; i++) task.Process(i);
+    return;
+  }
+
+  m_mutex.Lock();
+  m_task = &task;
+  m_next_item = 0;
+  m_num_items = num_items;
+  m_pending = m_workers.GetSize();
+  m_pass++;
+  m_mutex.Unlock();
+  m_cond.Broadcast();
+
+  processItems();
+
+  m_mutex.Lock();
+  while (m_pending > 0) m_done_cond.Wait(m_mutex);
+  m_task = NULL;
+  m_mutex.Unlock();
+}
+
+
+void cResourceUpdatePool::processItems()
+{
+  while (true) {
+    m_mutex.Lock();
+    if (m_next_item >= m_num_items) {
+      m_mutex.Unlock();
+      return;
+    }
+    const int item = m_next_item++;
+    cTask* task = m_task;
+    m_mutex.Unlock();
+
+    task->Process(item);
+  }
+}
+
+
+void cResourceUpdatePool::cWorker::Run()
+{
+  int last_pass = 0;
+
+  while (true) {
+    m_pool->m_mutex.Lock();
+    while (m_pool->m_pass == last_pass && !m_pool->m_terminate) m_pool->m_cond.Wait(m_pool->m_mutex);
+    if (m_pool->m_terminate) {
+      m_pool->m_mutex.Unlock();
+      break;
+    }
+    last_pass = m_pool->m_pass;
+    m_pool->m_mutex.Unlock();
+
+    m_pool->processItems();
+
+    m_pool->m_mutex.Lock();
+    int pending = --m_pool->m_pending;
+    m_pool->m_mutex.Unlock();
+    if (!pending) m_pool->m_done_cond.Signal();
+  }
+}
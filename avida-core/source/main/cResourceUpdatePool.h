@@ -0,0 +1,80 @@
+/*
+ *  cResourceUpdatePool.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cResourceUpdatePool_h
+#define cResourceUpdatePool_h
+
+#include "apto/core.h"
+#include "apto/core/Thread.h"
+
+
+// cResourceUpdatePool - Worker threads shared by every cResourceCount of a population (the main grid and each deme)
+//
+// Run() hands out the items [0, num_items) of a task to the workers and to the calling thread, returning once every
+// item has been processed.  Items are claimed one at a time, so they should be coarse: a whole resource, or a band of
+// rows of a large grid.
+
+class cResourceUpdatePool
+{
+public:
+  class cTask
+  {
+  public:
+    virtual ~cTask() { ; }
+    virtual void Process(int item) = 0;
+  };
+
+private:
+  class cWorker;
+
+  Apto::Array<cWorker*> m_workers;
+  int m_band_rows;
+
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_cond;
+  Apto::ConditionVariable m_done_cond;
+  cTask* m_task;
+  int m_next_item;
+  int m_num_items;
+  volatile int m_pass;      // incremented to release the workers for a new task
+  volatile int m_pending;   // count of workers still processing the current task
+  volatile bool m_terminate;
+
+
+  cResourceUpdatePool(); // @not_implemented
+  cResourceUpdatePool(const cResourceUpdatePool&); // @not_implemented
+  cResourceUpdatePool& operator=(const cResourceUpdatePool&); // @not_implemented
+
+public:
+  cResourceUpdatePool(int num_threads, int band_rows);
+  ~cResourceUpdatePool();
+
+  int GetNumThreads() const { return m_workers.GetSize() + 1; }
+  int GetBandRows() const { return m_band_rows; }
+
+  //! Process every item of the task, blocking until all have completed.
+  void Run(cTask& task, int num_items);
+
+private:
+  void processItems();
+};
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ *  cResourceView.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cResourceView_h
+#define cResourceView_h
+
+#include "cResourceCount.h"
+
+#include <cassert>
+
+
+// cResourceView - Non-owning, read-on-demand view of the resources available in a single cell
+//
+// A view is made of up to two consecutive sources (the cell resources, followed by the deme resources), each of which
+// is either a cResourceCount read at a fixed cell or a plain array of amounts.  Amounts are only looked up when
+// indexed, so testing an output no longer copies every resource in the environment.  The view does not bring the
+// underlying counts up to date; cResourceCount::GetCellResourceView does that once when the view is created.
+//
+// Cell id lists (see cResourceCount::GetCellIdLists) can be applied to the view, in which case any resource whose
+// list is non-empty and does not contain the given cell reads as zero.
+
+class cResourceView
+{
+private:
+  struct sSource
+  {
+    const cResourceCount* res_count;
+    const Apto::Array<double>* amounts;
+    int cell_id;
+    int size;
+  };
+
+  sSource m_src[2];
+  const Apto::Array<Apto::Array<int> >* m_cell_id_lists;
+  int m_list_cell_id;
+
+public:
+  cResourceView() : m_cell_id_lists(NULL), m_list_cell_id(-1) { setSource(m_src[0], NULL, NULL, -1, 0); setSource(m_src[1], NULL, NULL, -1, 0); }
+  cResourceView(const cResourceCount& res_count, int cell_id) : m_cell_id_lists(NULL), m_list_cell_id(-1)
+  {
+    setSource(m_src[0], &res_count, NULL, cell_id, res_count.GetSize());
+    setSource(m_src[1], NULL, NULL, -1, 0);
+  }
+  explicit cResourceView(const Apto::Array<double>& amounts) : m_cell_id_lists(NULL), m_list_cell_id(-1)
+  {
+    setSource(m_src[0], NULL, &amounts, -1, amounts.GetSize());
+    setSource(m_src[1], NULL, NULL, -1, 0);
+  }
+
+  //! Place the first source of another view after this view's own resources (e.g. deme resources after cell ones).
+  void Append(const cResourceView& view) { m_src[1] = view.m_src[0]; }
+  void SetCellIdLists(const Apto::Array<Apto::Array<int> >& cell_id_lists, int cell_id)
+  {
+    m_cell_id_lists = (cell_id_lists.GetSize()) ? &cell_id_lists : NULL;
+    m_list_cell_id = cell_id;
+  }
+
+  int GetSize() const { return m_src[0].size + m_src[1].size; }
+  int GetNumCellResources() const { return m_src[0].size; }
+  int GetNumAppendedResources() const { return m_src[1].size; }
+
+  inline double operator[](int res_id) const;
+
+private:
+  static void setSource(sSource& src, const cResourceCount* res_count, const Apto::Array<double>* amounts, int cell_id, int size)
+  {
+    src.res_count = res_count;
+    src.amounts = amounts;
+    src.cell_id = cell_id;
+    src.size = size;
+  }
+
+  inline bool isMasked(int res_id) const;
+};
+
+
+inline double cResourceView::operator[](int res_id) const
+{
+  assert(res_id >= 0 && res_id < GetSize());
+
+  if (m_cell_id_lists && isMasked(res_id)) return 0.0;
+
+  const sSource* src = &m_src[0];
+  if (res_id >= src->size) {
+    res_id -= src->size;
+    src = &m_src[1];
+  }
+  if (src->res_count) return src->res_count->GetCellAmount(src->cell_id, res_id);
+  return (*src->amounts)[res_id];
+}
+
+inline bool cResourceView::isMasked(int res_id) const
+{
+  if (res_id >= m_cell_id_lists->GetSize()) return false;
+
+  const Apto::Array<int>& cells = (*m_cell_id_lists)[res_id];
+  if (!cells.GetSize()) return false;
+  for (int i = 0; i < cells.GetSize(); i++) if (cells[i] == m_list_cell_id) return false;
+  return true;
+}
+
+#endif
@@ -29,53 +29,125 @@
 using namespace std;
 using namespace AvidaTools;
 
+namespace {
+  // The four forward links of a cell, flow across the remaining four is handled by the neighbor that owns the link
+  struct sFlowLink
+  {
+    int dx;
+    int dy;
+    double dist;
+  };
+  
+  const sFlowLink s_flow_links[4] = {
+    { +1,  0, 1.0 },
+    { +1, +1, sqrt(2.0) },
+    {  0, +1, 1.0 },
+    { -1, +1, sqrt(2.0) }
+  };
+  
+  /* Routine to calculate the amount of flow from one cell to another.
+     Amount of flow is a function of:
+   
+       1) Amount of material in each cell (will try to equalize)
+       2) Distance between each cell
+       3) x and y "gravity"
+   */
+  inline double FlowAmount(double amount1, double amount2, const sFlowLink& link,
+                           double inxdiffuse, double inydiffuse, double inxgravity, double inygravity)
+  {
+    double  diff, xgravity, xdiffuse, ygravity, ydiffuse;
+    const int xdist = link.dx;
+    const int ydist = link.dy;
+    
+    diff = (amount1 - amount2);
+    if (xdist != 0) {
+      
+      /* if there is material to be effected by x gravity */
+      
+      if (((xdist>0) && (inxgravity>0.0)) || ((xdist<0) && (inxgravity<0.0))) {
+        xgravity = amount1 * fabs(inxgravity)/3.0;
+      } else {
+        xgravity = -amount2 * fabs(inxgravity)/3.0;
+      }
+      
+      /* Diffusion uses the diffusion constant x half the difference (as the 
+         elements attempt to equalize) / the number of possible neighbors (8) */
+      
+      xdiffuse = inxdiffuse * diff / 16.0;
+    } else {
+      xdiffuse = 0.0;
+      xgravity = 0.0;
+    }  
+    if (ydist != 0) {
+      
+      /* if there is material to be effected by y gravity */
+      
+      if (((ydist>0) && (inygravity>0.0)) || ((ydist<0) && (inygravity<0.0))) {
+        ygravity = amount1 * fabs(inygravity)/3.0;
+      } else {
+        ygravity = -amount2 * fabs(inygravity)/3.0;
+      }
+      ydiffuse = inydiffuse * diff / 16.0;
+    } else {
+      ydiffuse = 0.0;
+      ygravity = 0.0;
+    }  
+    
+    return ((xdiffuse + ydiffuse + xgravity + ygravity) / (fabs(xdist*1.0) + fabs(ydist*1.0))) / link.dist;
+  }
+  
+  // Flow across one link for a contiguous run of cells, written as a straight loop over flat arrays so that it vectorizes
+  inline void FlowSpan(const double* src, const double* dst, double* out, int count, const sFlowLink& link,
+                       double inxdiffuse, double inydiffuse, double inxgravity, double inygravity)
+  {
+    for (int i = 0; i < count; i++) {
+      out[i] = FlowAmount(src[i], dst[i], link, inxdiffuse, inydiffuse, inxgravity, inygravity);
+    }
+  }
+}
+
+
 /* Setup a single spatial resource with known flows */
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry, double inxdiffuse, double inydiffuse,
                                    double inxgravity, double inygravity)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: m_initial(0.0), m_modified(false), m_track_changes(false), m_change_generation(0), m_change_count(0)
+, m_prev_change_count(0)
 {
-  int i;
- 
+  ClearBox(m_dirty);
+  ClearBox(m_prev_dirty);
+  ClearBox(m_touched);
   xdiffuse = inxdiffuse;
   ydiffuse = inydiffuse;
   xgravity = inxgravity;
   ygravity = inygravity;
-  world_x = inworld_x;
-  world_y = inworld_y;
   geometry = ingeometry;
-  num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-  } 
-  SetPointers();
+  resizeGrid(inworld_x, inworld_y);
 }
 
 /* Setup a single spatial resource using default flow amounts  */
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: m_initial(0.0), m_modified(false), m_track_changes(false), m_change_generation(0), m_change_count(0)
+, m_prev_change_count(0)
 {
-  int i;
- 
+  ClearBox(m_dirty);
+  ClearBox(m_prev_dirty);
+  ClearBox(m_touched);
   xdiffuse = 1.0;
   ydiffuse = 1.0;
   xgravity = 0.0;
   ygravity = 0.0;
-  world_x = inworld_x;
-  world_y = inworld_y;
   geometry = ingeometry;
-  num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-   } 
-   SetPointers();
+  resizeGrid(inworld_x, inworld_y);
 }
 
 cSpatialResCount::cSpatialResCount() : m_initial(0.0), xdiffuse(1.0), ydiffuse(1.0), xgravity(0.0), ygravity(0.0), m_modified(false)
+, m_track_changes(false), m_change_generation(0), m_change_count(0), m_prev_change_count(0)
 {
+  ClearBox(m_dirty);
+  ClearBox(m_prev_dirty);
+  ClearBox(m_touched);
   geometry = nGeometry::GLOBAL;
 }
 
@@ -84,69 +156,24 @@ cSpatialResCount::~cSpatialResCount() { ; }
 
 void cSpatialResCount::ResizeClear(int inworld_x, int inworld_y, int ingeometry)
 {
-  int i;
- 
-  grid.ResizeClear(inworld_x * inworld_y); 
-  world_x = inworld_x;
-  world_y = inworld_y;
   geometry = ingeometry;
-  num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-   } 
-   SetPointers();
+  resizeGrid(inworld_x, inworld_y);
 }
 
-void cSpatialResCount::SetPointers()
+void cSpatialResCount::resizeGrid(int inworld_x, int inworld_y)
 {
-  /* Pointer 0 will point to the cell above and to the left the current cell
-     and will go clockwise around the cell.                               */
-
-  int     i,ii;
-  double  SQRT2 = sqrt(2.0);
-
-  /* First treat all cells like they are in a torus */
-
-  for (i = 0; i < GetSize(); i++) {
-    grid[i].SetPtr(0 ,GridNeighbor(i, world_x, world_y, -1, -1), -1, -1, SQRT2);
-    grid[i].SetPtr(1 ,GridNeighbor(i, world_x, world_y,  0, -1),  0, -1, 1.0);
-    grid[i].SetPtr(2 ,GridNeighbor(i, world_x, world_y, +1, -1), +1, -1, SQRT2);
-    grid[i].SetPtr(3 ,GridNeighbor(i, world_x, world_y, +1,  0), +1,  0, 1.0);
-    grid[i].SetPtr(4 ,GridNeighbor(i, world_x, world_y, +1, +1), +1, +1, SQRT2);
-    grid[i].SetPtr(5 ,GridNeighbor(i, world_x, world_y,  0, +1),  0, +1, 1.0);
-    grid[i].SetPtr(6 ,GridNeighbor(i, world_x, world_y, -1, +1), -1, +1, SQRT2);
-    grid[i].SetPtr(7 ,GridNeighbor(i, world_x, world_y, -1,  0), -1,  0, 1.0);
-  }
- 
-  /* Fix links for top, bottom and sides for non-torus */
+  world_x = inworld_x;
+  world_y = inworld_y;
+  num_cells = world_x * world_y;
   
-  if (geometry == nGeometry::GRID) {
-    /* Top and bottom */
-
-    for (i = 0; i < world_x; i++) {
-      grid[i].SetPtr(0, -99, -99, -99, -99.0);
-      grid[i].SetPtr(1, -99, -99, -99, -99.0);
-      grid[i].SetPtr(2, -99, -99, -99, -99.0);
-      ii = num_cells-1-i;
-      grid[ii].SetPtr(4, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(5, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(6, -99, -99, -99, -99.0);
-    }
-
-    /* fix links for right and left sides */
-
-    for (i = 0; i < world_y; i++) {
-      ii = i * world_x;    
-      grid[ii].SetPtr(0, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(7, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(6, -99, -99, -99, -99.0);
-      ii = ((i + 1) * world_x) - 1;
-      grid[ii].SetPtr(2, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(3, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(4, -99, -99, -99, -99.0);
-    }
-  }
+  m_amount.ResizeClear(num_cells);
+  m_delta.ResizeClear(num_cells);
+  m_cell_initial.ResizeClear(num_cells);
+  m_amount.SetAll(0.0);
+  m_delta.SetAll(0.0);
+  m_cell_initial.SetAll(0.0);
+  for (int k = 0; k < 4; k++) m_flow[k].ResizeClear(num_cells);
+  markAllChanged();
 }
 
 
@@ -222,10 +249,10 @@ void cSpatialResCount::SetCellList(Apto::Array<cCellResource>* in_cell_list_ptr)
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id <= grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < GetSize()) {
       Rate((*cell_list_ptr)[i].GetId(), (*cell_list_ptr)[i].GetInitial());
       State((*cell_list_ptr)[i].GetId());
-      Element(cell_id).SetInitial((*cell_list_ptr)[i].GetInitial());
+      m_cell_initial[cell_id] = (*cell_list_ptr)[i].GetInitial();
     }
   }
 }
@@ -233,8 +260,8 @@ void cSpatialResCount::SetCellList(Apto::Array<cCellResource>* in_cell_list_ptr)
 /* Set the rate variable for one element using the array index */
 
 void cSpatialResCount::Rate(int x, double ratein) const {
-  if (x >= 0 && x < grid.GetSize()) {
-    grid[x].Rate(ratein);
+  if (x >= 0 && x < GetSize()) {
+    m_delta[x] += ratein;
   } else {
     assert(false); // x not valid id
   }
@@ -244,7 +271,7 @@ void cSpatialResCount::Rate(int x, double ratein) const {
 
 void cSpatialResCount::Rate(int x, int y, double ratein) const { 
   if (x >= 0 && x < world_x && y>= 0 && y < world_y) {
-    grid[y * world_x + x].Rate(ratein);
+    m_delta[y * world_x + x] += ratein;
   } else {
     assert(false); // x or y not valid id
   }
@@ -254,8 +281,11 @@ void cSpatialResCount::Rate(int x, int y, double ratein) const {
    the array index */
    
 void cSpatialResCount::State(int x) { 
-  if (x >= 0 && x < grid.GetSize()) {
-    grid[x].State();
+  if (x >= 0 && x < GetSize()) {
+    const double delta = m_delta[x];
+    m_amount[x] += delta;
+    m_delta[x] = 0.0;
+    if (delta != 0.0) markChanged(x);
   } else {
     assert(false); // x not valid id
   }
@@ -266,7 +296,7 @@ void cSpatialResCount::State(int x) {
    
 void cSpatialResCount::State(int x, int y) { 
   if (x >= 0 && x < world_x && y >= 0 && y < world_y) {
-    grid[y*world_x + x].State();
+    State(y * world_x + x);
   } else {
     assert(false); // x or y not valid id
   }
@@ -275,8 +305,8 @@ void cSpatialResCount::State(int x, int y) {
 /* Get the state of one element using the array index */
 
 double cSpatialResCount::GetAmount(int x) const { 
-  if (x >= 0 && x < grid.GetSize()) {
-    return grid[x].GetAmount(); 
+  if (x >= 0 && x < GetSize()) {
+    return m_amount[x]; 
   } else {
     return -99.9;
   }
@@ -286,59 +316,193 @@ double cSpatialResCount::GetAmount(int x) const {
 
 double cSpatialResCount::GetAmount(int x, int y) const { 
   if (x >= 0 && x < world_x && y >= 0 && y < world_y) {
-    return grid[y*world_x + x].GetAmount(); 
+    return m_amount[y * world_x + x]; 
   } else {
     return -99.9;
   }
 }
 
 void cSpatialResCount::RateAll(double ratein) {
-
-  int i;
- 
-  for (i = 0; i < num_cells; i++) {
-    grid[i].Rate(ratein);
-  } 
+  if (!num_cells) return;
+  
+  double* delta = &m_delta[0];
+  for (int i = 0; i < num_cells; i++) delta[i] += ratein;
 }
 
 /* For each cell in the grid add the changes stored in the rate variable
    with the total of the resource */
 
 void cSpatialResCount::StateAll() {
+  StateRows(0, world_y);
+}
 
-  int i;
- 
-  for (i = 0; i < num_cells; i++) {
-    grid[i].State();
-  } 
+void cSpatialResCount::StateRows(int y_begin, int y_end)
+{
+  if (!num_cells) return;
+  
+  double* amount = &m_amount[0];
+  double* delta = &m_delta[0];
+  for (int i = y_begin * world_x; i < y_end * world_x; i++) {
+    amount[i] += delta[i];
+    delta[i] = 0.0;
+  }
+  markChangedRows(y_begin, y_end);
 }
 
+/* Flow is calculated once per link, then each cell gathers the flow across its eight links.  The gather applies the
+   contributions to a cell's delta in the same order as a single pass over the cells that pushes the flow of each
+   cell's forward links to both ends, so the results are identical to that scheme.  Interior rows take a fixed order
+   and run as straight loops, while cells on the edge of the world sort their contributions individually. */
+
 void cSpatialResCount::FlowAll() {
 
   // @JEB save time if diffusion and gravity off...
-  if ((xdiffuse == 0.0) && (ydiffuse == 0.0) && (xgravity == 0.0) && (ygravity == 0.0)) return;
+  if (!HasFlow()) return;
+  
+  FlowLinks(0, world_y);
+  FlowGather(0, world_y);
+}
 
-  int     i,k,ii,xdist,ydist;
-  double  dist;
- 
-  for (i = 0; i < num_cells; i++) {
+void cSpatialResCount::FlowLinks(int y_begin, int y_end)
+{
+  if (!num_cells) return;
+  
+  const bool bounded = (geometry == nGeometry::GRID);
+  const double* amount = &m_amount[0];
+  
+  for (int k = 0; k < 4; k++) {
+    const sFlowLink& link = s_flow_links[k];
+    double* flow = &m_flow[k][0];
+    
+    for (int y = y_begin; y < y_end; y++) {
+      int ty = y + link.dy;
+      if (ty >= world_y) {
+        if (bounded) continue;
+        ty -= world_y;
+      }
       
-    /* because flow is two way we must check only half the neighbors to 
-       prevent double flow calculations */
-
-    for (k = 3; k <= 6; k++) {
-      ii = grid[i].GetElemPtr(k);
-      xdist = grid[i].GetPtrXdist(k);
-      ydist = grid[i].GetPtrYdist(k);
-      dist = grid[i].GetPtrDist(k);
-      if (ii >= 0) {
-        FlowMatter(grid[i],grid[ii],xdiffuse,ydiffuse,xgravity,ygravity,
-                   xdist, ydist, dist);
+      const double* src = amount + y * world_x;
+      const double* dst = amount + ty * world_x;
+      double* out = flow + y * world_x;
+      
+      // Links that stay within the row span, then the one that wraps around the edge (if any)
+      if (link.dx > 0) {
+        FlowSpan(src, dst + 1, out, world_x - 1, link, xdiffuse, ydiffuse, xgravity, ygravity);
+        if (!bounded) {
+          out[world_x - 1] = FlowAmount(src[world_x - 1], dst[0], link, xdiffuse, ydiffuse, xgravity, ygravity);
+        }
+      } else if (link.dx < 0) {
+        FlowSpan(src + 1, dst, out + 1, world_x - 1, link, xdiffuse, ydiffuse, xgravity, ygravity);
+        if (!bounded) {
+          out[0] = FlowAmount(src[0], dst[world_x - 1], link, xdiffuse, ydiffuse, xgravity, ygravity);
+        }
+      } else {
+        FlowSpan(src, dst, out, world_x, link, xdiffuse, ydiffuse, xgravity, ygravity);
       }
     }
   }
 }
 
+void cSpatialResCount::FlowGather(int y_begin, int y_end)
+{
+  if (!num_cells) return;
+  
+  for (int y = y_begin; y < y_end; y++) {
+    if (y == 0 || y == world_y - 1) {
+      for (int x = 0; x < world_x; x++) accumulateFlowCell(y * world_x + x);
+    } else {
+      accumulateFlowCell(y * world_x);
+      accumulateFlowRow(y);
+      if (world_x > 1) accumulateFlowCell(y * world_x + world_x - 1);
+    }
+  }
+}
+
+// Interior cells of row y (neither the first/last row nor the first/last column) receive flow from the cells up-left,
+// up, up-right and left of them, all of which precede them in cell order, and then send flow across their own links
+void cSpatialResCount::accumulateFlowRow(int y)
+{
+  const int row = y * world_x;
+  const double* f0 = &m_flow[0][0];
+  const double* f1 = &m_flow[1][0];
+  const double* f2 = &m_flow[2][0];
+  const double* f3 = &m_flow[3][0];
+  double* delta = &m_delta[0];
+  
+  for (int i = row + 1; i < row + world_x - 1; i++) {
+    double d = delta[i];
+    d += f1[i - world_x - 1];
+    d += f2[i - world_x];
+    d += f3[i - world_x + 1];
+    d += f0[i - 1];
+    d -= f0[i];
+    d -= f1[i];
+    d -= f2[i];
+    d -= f3[i];
+    delta[i] = d;
+  }
+}
+
+// Cells on the edge of the world may receive flow from cells that follow them (wrap around) or lose links (bounded),
+// so their contributions are ordered explicitly by the cell that owns each link
+void cSpatialResCount::accumulateFlowCell(int cell_id)
+{
+  struct sContrib
+  {
+    int owner;
+    int link;
+    bool out;
+  };
+  
+  const bool bounded = (geometry == nGeometry::GRID);
+  const int x = cell_id % world_x;
+  const int y = cell_id / world_x;
+  
+  sContrib contribs[8];
+  int num_contribs = 0;
+  
+  for (int k = 0; k < 4; k++) {
+    const sFlowLink& link = s_flow_links[k];
+    
+    // Flow out across this cell's own link
+    int tx = x + link.dx;
+    int ty = y + link.dy;
+    if (!bounded || (tx >= 0 && tx < world_x && ty < world_y)) {
+      contribs[num_contribs].owner = cell_id;
+      contribs[num_contribs].link = k;
+      contribs[num_contribs].out = true;
+      num_contribs++;
+    }
+    
+    // Flow in across the same link owned by the neighbor on the opposite side
+    int sx = x - link.dx;
+    int sy = y - link.dy;
+    if (bounded && (sx < 0 || sx >= world_x || sy < 0)) continue;
+    const int owner = Mod(sy, world_y) * world_x + Mod(sx, world_x);
+    contribs[num_contribs].owner = owner;
+    contribs[num_contribs].link = k;
+    contribs[num_contribs].out = false;
+    num_contribs++;
+  }
+  
+  // Stable insertion sort by owner, then link; for a cell linked to itself the outflow stays ahead of the inflow
+  for (int i = 1; i < num_contribs; i++) {
+    sContrib cur = contribs[i];
+    int j = i - 1;
+    while (j >= 0 && (contribs[j].owner > cur.owner || (contribs[j].owner == cur.owner && contribs[j].link > cur.link))) {
+      contribs[j + 1] = contribs[j];
+      j--;
+    }
+    contribs[j + 1] = cur;
+  }
+  
+  for (int i = 0; i < num_contribs; i++) {
+    const double flow = m_flow[contribs[i].link][contribs[i].owner];
+    if (contribs[i].out) m_delta[cell_id] -= flow;
+    else m_delta[cell_id] += flow;
+  }
+}
+
 /* Total up all the resources in each cell */
 
 double cSpatialResCount::SumAll() const{
@@ -356,16 +520,18 @@ double cSpatialResCount::SumAll() const{
    inflow rectange */
 
 void cSpatialResCount::Source(double amount) const {
-  int     i, j, elem;
+  int     i, j;
   double  totalcells;
 
   totalcells = (inflowY2 - inflowY1 + 1) * (inflowX2 - inflowX1 + 1) * 1.0;
   amount /= totalcells;
 
   for (i = inflowY1; i <= inflowY2; i++) {
+    double* row = &m_delta[Mod(i, world_y) * world_x];
+    int col = Mod(inflowX1, world_x);
     for (j = inflowX1; j <= inflowX2; j++) {
-      elem = (Mod(i,world_y) * world_x) + Mod(j,world_x);
-      Rate(elem,amount); 
+      row[col] += amount;
+      if (++col == world_x) col = 0;
     }
   }
 }
@@ -379,7 +545,7 @@ void cSpatialResCount::CellInflow() const {
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id < grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < GetSize()) {
       Rate(cell_id, (*cell_list_ptr)[i].GetInflow());
     }
   }
@@ -389,16 +555,19 @@ void cSpatialResCount::CellInflow() const {
 
 void cSpatialResCount::Sink(double decay) const {
 
-  int     i, j, elem;
-  double  deltaamount;
+  int     i, j;
 
   if (outflowX1 == -99 || outflowY1 == -99 || outflowX2 == -99 || outflowY2 == -99) return;
   
+  const double keep = 1.0 - decay;
   for (i = outflowY1; i <= outflowY2; i++) {
+    const int row = Mod(i, world_y) * world_x;
+    const double* amount = &m_amount[row];
+    double* delta = &m_delta[row];
+    int col = Mod(outflowX1, world_x);
     for (j = outflowX1; j <= outflowX2; j++) {
-      elem = (Mod(i,world_y) * world_x) + Mod(j,world_x);
-      deltaamount = Apto::Max((GetAmount(elem) * (1.0 - decay)), 0.0);
-      Rate(elem,-deltaamount); 
+      delta[col] -= Apto::Max((amount[col] * keep), 0.0);
+      if (++col == world_x) col = 0;
     }
   }
 }
@@ -415,7 +584,7 @@ void cSpatialResCount::CellOutflow() const {
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id < grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < GetSize()) {
       deltaamount = Apto::Max((GetAmount(cell_id) * (*cell_list_ptr)[i].GetOutflow()), 0.0);
     }                     
     Rate((*cell_list_ptr)[i].GetId(), -deltaamount); 
@@ -424,14 +593,91 @@ void cSpatialResCount::CellOutflow() const {
 
 void cSpatialResCount::SetCellAmount(int cell_id, double res)
 {
-  if (cell_id >= 0 && cell_id < grid.GetSize())
+  if (cell_id >= 0 && cell_id < GetSize())
   {
-    Element(cell_id).SetAmount(res);
+    // writing the value a cell already holds is not a change
+    if (m_amount[cell_id] != res) markChanged(cell_id);
+    m_amount[cell_id] = res;
   }
 }
 
 
 void cSpatialResCount::ResetResourceCounts()
 {
-  for (int i = 0; i < grid.GetSize(); i++) grid[i].ResetResourceCount(m_initial);
+  for (int i = 0; i < GetSize(); i++) m_amount[i] = m_initial + m_cell_initial[i];
+  markAllChanged();
+}
+
+
+cSpatialResCount::sChangeStamp cSpatialResCount::GetChangeStamp() const
+{
+  sChangeStamp stamp;
+  stamp.generation = m_change_generation;
+  stamp.changes = m_change_count;
+  return stamp;
+}
+
+/* Find the box of cells that may have changed since the stamp was taken.  Returns false when that is no longer known,
+   because tracking is off or the stamp is older than the previous generation, in which case any cell may have changed. */
+
+bool cSpatialResCount::GetChangedSince(const sChangeStamp& stamp, sCellBox& changed) const
+{
+  ClearBox(changed);
+  if (!m_track_changes) return false;
+  if (stamp.changes == m_change_count) return true;
+  
+  if (stamp.generation == m_change_generation) {
+    changed = m_dirty;
+    return true;
+  }
+  if (stamp.generation + 1 == m_change_generation) {
+    changed = m_dirty;
+    if (stamp.changes != m_prev_change_count) GrowBox(changed, m_prev_dirty);
+    return true;
+  }
+  return false;
+}
+
+void cSpatialResCount::GrowBox(sCellBox& box, const sCellBox& other)
+{
+  if (IsEmptyBox(other)) return;
+  GrowBox(box, other.min_x, other.min_y);
+  GrowBox(box, other.max_x, other.max_y);
+}
+
+bool cSpatialResCount::BoxesOverlap(const sCellBox& box1, const sCellBox& box2)
+{
+  if (IsEmptyBox(box1) || IsEmptyBox(box2)) return false;
+  return box1.min_x <= box2.max_x && box2.min_x <= box1.max_x && box1.min_y <= box2.max_y && box2.min_y <= box1.max_y;
+}
+
+void cSpatialResCount::enableChangeTracking()
+{
+  // the grid is resized after this, which marks every cell
+  m_track_changes = true;
+}
+
+void cSpatialResCount::startChangeGeneration()
+{
+  m_change_generation++;
+  m_prev_change_count = m_change_count;
+  m_prev_dirty = m_dirty;
+  ClearBox(m_dirty);
+}
+
+void cSpatialResCount::markAllChanged()
+{
+  if (num_cells > 0) markChangedRows(0, world_y);
+}
+
+// Row bands of one grid may be folded in on several threads, which is only safe while change tracking is off (gradient
+// resources, the only ones that track changes, are always updated on the calling thread)
+void cSpatialResCount::markChangedRows(int y_begin, int y_end)
+{
+  if (!m_track_changes || y_begin >= y_end) return;
+  m_change_count++;
+  GrowBox(m_dirty, 0, y_begin);
+  GrowBox(m_dirty, world_x - 1, y_end - 1);
+  GrowBox(m_touched, 0, y_begin);
+  GrowBox(m_touched, world_x - 1, y_end - 1);
 }
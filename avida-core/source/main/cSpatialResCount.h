@@ -26,14 +26,37 @@
 #define cSpatialResCount_h
 
 #include "cAvidaContext.h"
-#include "cSpatialCountElem.h"
 #include "cResource.h"
 
 
+// The grid is stored as flat per-cell arrays (structure of arrays).  Neighbors are implicit in the cell index: every
+// cell exchanges matter with its eight surrounding cells, wrapping at the edges for all geometries except GRID, where
+// links that would leave the world are dropped.
+//
+// Resources that enable change tracking (gradient resources) also keep bounding boxes of the cells whose amounts
+// change.  Changes are grouped into generations, which the resource starts anew each update.  The boxes of the current
+// and the previous generation are kept, so a reader holding a change stamp can find out which cells may have changed
+// since it took the stamp.  The touched box grows with every change until the resource clears it.
+
 class cSpatialResCount
 {
+public:
+  struct sCellBox {
+    int min_x;    // all -1 when the box is empty
+    int min_y;
+    int max_x;
+    int max_y;
+  };
+  struct sChangeStamp {
+    unsigned int generation;
+    unsigned int changes;
+  };
+
 private:
-  Apto::Array<cSpatialCountElem> grid;
+  mutable Apto::Array<double> m_amount;   // current amount of resource in each cell
+  mutable Apto::Array<double> m_delta;    // pending change for each cell, folded into m_amount by State()
+  Apto::Array<double> m_cell_initial;     // per-cell initial amount, from the CELL resource list
+  Apto::Array<double> m_flow[4];          // FlowAll scratch, flow across each cell's four forward links
   double m_initial;
   double xdiffuse, ydiffuse;
   double xgravity, ygravity;
@@ -46,6 +69,14 @@ private:
   Apto::Array<cCellResource> *cell_list_ptr;
   bool m_modified;
   
+  bool m_track_changes;
+  unsigned int m_change_generation;
+  unsigned int m_change_count;        // changes marked so far, over all generations
+  unsigned int m_prev_change_count;   // m_change_count when the previous generation ended
+  sCellBox m_dirty;                   // cells changed in the current generation
+  sCellBox m_prev_dirty;              // cells changed in the previous generation
+  sCellBox m_touched;                 // cells changed since the touched box was last cleared
+  
 public:
   cSpatialResCount();
   cSpatialResCount(int inworld_x, int inworld_y, int ingeometry);
@@ -55,14 +86,12 @@ public:
   virtual ~cSpatialResCount();
   
   void ResizeClear(int inworld_x, int inworld_y, int ingeometry);
-  void SetPointers();
   void CheckRanges();
   void SetCellList(Apto::Array<cCellResource> *in_cell_list_ptr);
-  int GetSize() const { return grid.GetSize(); }
+  int GetSize() const { return m_amount.GetSize(); }
   int GetX() const { return world_x; }
   int GetY() const { return world_y; }
   int GetCellListSize() const { return cell_list_ptr->GetSize(); }
-  cSpatialCountElem& Element(int x) { return grid[x]; }
   void Rate(int x, double ratein) const;
   void Rate(int x, int y, double ratein) const;
   void State(int x);
@@ -72,6 +101,15 @@ public:
   void RateAll(double ratein); 
   virtual void StateAll();
   void FlowAll(); 
+  
+  // Row band pieces of the update, for splitting a large grid across threads.  FlowLinks only reads amounts, so it may
+  // run alongside Source/Sink/CellInflow/CellOutflow; FlowGather must follow them, and StateRows must follow FlowGather.
+  bool HasFlow() const { return (xdiffuse != 0.0) || (ydiffuse != 0.0) || (xgravity != 0.0) || (ygravity != 0.0); }
+  void FlowLinks(int y_begin, int y_end);
+  void FlowGather(int y_begin, int y_end);
+  void StateRows(int y_begin, int y_end);
+  virtual bool IsGradient() const { return false; }
+  
   double SumAll() const;
   void Source(double amount) const;
   void CellInflow() const;
@@ -153,6 +191,58 @@ public:
   virtual int GetMinUsedY() { return -1; }
   virtual int GetMaxUsedX() { return -1; }
   virtual int GetMaxUsedY() { return -1; }
+  
+  // Change tracking, see above.  The dirty box covers the current generation, and is empty when tracking is off.
+  bool TracksChanges() const { return m_track_changes; }
+  int GetMinDirtyX() const { return m_dirty.min_x; }
+  int GetMinDirtyY() const { return m_dirty.min_y; }
+  int GetMaxDirtyX() const { return m_dirty.max_x; }
+  int GetMaxDirtyY() const { return m_dirty.max_y; }
+  sChangeStamp GetChangeStamp() const;
+  bool GetChangedSince(const sChangeStamp& stamp, sCellBox& changed) const;
+  
+  static void ClearBox(sCellBox& box) { box.min_x = box.min_y = box.max_x = box.max_y = -1; }
+  static bool IsEmptyBox(const sCellBox& box) { return box.min_x == -1; }
+  static inline void GrowBox(sCellBox& box, int x, int y);
+  static void GrowBox(sCellBox& box, const sCellBox& other);
+  static bool BoxesOverlap(const sCellBox& box1, const sCellBox& box2);
+
+protected:
+  void enableChangeTracking();
+  void startChangeGeneration();
+  void markAllChanged();
+  const sCellBox& getTouchedBox() const { return m_touched; }
+  void clearTouchedBox() { ClearBox(m_touched); }
+  void touchCell(int x, int y) { GrowBox(m_touched, x, y); }
+
+private:
+  inline void markChanged(int cell_id);
+  void markChangedRows(int y_begin, int y_end);
+  void resizeGrid(int inworld_x, int inworld_y);
+  void accumulateFlowRow(int y);
+  void accumulateFlowCell(int cell_id);
 };
 
+
+inline void cSpatialResCount::GrowBox(sCellBox& box, int x, int y)
+{
+  if (box.min_x == -1) {
+    box.min_x = box.max_x = x;
+    box.min_y = box.max_y = y;
+    return;
+  }
+  if (x < box.min_x) box.min_x = x;
+  else if (x > box.max_x) box.max_x = x;
+  if (y < box.min_y) box.min_y = y;
+  else if (y > box.max_y) box.max_y = y;
+}
+
+inline void cSpatialResCount::markChanged(int cell_id)
+{
+  if (!m_track_changes) return;
+  m_change_count++;
+  GrowBox(m_dirty, cell_id % world_x, cell_id / world_x);
+  GrowBox(m_touched, cell_id % world_x, cell_id / world_x);
+}
+
 #endif
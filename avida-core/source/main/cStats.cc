@@ -107,6 +107,12 @@ cStats::cStats(cWorld* world)
 , m_spec_total(0)
 , m_spec_num(0)
 , m_spec_waste(0)
+, m_hw_pool_hits(0)
+, m_hw_pool_misses(0)
+, m_test_hw_pool_hits(0)
+, m_test_hw_pool_misses(0)
+, m_pheno_cache_hits(0)
+, m_pheno_cache_misses(0)
 , num_migrations(0)
 , m_num_successful_mates(0)
 , prey_entropy(0.0)
@@ -410,6 +416,14 @@ mgr->Register(name, activate); \
   
   m_data_manager.Add("ave_speculative","Averate Speculative Instructions", &cStats::GetAveSpeculative);
   m_data_manager.Add("speculative_waste", "Speculative Execution Waste",   &cStats::GetSpeculativeWaste);
+  m_data_manager.Add("hw_pool_hits",     "Hardware Reused from Pool",     &cStats::GetHardwarePoolHits);
+  m_data_manager.Add("hw_pool_misses",   "Hardware Newly Allocated",      &cStats::GetHardwarePoolMisses);
+  m_data_manager.Add("hw_pool_hit_rate", "Hardware Pool Hit Rate",        &cStats::GetHardwarePoolHitRate);
+  m_data_manager.Add("test_hw_pool_hits",   "Test CPU Hardware Reused from Pool", &cStats::GetTestHardwarePoolHits);
+  m_data_manager.Add("test_hw_pool_misses", "Test CPU Hardware Newly Allocated",  &cStats::GetTestHardwarePoolMisses);
+  m_data_manager.Add("pheno_cache_hits",     "Phenotype Cache Hits",      &cStats::GetPhenotypeCacheHits);
+  m_data_manager.Add("pheno_cache_misses",   "Phenotype Cache Misses",    &cStats::GetPhenotypeCacheMisses);
+  m_data_manager.Add("pheno_cache_hit_rate", "Phenotype Cache Hit Rate",  &cStats::GetPhenotypeCacheHitRate);
   
   PROVIDE("core.world.ave_metabolic_rate", "Average Metabolic Rate",               double, GetAveMerit);
   PROVIDE("core.world.ave_age",            "Average Organism Age (in updates)",    double, GetAveCreatureAge);
@@ -622,12 +636,31 @@ void cStats::ProcessUpdate()
   m_spec_total = 0;
   m_spec_num = 0;
   m_spec_waste = 0;
+  m_spec_waste_hw.SetAll(0);
+  m_hw_pool_hits = 0;
+  m_hw_pool_misses = 0;
+  m_test_hw_pool_hits = 0;
+  m_test_hw_pool_misses = 0;
+  m_pheno_cache_hits = 0;
+  m_pheno_cache_misses = 0;
   
   num_migrations = 0;
   
   m_num_successful_mates = 0;
 }
 
+void cStats::AddSpeculativeWaste(int waste, int hw_type)
+{
+  m_spec_waste += waste;
+  if (hw_type < 0) return;
+  if (hw_type >= m_spec_waste_hw.GetSize()) {
+    const int old_size = m_spec_waste_hw.GetSize();
+    m_spec_waste_hw.Resize(hw_type + 1);
+    for (int i = old_size; i <= hw_type; i++) m_spec_waste_hw[i] = 0;
+  }
+  m_spec_waste_hw[hw_type] += waste;
+}
+
 int cStats::GetNumPreyCreatures() const
 {
   return m_world->GetPopulation().GetNumPreyOrganisms();
@@ -327,6 +327,19 @@ private:
   int m_spec_total;
   int m_spec_num;
   int m_spec_waste;
+  Apto::Array<int> m_spec_waste_hw;   // waste broken down by hardware type
+
+
+  // --------  Hardware Pool Stats  ---------
+  int m_hw_pool_hits;     // hardware created by recycling a released instance
+  int m_hw_pool_misses;   // hardware newly allocated
+  int m_test_hw_pool_hits;    // as above, for test CPU organisms
+  int m_test_hw_pool_misses;
+
+
+  // --------  Phenotype Cache Stats  ---------
+  int m_pheno_cache_hits;     // test CPU results reused from a genotype's cPhenotypeCache
+  int m_pheno_cache_misses;   // test CPU runs needed
 
 
   // --------  Organism Kill Stats  ---------
@@ -720,7 +733,12 @@ public:
   void SetCompetitionOrgsReplicated(int _in) { num_orgs_replicated = _in; }
 
   void AddSpeculative(int spec) { m_spec_total += spec; m_spec_num++; }
+  void AddSpeculative(int spec_total, int spec_num) { m_spec_total += spec_total; m_spec_num += spec_num; }
   void AddSpeculativeWaste(int waste) { m_spec_waste += waste; }
+  void AddSpeculativeWaste(int waste, int hw_type);
+  void AddHardwarePoolRequest(bool hit) { if (hit) m_hw_pool_hits++; else m_hw_pool_misses++; }
+  void AddTestHardwarePoolRequest(bool hit) { if (hit) m_test_hw_pool_hits++; else m_test_hw_pool_misses++; }
+  void AddPhenotypeCacheRequest(bool hit) { if (hit) m_pheno_cache_hits++; else m_pheno_cache_misses++; }
 
   // Sexual selection recording
   void RecordSuccessfulMate(cBirthEntry& successful_mate, cBirthEntry& chooser);
@@ -806,6 +824,21 @@ public:
 
   double GetAveSpeculative() const { return (m_spec_num) ? ((double)m_spec_total / (double)m_spec_num) : 0.0; }
   int GetSpeculativeWaste() const { return m_spec_waste; }
+  int GetSpeculativeWaste(int hw_type) const
+    { return (hw_type >= 0 && hw_type < m_spec_waste_hw.GetSize()) ? m_spec_waste_hw[hw_type] : 0; }
+  int GetHardwarePoolHits() const { return m_hw_pool_hits; }
+  int GetHardwarePoolMisses() const { return m_hw_pool_misses; }
+  double GetHardwarePoolHitRate() const
+    { return (m_hw_pool_hits + m_hw_pool_misses) ? ((double)m_hw_pool_hits / (double)(m_hw_pool_hits + m_hw_pool_misses)) : 0.0; }
+  int GetTestHardwarePoolHits() const { return m_test_hw_pool_hits; }
+  int GetTestHardwarePoolMisses() const { return m_test_hw_pool_misses; }
+  int GetPhenotypeCacheHits() const { return m_pheno_cache_hits; }
+  int GetPhenotypeCacheMisses() const { return m_pheno_cache_misses; }
+  double GetPhenotypeCacheHitRate() const
+  {
+    const int requests = m_pheno_cache_hits + m_pheno_cache_misses;
+    return (requests) ? ((double)m_pheno_cache_hits / (double)requests) : 0.0;
+  }
 
   double GetAvgNumOrgsKilled() const { return sum_orgs_killed.Mean(); }
   double GetAvgNumCellsScannedAtKill() const { return sum_cells_scanned_at_kill.Mean(); }
@@ -36,6 +36,9 @@ typedef double (cTaskLib::*tTaskTest)(cTaskContext&) const;
 
 class cTaskEntry
 {
+public:
+  static const int NUM_LOGIC_IDS = 256;
+
 private:
   cString m_name;  // Short keyword for task
   cString m_desc;  // For more human-understandable output...
@@ -44,11 +47,16 @@ private:
   cArgContainer* m_args;
   Apto::String m_prop_id_ave;
   Apto::String m_prop_id_count;
+  
+  // For tasks that depend on nothing but the logic id, the set of logic ids they accept
+  bool m_logic_only;
+  unsigned int m_logic_mask[NUM_LOGIC_IDS / 32];
 
 public:
   cTaskEntry(const cString& name, const cString& desc, int in_id, tTaskTest fun, cArgContainer* args)
-    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args)
+    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args), m_logic_only(false)
   {
+    for (int i = 0; i < NUM_LOGIC_IDS / 32; i++) m_logic_mask[i] = 0;
     m_prop_id_ave = Apto::FormatStr("environment.triggers.%s.average", (const char*)name);
     m_prop_id_count = Apto::FormatStr("environment.triggers.%s.count", (const char*)name);
   }
@@ -68,6 +76,14 @@ public:
   
   bool HasArguments() const { return (m_args != NULL); }
   cArgContainer& GetArguments() const { return *m_args; }
+  
+  void SetLogicOnly() { m_logic_only = true; }
+  void AddLogicId(int logic_id) { m_logic_mask[logic_id >> 5] |= 1u << (logic_id & 31); }
+  bool IsLogicOnly() const { return m_logic_only; }
+  bool AcceptsLogicId(int logic_id) const
+  {
+    return logic_id >= 0 && logic_id < NUM_LOGIC_IDS && ((m_logic_mask[logic_id >> 5] >> (logic_id & 31)) & 1);
+  }
 };
 
 #endif
@@ -37,7 +37,7 @@ const Apto::String Avida::Systematics::GenomeTestMetrics::ObjectKey("Avida::Syst
 
 Avida::Systematics::GenomeTestMetrics::GenomeTestMetrics(cWorld* world, cAvidaContext& ctx, GroupPtr g)
 {
-  Apto::SmartPtr<cTestCPU> testcpu(world->GetHardwareManager().CreateTestCPU(ctx));
+  cTestCPUHandle testcpu(world->GetHardwareManager(), ctx);
   
   cCPUTestInfo test_info;
   testcpu->TestGenome(ctx, test_info, Genome(g->Properties().Get("genome").StringValue()));
@@ -33,6 +33,7 @@
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cOrganism.h"
+#include "cParallelUpdate.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
 #include "cStats.h"
@@ -79,12 +80,22 @@ void Avida2Driver::Run()
                                 m_world->GetConfig().POINT_DEL_PROB.Get() +
                                 m_world->GetConfig().DIV_LGT_PROB.Get();
   
+  const int max_burst = m_world->GetConfig().MAX_BURST_LENGTH.Get();
+  
+  // Speculative windows carry over into the next update, so end of update point mutations would land after cycles that
+  // have already run on the unmutated genome.  The windows cannot be rolled back, so speculation stays off with them.
   void (cPopulation::*ActiveProcessStep)(cAvidaContext& ctx, double step_size, int cell_id) = &cPopulation::ProcessStep;
-  if (m_world->GetConfig().SPECULATIVE.Get() &&
-      m_world->GetConfig().THREAD_SLICING_METHOD.Get() != 1 && !m_world->GetConfig().IMPLICIT_REPRO_END.Get() && point_mut_prob == 0.0) {
+  if (max_burst <= 1 && m_world->GetConfig().SPECULATIVE.Get() && point_mut_prob == 0.0) {
     ActiveProcessStep = &cPopulation::ProcessStepSpeculative;
   }
   
+  // Parallel pre-execution builds on speculative execution; energy tracking shares sleep state across organisms
+  cParallelUpdate* parallel_update = NULL;
+  if (ActiveProcessStep == &cPopulation::ProcessStepSpeculative && m_world->GetConfig().PARALLEL_UPDATE_THREADS.Get() != 0 &&
+      m_world->GetConfig().ENERGY_ENABLED.Get() == 0) {
+    parallel_update = new cParallelUpdate(m_world, m_world->GetConfig().PARALLEL_UPDATE_THREADS.Get());
+  }
+  
   cAvidaContext& ctx = m_world->GetDefaultContext();
   Avida::Context new_ctx(this, &m_world->GetRandom());
   
@@ -108,11 +119,23 @@ void Avida2Driver::Run()
     const int UD_size = m_world->CalculateUpdateSize();
     const double step_size = 1.0 / (double) UD_size;
     
-    for (int i = 0; i < UD_size; i++) {
-      if(population.GetNumOrganisms() == 0) {
-        break;
+    if (parallel_update && population.GetNumOrganisms() > 0) parallel_update->Process(ctx);
+    
+    if (max_burst > 1) {
+      for (int i = 0; i < UD_size; ) {
+        if(population.GetNumOrganisms() == 0) {
+          break;
+        }
+        const int burst_length = (UD_size - i < max_burst) ? (UD_size - i) : max_burst;
+        i += population.ProcessBurst(ctx, step_size, population.ScheduleOrganism(), burst_length);
+      }
+    } else {
+      for (int i = 0; i < UD_size; i++) {
+        if(population.GetNumOrganisms() == 0) {
+          break;
+        }
+        (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
       }
-      (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
     }
     
     // end of update stats...
@@ -137,6 +160,9 @@ void Avida2Driver::Run()
       if (m_world->GetVerbosity() >= VERBOSE_DEBUG) {
         cout << "Spec: " << setw(6) << setprecision(4) << stats.GetAveSpeculative() << "  ";
         cout << "SWst: " << setw(6) << setprecision(4) << (((double)stats.GetSpeculativeWaste() / (double)m_world->CalculateUpdateSize()) * 100.0) << "%  ";
+        for (int hw_type = HARDWARE_TYPE_CPU_ORIGINAL; hw_type <= HARDWARE_TYPE_CPU_BCR; hw_type++) {
+          if (stats.GetSpeculativeWaste(hw_type)) cout << "SWst[" << hw_type << "]: " << stats.GetSpeculativeWaste(hw_type) << "  ";
+        }
       }
 
       cout << endl;
@@ -160,6 +186,8 @@ void Avida2Driver::Run()
 			m_done = true;
 		}
   }
+  
+  delete parallel_update;
 }
 
 void Avida2Driver::Abort(Avida::AbortCondition condition)
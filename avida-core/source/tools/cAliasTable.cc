@@ -0,0 +1,76 @@
+/*
+ *  cAliasTable.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cAliasTable.h"
+
+
+void cAliasTable::Build(const Apto::Array<double>& weights, const Apto::Array<int>& values)
+{
+  assert(weights.GetSize() == values.GetSize());
+
+  const int size = weights.GetSize();
+  m_keep.Resize(size);
+  m_alias.Resize(size);
+  m_value = values;
+
+  m_total_weight = 0.0;
+  for (int i = 0; i < size; i++) m_total_weight += weights[i];
+  if (size == 0 || m_total_weight <= 0.0) {
+    Clear();
+    return;
+  }
+
+  // Scale weights so the average column holds exactly 1.0, then pair each underfull column with an overfull one
+  Apto::Array<int> small(size);
+  Apto::Array<int> large(size);
+  int num_small = 0;
+  int num_large = 0;
+  for (int i = 0; i < size; i++) {
+    m_keep[i] = weights[i] * size / m_total_weight;
+    m_alias[i] = i;
+    if (m_keep[i] < 1.0) small[num_small++] = i;
+    else large[num_large++] = i;
+  }
+
+  while (num_small && num_large) {
+    const int s = small[--num_small];
+    const int l = large[num_large - 1];
+
+    m_alias[s] = l;
+    m_keep[l] -= (1.0 - m_keep[s]);
+    if (m_keep[l] < 1.0) {
+      num_large--;
+      small[num_small++] = l;
+    }
+  }
+
+  // Whatever remains is full up to rounding error
+  while (num_large) m_keep[large[--num_large]] = 1.0;
+  while (num_small) m_keep[small[--num_small]] = 1.0;
+}
+
+void cAliasTable::Clear()
+{
+  m_keep.Resize(0);
+  m_alias.Resize(0);
+  m_value.Resize(0);
+  m_total_weight = 0.0;
+}
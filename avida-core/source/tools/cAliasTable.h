@@ -0,0 +1,71 @@
+/*
+ *  cAliasTable.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cAliasTable_h
+#define cAliasTable_h
+
+#include "apto/core.h"
+#include "apto/rng.h"
+
+#include <cassert>
+
+
+// cAliasTable - Constant time sampling of values in proportion to fixed weights (Walker/Vose alias method)
+//
+// Each of the n columns holds one entry, kept with probability m_keep[col], and an alias entry that is returned
+// otherwise.  A draw consumes a single uniform deviate: its integer part (scaled by n) picks the column and its
+// fractional part decides between the entry and its alias.  The table must be rebuilt whenever a weight changes.
+
+class cAliasTable
+{
+private:
+  Apto::Array<double> m_keep;
+  Apto::Array<int> m_alias;
+  Apto::Array<int> m_value;
+  double m_total_weight;
+
+public:
+  cAliasTable() : m_total_weight(0.0) { ; }
+
+  //! Rebuild the table so that values[i] is drawn with probability weights[i] / sum(weights).
+  void Build(const Apto::Array<double>& weights, const Apto::Array<int>& values);
+  void Clear();
+
+  int GetSize() const { return m_value.GetSize(); }
+  double GetTotalWeight() const { return m_total_weight; }
+
+  inline int Draw(Apto::Random& rng) const;
+};
+
+
+inline int cAliasTable::Draw(Apto::Random& rng) const
+{
+  assert(m_value.GetSize() > 0);
+
+  const int size = m_value.GetSize();
+  const double pos = rng.GetDouble() * size;
+  int col = (int)pos;
+  if (col >= size) col = size - 1;
+
+  return ((pos - col) < m_keep[col]) ? m_value[col] : m_value[m_alias[col]];
+}
+
+#endif
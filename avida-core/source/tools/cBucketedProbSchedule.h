@@ -0,0 +1,57 @@
+/*
+ *  cBucketedProbSchedule.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBucketedProbSchedule_h
+#define cBucketedProbSchedule_h
+
+#include "apto/core.h"
+#include "apto/rng.h"
+#include "apto/scheduler.h"
+
+#include "cBucketedWeightedIndex.h"
+
+
+// cBucketedProbSchedule - Probabilistic merit scheduler backed by a cBucketedWeightedIndex
+//
+// Hands out CPU cycles at random in proportion to merit, exactly like Apto::Scheduler::Probabilistic, but merit
+// updates and draws take constant (rather than logarithmic) time in the population size.  The two draw different
+// random sequences, so runs are not interchangeable between them.
+
+class cBucketedProbSchedule : public Apto::PriorityScheduler
+{
+private:
+  Apto::SmartPtr<Apto::Random> m_rng;
+  cBucketedWeightedIndex m_index;
+
+
+  cBucketedProbSchedule(); // @not_implemented
+  cBucketedProbSchedule(const cBucketedProbSchedule&); // @not_implemented
+  cBucketedProbSchedule& operator=(const cBucketedProbSchedule&); // @not_implemented
+
+public:
+  cBucketedProbSchedule(int entry_count, Apto::SmartPtr<Apto::Random> rng) : m_rng(rng), m_index(entry_count) { ; }
+  ~cBucketedProbSchedule() { ; }
+
+  void AdjustPriority(int entry_id, double priority) { m_index.SetWeight(entry_id, (priority > 0.0) ? priority : 0.0); }
+  int Next() { return m_index.Draw(*m_rng); }
+};
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ *  cBucketedWeightedIndex.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cBucketedWeightedIndex.h"
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+
+
+// Binary exponents of positive finite doubles (as returned by frexp) range over [-1073, 1024]
+static const int BUCKET_EXP_OFFSET = 1074;
+static const int NUM_BUCKETS = 2099;
+
+
+cBucketedWeightedIndex::cBucketedWeightedIndex(int size)
+  : m_weight(size), m_bucket(size), m_slot(size), m_buckets(NUM_BUCKETS), m_active(NUM_BUCKETS), m_num_active(0)
+  , m_total(0.0), m_updates(0)
+{
+  m_weight.SetAll(0.0);
+  m_bucket.SetAll(-1);
+  m_slot.SetAll(-1);
+
+  for (int i = 0; i < NUM_BUCKETS; i++) {
+    sBucket& bucket = m_buckets[i];
+    bucket.num_items = 0;
+    bucket.total = 0.0;
+    bucket.upper = (i - BUCKET_EXP_OFFSET < 1024) ? ldexp(1.0, i - BUCKET_EXP_OFFSET) : DBL_MAX;
+    bucket.active_pos = -1;
+  }
+}
+
+
+void cBucketedWeightedIndex::SetWeight(int id, double weight)
+{
+  assert(id >= 0 && id < m_weight.GetSize());
+  assert(weight >= 0.0 && weight <= DBL_MAX);
+
+  const double old_weight = m_weight[id];
+  if (weight == old_weight) return;
+
+  const int bucket_id = (weight > 0.0) ? bucketFor(weight) : -1;
+  if (bucket_id == m_bucket[id]) {
+    m_buckets[bucket_id].total += weight - old_weight;
+    m_weight[id] = weight;
+  } else {
+    if (m_bucket[id] >= 0) removeItem(id);
+    m_weight[id] = weight;
+    if (bucket_id >= 0) insertItem(id, bucket_id);
+  }
+  m_total += weight - old_weight;
+
+  if (++m_updates > m_weight.GetSize()) resum();
+}
+
+
+int cBucketedWeightedIndex::Draw(Apto::Random& rng) const
+{
+  if (m_num_active == 0 || m_total <= 0.0) return -1;
+
+  // Pick a bucket in proportion to its total; rounding error can only run past the end, so fall back on the last
+  double pos = rng.GetDouble() * m_total;
+  int bucket_id = m_active[m_num_active - 1];
+  for (int i = 0; i < m_num_active - 1; i++) {
+    const double bucket_total = m_buckets[m_active[i]].total;
+    if (pos < bucket_total) {
+      bucket_id = m_active[i];
+      break;
+    }
+    pos -= bucket_total;
+  }
+
+  // Rejection sample within the bucket; the integer part of the deviate picks the slot, the fraction accepts it
+  const sBucket& bucket = m_buckets[bucket_id];
+  while (true) {
+    const double slot_pos = rng.GetDouble() * bucket.num_items;
+    int slot = (int)slot_pos;
+    if (slot >= bucket.num_items) slot = bucket.num_items - 1;
+
+    const int id = bucket.items[slot];
+    if ((slot_pos - slot) * bucket.upper < m_weight[id]) return id;
+  }
+}
+
+
+int cBucketedWeightedIndex::bucketFor(double weight)
+{
+  int exp = 0;
+  frexp(weight, &exp);
+  return exp + BUCKET_EXP_OFFSET;
+}
+
+void cBucketedWeightedIndex::insertItem(int id, int bucket_id)
+{
+  sBucket& bucket = m_buckets[bucket_id];
+  if (bucket.num_items == bucket.items.GetSize()) bucket.items.Resize((bucket.num_items) ? bucket.num_items * 2 : 4);
+
+  m_bucket[id] = bucket_id;
+  m_slot[id] = bucket.num_items;
+  bucket.items[bucket.num_items++] = id;
+  bucket.total += m_weight[id];
+
+  if (bucket.active_pos < 0) {
+    bucket.active_pos = m_num_active;
+    m_active[m_num_active++] = bucket_id;
+  }
+}
+
+void cBucketedWeightedIndex::removeItem(int id)
+{
+  sBucket& bucket = m_buckets[m_bucket[id]];
+
+  // Move the last item into the vacated slot
+  const int slot = m_slot[id];
+  const int last_id = bucket.items[--bucket.num_items];
+  bucket.items[slot] = last_id;
+  m_slot[last_id] = slot;
+  bucket.total -= m_weight[id];
+
+  m_bucket[id] = -1;
+  m_slot[id] = -1;
+
+  if (bucket.num_items == 0) {
+    bucket.total = 0.0;
+
+    const int last_bucket = m_active[--m_num_active];
+    m_active[bucket.active_pos] = last_bucket;
+    m_buckets[last_bucket].active_pos = bucket.active_pos;
+    bucket.active_pos = -1;
+  }
+}
+
+void cBucketedWeightedIndex::resum()
+{
+  m_total = 0.0;
+  for (int i = 0; i < m_num_active; i++) {
+    sBucket& bucket = m_buckets[m_active[i]];
+    bucket.total = 0.0;
+    for (int j = 0; j < bucket.num_items; j++) bucket.total += m_weight[bucket.items[j]];
+    m_total += bucket.total;
+  }
+
+  // Keep the heaviest buckets at the front, so that the walk in Draw usually stops early
+  for (int i = 1; i < m_num_active; i++) {
+    const int bucket_id = m_active[i];
+    int j = i;
+    for (; j > 0 && m_buckets[m_active[j - 1]].total < m_buckets[bucket_id].total; j--) m_active[j] = m_active[j - 1];
+    m_active[j] = bucket_id;
+  }
+  for (int i = 0; i < m_num_active; i++) m_buckets[m_active[i]].active_pos = i;
+
+  m_updates = 0;
+}
@@ -0,0 +1,82 @@
+/*
+ *  cBucketedWeightedIndex.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBucketedWeightedIndex_h
+#define cBucketedWeightedIndex_h
+
+#include "apto/core.h"
+#include "apto/rng.h"
+
+
+// cBucketedWeightedIndex - Weighted sampling with constant time weight updates (bucketed rejection sampling)
+//
+// Items are grouped by the binary exponent of their weight, so every weight in a bucket lies within a factor of two
+// of the bucket's upper bound.  A draw walks the (few) non-empty buckets to pick one in proportion to its total, then
+// picks items uniformly within it and accepts with probability weight / upper bound, which takes fewer than two tries
+// on average.  Changing a weight moves the item between buckets in constant time.  Bucket totals are maintained
+// incrementally and periodically re-summed (and re-ordered, heaviest first) so that rounding error cannot accumulate.
+
+class cBucketedWeightedIndex
+{
+private:
+  struct sBucket
+  {
+    Apto::Array<int> items;
+    int num_items;
+    double total;
+    double upper;          // exclusive upper bound on the weights in this bucket
+    int active_pos;        // position in m_active, or -1 when empty
+  };
+
+  Apto::Array<double> m_weight;
+  Apto::Array<int> m_bucket;   // bucket of each item, -1 if its weight is zero
+  Apto::Array<int> m_slot;     // position of each item within its bucket
+  Apto::Array<sBucket> m_buckets;
+  Apto::Array<int> m_active;   // non-empty buckets
+  int m_num_active;
+  double m_total;
+  int m_updates;               // weight changes since the totals were last re-summed
+
+
+  cBucketedWeightedIndex(); // @not_implemented
+  cBucketedWeightedIndex(const cBucketedWeightedIndex&); // @not_implemented
+  cBucketedWeightedIndex& operator=(const cBucketedWeightedIndex&); // @not_implemented
+
+public:
+  explicit cBucketedWeightedIndex(int size);
+
+  void SetWeight(int id, double weight);
+  double GetWeight(int id) const { return m_weight[id]; }
+
+  double GetTotalWeight() const { return m_total; }
+  int GetSize() const { return m_weight.GetSize(); }
+
+  //! Draw an item id with probability proportional to its weight, or -1 if every weight is zero.
+  int Draw(Apto::Random& rng) const;
+
+private:
+  static int bucketFor(double weight);
+  void insertItem(int id, int bucket_id);
+  void removeItem(int id);
+  void resum();
+};
+
+#endif
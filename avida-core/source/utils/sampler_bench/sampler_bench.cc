@@ -0,0 +1,133 @@
+/*
+ *  sampler_bench.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Microbenchmark for the weighted samplers: times NUM_DRAWS draws (default 10^8) from each sampler over SIZE items
+// with log-uniform weights, then a scheduler-like mix in which every draw is followed by a weight change.
+
+#include "apto/core.h"
+#include "apto/rng.h"
+
+#include "cAliasTable.h"
+#include "cBucketedWeightedIndex.h"
+#include "cOrderedWeightedIndex.h"
+#include "cWeightedIndex.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+
+
+static double Elapsed(clock_t start)
+{
+  return double(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void Report(const char* name, long long draws, double seconds, long long checksum)
+{
+  cout << setw(28) << left << name << setw(10) << right << fixed << setprecision(3) << seconds << " s"
+       << setw(10) << setprecision(2) << (seconds * 1.0e9 / draws) << " ns/draw"
+       << "   (checksum " << checksum << ")" << endl;
+}
+
+
+int main(int argc, char* argv[])
+{
+  if (argc > 4) {
+    cerr << "Usage: " << argv[0] << " [num_draws] [size] [seed]" << endl
+         << "  [num_draws] is the number of draws timed per sampler (default 100000000)." << endl
+         << "  [size] is the number of weighted items (default 3600)." << endl
+         << "  [seed] is the random number seed (default 1)." << endl;
+    exit(1);
+  }
+
+  const long long num_draws = (argc > 1) ? atoll(argv[1]) : 100000000LL;
+  const int size = (argc > 2) ? atoi(argv[2]) : 3600;
+  const int seed = (argc > 3) ? atoi(argv[3]) : 1;
+
+  // Merits in a population commonly span several orders of magnitude
+  Apto::RNG::AvidaRNG rng(seed);
+  Apto::Array<double> weights(size);
+  Apto::Array<int> values(size);
+  for (int i = 0; i < size; i++) {
+    weights[i] = pow(2.0, rng.GetDouble() * 20.0);
+    values[i] = i;
+  }
+
+  cWeightedIndex tree_index(size);
+  cOrderedWeightedIndex ordered_index;
+  cAliasTable alias_table;
+  cBucketedWeightedIndex bucketed_index(size);
+  for (int i = 0; i < size; i++) {
+    tree_index.SetWeight(i, weights[i]);
+    ordered_index.SetWeight(i, weights[i]);
+    bucketed_index.SetWeight(i, weights[i]);
+  }
+  alias_table.Build(weights, values);
+
+  cout << "Timing " << num_draws << " draws over " << size << " items" << endl << endl;
+
+  clock_t start;
+  long long checksum;
+
+  // Static weights
+  start = clock(); checksum = 0;
+  for (long long i = 0; i < num_draws; i++) checksum += tree_index.FindPosition(rng.GetDouble(tree_index.GetTotalWeight()));
+  Report("cWeightedIndex", num_draws, Elapsed(start), checksum);
+
+  start = clock(); checksum = 0;
+  for (long long i = 0; i < num_draws; i++) {
+    checksum += ordered_index.FindPosition(rng.GetDouble(ordered_index.GetTotalWeight()));
+  }
+  Report("cOrderedWeightedIndex", num_draws, Elapsed(start), checksum);
+
+  start = clock(); checksum = 0;
+  for (long long i = 0; i < num_draws; i++) checksum += alias_table.Draw(rng);
+  Report("cAliasTable", num_draws, Elapsed(start), checksum);
+
+  start = clock(); checksum = 0;
+  for (long long i = 0; i < num_draws; i++) checksum += bucketed_index.Draw(rng);
+  Report("cBucketedWeightedIndex", num_draws, Elapsed(start), checksum);
+
+  // Dynamic weights: each draw is followed by a merit change, as in the probabilistic scheduler
+  cout << endl << "Draw + weight update" << endl << endl;
+
+  start = clock(); checksum = 0;
+  for (long long i = 0; i < num_draws; i++) {
+    const int id = tree_index.FindPosition(rng.GetDouble(tree_index.GetTotalWeight()));
+    tree_index.SetWeight(id, pow(2.0, rng.GetDouble() * 20.0));
+    checksum += id;
+  }
+  Report("cWeightedIndex", num_draws, Elapsed(start), checksum);
+
+  start = clock(); checksum = 0;
+  for (long long i = 0; i < num_draws; i++) {
+    const int id = bucketed_index.Draw(rng);
+    bucketed_index.SetWeight(id, pow(2.0, rng.GetDouble() * 20.0));
+    checksum += id;
+  }
+  Report("cBucketedWeightedIndex", num_draws, Elapsed(start), checksum);
+
+  return 0;
+}
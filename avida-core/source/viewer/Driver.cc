@@ -338,8 +338,7 @@ void Avida::Viewer::Driver::Run()
     const double point_mut_prob = m_world->GetConfig().POINT_MUT_PROB.Get();
     
     void (cPopulation::*ActiveProcessStep)(cAvidaContext& ctx, double step_size, int cell_id) = &cPopulation::ProcessStep;
-    if (m_world->GetConfig().SPECULATIVE.Get() &&
-        m_world->GetConfig().THREAD_SLICING_METHOD.Get() != 1 && !m_world->GetConfig().IMPLICIT_REPRO_END.Get()) {
+    if (m_world->GetConfig().SPECULATIVE.Get() && point_mut_prob == 0.0) {
       ActiveProcessStep = &cPopulation::ProcessStepSpeculative;
     }
     
@@ -0,0 +1,166 @@
+/*
+ *  unittests/cpu/CPUMemory.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cAvidaConfig.h"
+#include "cCodeLabel.h"
+#include "cCPUMemory.h"
+#include "cHardwareCPU.h"
+#include "cInstSet.h"
+#include "cStringList.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+
+#include "apto/rng.h"
+
+#include "gtest/gtest.h"
+
+
+// The instruction set only needs the configuration of its world, so none of the world is set up
+class cLabelTestWorld : public cWorld
+{
+public:
+  cLabelTestWorld() : cWorld(new cAvidaConfig, "") { m_new_world = NULL; }
+};
+
+
+// The linear label scans the label index replaced, searching forward from pos or backward from before pos
+static int LinearFindLabelForward(const cCodeLabel& label, const cInstSet& inst_set, const InstructionSequence& seq, int pos)
+{
+  const int search_start = pos;
+  const int label_size = label.GetSize();
+
+  pos += label_size;
+  while (pos < seq.GetSize()) {
+    if (inst_set.IsNop(seq[pos])) {
+      int start_pos = pos;
+      int end_pos = pos + 1;
+      while (start_pos > search_start && inst_set.IsNop(seq[start_pos - 1])) start_pos--;
+      while (end_pos < seq.GetSize() && inst_set.IsNop(seq[end_pos])) end_pos++;
+
+      for (int offset = start_pos; offset + label_size <= end_pos; offset++) {
+        int matches = 0;
+        while (matches < label_size && label[matches] == inst_set.GetNopMod(seq[offset + matches])) matches++;
+        if (matches == label_size) return offset + label_size;
+      }
+      pos = end_pos;
+    }
+    pos += label_size;
+  }
+
+  return -1;
+}
+
+static int LinearFindLabelBackward(const cCodeLabel& label, const cInstSet& inst_set, const InstructionSequence& seq, int pos)
+{
+  const int search_start = pos;
+  const int label_size = label.GetSize();
+
+  pos -= label_size;
+  while (pos >= 0) {
+    if (inst_set.IsNop(seq[pos])) {
+      int start_pos = pos;
+      int end_pos = pos + 1;
+      while (start_pos > 0 && inst_set.IsNop(seq[start_pos - 1])) start_pos--;
+      while (end_pos < search_start && inst_set.IsNop(seq[end_pos])) end_pos++;
+
+      for (int offset = start_pos; offset + label_size <= end_pos; offset++) {
+        int matches = 0;
+        while (matches < label_size && label[matches] == inst_set.GetNopMod(seq[offset + matches])) matches++;
+        if (matches == label_size) return end_pos;
+      }
+      pos = start_pos - 1;
+    }
+    pos -= label_size;
+  }
+
+  return -1;
+}
+
+
+// Half of the drawn instructions are nops, so memory holds plenty of runs of nops to split and join
+static Instruction RandomInst(Apto::Random& rng, const cInstSet& inst_set)
+{
+  if (rng.GetInt(2)) return Instruction(rng.GetInt(inst_set.GetNumNops()));
+  return Instruction(inst_set.GetNumNops() + rng.GetInt(inst_set.GetSize() - inst_set.GetNumNops()));
+}
+
+
+TEST(CPUMemory, LabelIndexMatchesLinearScan)
+{
+  cLabelTestWorld world;
+  cInstSet inst_set(&world, "label_test", HARDWARE_TYPE_CPU_ORIGINAL, cHardwareCPU::GetInstLib(), 10, 1);
+
+  cStringList sl;
+  sl.PushRear("INST nop-A");
+  sl.PushRear("INST nop-B");
+  sl.PushRear("INST nop-C");
+  sl.PushRear("INST if-n-equ");
+  sl.PushRear("INST inc");
+  sl.PushRear("INST swap");
+  sl.PushRear("INST h-search");
+  cUserFeedback feedback;
+  ASSERT_TRUE(inst_set.LoadWithStringList(sl, &feedback));
+  ASSERT_EQ(3, inst_set.GetNumNops());
+
+  Apto::RNG::AvidaRNG rng(1013);
+
+  cCPUMemory memory(100);
+  for (int i = 0; i < memory.GetSize(); i++) memory[i] = RandomInst(rng, inst_set);
+
+  for (int step = 0; step < 20000; step++) {
+    // Edit memory through every path that keeps or drops the label index
+    const int size = memory.GetSize();
+    switch (rng.GetInt(6)) {
+      case 0:
+      case 1:
+        memory.SetInst(rng.GetInt(size), RandomInst(rng, inst_set));
+        break;
+      case 2:
+        memory.Copy(rng.GetInt(size), rng.GetInt(size));
+        break;
+      case 3:
+        if (size < 200) memory.Insert(rng.GetInt(size + 1), RandomInst(rng, inst_set));
+        break;
+      case 4:
+        if (size > 20) {
+          const int num_sites = 1 + rng.GetInt(3);
+          memory.Remove(rng.GetInt(size - num_sites + 1), num_sites);
+        }
+        break;
+      case 5:
+        memory[rng.GetInt(size)] = RandomInst(rng, inst_set);
+        break;
+    }
+
+    // Several searches between edits, so the edits above update a valid index
+    for (int search = 0; search < 4; search++) {
+      cCodeLabel label;
+      const int label_size = 1 + rng.GetInt(4);
+      for (int i = 0; i < label_size; i++) label.AddNop(rng.GetInt(inst_set.GetNumNops()));
+
+      const int pos = rng.GetInt(memory.GetSize());
+      ASSERT_EQ(LinearFindLabelForward(label, inst_set, memory, pos), memory.FindLabelForward(label, inst_set, pos))
+        << "forward search from " << pos << " at step " << step;
+      ASSERT_EQ(LinearFindLabelBackward(label, inst_set, memory, pos), memory.FindLabelBackward(label, inst_set, pos))
+        << "backward search from " << pos << " at step " << step;
+    }
+  }
+}
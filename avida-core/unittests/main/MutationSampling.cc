@@ -0,0 +1,135 @@
+/*
+ *  unittests/main/MutationSampling.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cAliasTable.h"
+#include "cAvidaContext.h"
+#include "cMutationRates.h"
+
+#include "apto/rng.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+
+// Each observed count must lie within 5 standard deviations of its binomial expectation
+static void ExpectBinomial(int observed, int trials, double p)
+{
+  const double mean = trials * p;
+  const double sd = sqrt(trials * p * (1.0 - p));
+  EXPECT_NEAR(mean, observed, 5.0 * sd + 1.0);
+}
+
+
+TEST(MutationSampling, AliasTableFrequencies)
+{
+  Apto::RNG::AvidaRNG rng(101);
+
+  Apto::Array<double> weights(5);
+  Apto::Array<int> values(5);
+  const double w[] = { 1.0, 3.0, 0.5, 10.0, 0.0 };
+  for (int i = 0; i < 5; i++) {
+    weights[i] = w[i];
+    values[i] = 10 + i;
+  }
+
+  cAliasTable table;
+  table.Build(weights, values);
+  EXPECT_DOUBLE_EQ(14.5, table.GetTotalWeight());
+
+  const int trials = 1000000;
+  int counts[5] = { 0, 0, 0, 0, 0 };
+  for (int i = 0; i < trials; i++) {
+    const int value = table.Draw(rng);
+    ASSERT_TRUE(value >= 10 && value < 15);
+    counts[value - 10]++;
+  }
+
+  for (int i = 0; i < 5; i++) ExpectBinomial(counts[i], trials, w[i] / 14.5);
+  EXPECT_EQ(0, counts[4]);
+}
+
+
+TEST(MutationSampling, GeometricSkipMatchesPerSiteRate)
+{
+  const double rates[] = { 0.0075, 0.1, 0.5 };
+  const int trials = 500000;
+
+  for (int r = 0; r < 3; r++) {
+    Apto::RNG::AvidaRNG rng(7 + r);
+    cAvidaContext ctx(NULL, rng);
+
+    cMutationRates per_site;
+    cMutationRates skip;
+    per_site.SetCopyMutProb(rates[r]);
+    skip.SetCopyMutProb(rates[r]);
+    skip.SetSkipSampling(true);
+
+    // Compare hit counts and the distribution of gaps between hits
+    int hits[2] = { 0, 0 };
+    int short_gaps[2] = { 0, 0 };
+    int gaps[2] = { 0, 0 };
+    cMutationRates* muts[2] = { &per_site, &skip };
+    for (int m = 0; m < 2; m++) {
+      int last_hit = -1;
+      for (int i = 0; i < trials; i++) {
+        if (!muts[m]->TestCopyMut(ctx)) continue;
+        hits[m]++;
+        if (last_hit >= 0) {
+          gaps[m]++;
+          if (i - last_hit == 1) short_gaps[m]++;
+        }
+        last_hit = i;
+      }
+    }
+
+    for (int m = 0; m < 2; m++) {
+      ExpectBinomial(hits[m], trials, rates[r]);
+      ExpectBinomial(short_gaps[m], gaps[m], rates[r]);
+    }
+  }
+}
+
+
+TEST(MutationSampling, SkipFollowsRateChanges)
+{
+  Apto::RNG::AvidaRNG rng(42);
+  cAvidaContext ctx(NULL, rng);
+
+  cMutationRates muts;
+  muts.SetSkipSampling(true);
+
+  // A very low rate draws a long gap; raising the rate must not keep honoring it
+  muts.SetCopyMutProb(1e-9);
+  for (int i = 0; i < 100; i++) muts.TestCopyMut(ctx);
+
+  muts.SetCopyMutProb(1.0);
+  for (int i = 0; i < 100; i++) EXPECT_TRUE(muts.TestCopyMut(ctx));
+
+  muts.SetCopyMutProb(0.0);
+  for (int i = 0; i < 100; i++) EXPECT_FALSE(muts.TestCopyMut(ctx));
+
+  const int trials = 200000;
+  int hits = 0;
+  muts.SetCopyMutProb(0.25);
+  for (int i = 0; i < trials; i++) if (muts.TestCopyMut(ctx)) hits++;
+  ExpectBinomial(hits, trials, 0.25);
+}